@@ -47,11 +47,15 @@
 ///      i - It should have a valid xodr_file only when malidrive backend is selected.
 ///     ii - If a xodr_file_path(gflag) is provided then the xodr file path described in the config_file is discarded.
 /// 3. The level of the logger could be setted by: -log_level.
+/// 4. Routes are written, one at a time, to the standard output or to -output_file. The serialization format is
+///    selected with -output_format: `yaml` (default), `jsonl` or `binary`.
 
-#include <cmath>
+#include <exception>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
-#include <sstream>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -65,6 +69,7 @@
 #include <maliput/utility/generate_string.h>
 #include <yaml-cpp/yaml.h>
 
+#include "integration/lane_s_route_writer.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
@@ -89,6 +94,8 @@ DEFINE_string(config_file, "", "YAML file that defines XODR file path, route max
 DEFINE_double(max_length, 1000, "Maximum length of the intermediate lanes between start and end waypoints.[m]");
 DEFINE_string(start_waypoint, "", "Start waypoint to calculate the routing from. Expected format: '{x0, y0, z0}' ");
 DEFINE_string(end_waypoint, "", "End waypoint to calculate the routing to. Expected format: '{x1, y1, z1}' ");
+DEFINE_string(output_format, "yaml", "Serialization format of the routes: <yaml>, <jsonl> or <binary>.");
+DEFINE_string(output_file, "", "File to write the routes to. When empty, routes are written to the standard output.");
 
 namespace YAML {
 
@@ -123,8 +130,6 @@ constexpr const char* kXodrFileKey = "xodr_file";
 constexpr const char* kYamlFileKey = "yaml_file";
 constexpr const char* kMaxLengthKey = "max_length";
 constexpr const char* kWaypointKey = "waypoints";
-// Distances that differ by less than this (in meters) are considered equal.
-constexpr double kDistanceTolerance = 0.01;
 
 // Derives and returns a set of LaneSRoute objects that go from @p start to
 // @p end . If no routes are found, a vector of length zero is returned.
@@ -149,40 +154,12 @@ std::vector<LaneSRoute> GetRoutes(const InertialPosition& start, const InertialP
   return DeriveLaneSRoutes(start_rp.road_position, end_rp.road_position, max_length);
 }
 
-// Serializes the @p routes computed by using the GetRoutes() method into a std::string.
-std::string SerializeLaneSRoutes(const std::vector<LaneSRoute>& routes, const RoadGeometry* road_geometry) {
-  std::stringstream buffer;
-  for (size_t i = 0; i < routes.size(); ++i) {
-    const auto& route = routes.at(i);
-    YAML::Node route_node;
-    for (const auto& range : route.ranges()) {
-      YAML::Node range_node;
-      range_node["Lane"] = range.lane_id().string();
-      const double s0 = range.s_range().s0();
-      const double s1 = range.s_range().s1();
-      const double lane_length = road_geometry->ById().GetLane(range.lane_id())->length();
-      const double lane_length_delta = std::abs(std::abs(s1 - s0) - lane_length);
-      maliput::log()->trace("Lane ", range.lane_id().string(), ", |s1 - s0| = ", std::abs(s1 - s0),
-                            ", lane length = ", lane_length, ", delta = ", lane_length_delta);
-      if (lane_length_delta > kDistanceTolerance) {
-        YAML::Node s_range_node;
-        s_range_node.SetStyle(YAML::EmitterStyle::Flow);
-        s_range_node.push_back(s0);
-        s_range_node.push_back(s1);
-        range_node["SRange"] = s_range_node;
-      }
-      route_node.push_back(range_node);
-    }
-    YAML::Emitter emitter;
-    emitter << route_node;
-    buffer << "Route " << (i + 1) << " of " << routes.size() << ":\n";
-    buffer << emitter.c_str();
-    if (i < routes.size() - 1) {
-      buffer << "\n";
-    }
-  }
-  return buffer.str();
-}
+// Holds the conversions from std::string to LaneSRouteFormat.
+const std::map<std::string, LaneSRouteFormat> string_to_route_format{
+    {"yaml", LaneSRouteFormat::kYaml},
+    {"jsonl", LaneSRouteFormat::kJsonLines},
+    {"binary", LaneSRouteFormat::kBinary},
+};
 
 // Resolves the configuration parameters. Routing configuration can be loaded by using a configuration file or gflags.
 // @param[in] maliput_implementation Selected maliput backend.
@@ -286,6 +263,11 @@ int main(int argc, char* argv[]) {
 
   maliput::common::set_log_level(FLAGS_log_level);
 
+  if (string_to_route_format.find(FLAGS_output_format) == string_to_route_format.end()) {
+    maliput::log()->error("Unknown output format: ", FLAGS_output_format, ". Use <yaml>, <jsonl> or <binary>.");
+    return 1;
+  }
+
   // Get maliput implementation: Dragway, Malidrive or Multilane.
   const MaliputImplementation maliput_implementation{StringToMaliputImplementation(FLAGS_maliput_backend)};
 
@@ -339,7 +321,30 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  std::cout << SerializeLaneSRoutes(routes, road_geometry) << std::endl;
+  std::ofstream output_file;
+  if (!FLAGS_output_file.empty()) {
+    output_file.open(FLAGS_output_file, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output_file.is_open()) {
+      maliput::log()->error("Could not open output file: ", FLAGS_output_file);
+      return 1;
+    }
+  }
+  try {
+    WriteLaneSRoutes(routes, road_geometry, string_to_route_format.at(FLAGS_output_format),
+                     FLAGS_output_file.empty() ? &std::cout : &output_file);
+  } catch (const std::exception& e) {
+    maliput::log()->error("Could not write the routes to ",
+                          FLAGS_output_file.empty() ? std::string{"the standard output"} : FLAGS_output_file, ": ",
+                          e.what());
+    return 1;
+  }
+  if (!FLAGS_output_file.empty()) {
+    output_file.close();
+    if (!output_file) {
+      maliput::log()->error("Could not write output file: ", FLAGS_output_file);
+      return 1;
+    }
+  }
   return 0;
 }
 
@@ -45,24 +45,65 @@
 ///   2. The application allows to select:
 ///      `-phase_duration`: the duration of each phase.
 ///      `-timeout`: the duration of the simulation.
-///   3. The level of the logger is selected with `-log_level`.
+///      `-dynamic_environment_handler`: "fixed" iterates every phase ring every `-phase_duration` seconds, while
+///      "phase_duration" advances each phase ring on its own after the `duration_until` of its current phase, using
+///      `-phase_duration` for phases without one. "schedule" applies the rule state changes listed in
+///      `-rule_state_schedule_file`, e.g. variable speed limits. "replay" plays back the log in `-replay_file`,
+///      starting at `-replay_start` seconds of the log, at its original pace or, when `-replay_speed` is "max", one
+///      record per update. Several handlers can be listed, separated by commas, e.g. "phase_duration,schedule", to run
+///      them in that order of priority on every update. When their updates take longer than `-tick_budget` seconds,
+///      the rest are deferred to the next update, and the cost of each one is reported at exit.
+///   3. The level of the logger is selected with `-log_level`, and the clock the simulation follows with `-timer`.
+///   4. The application sleeps until the next phase transition is due, then applies it and prints what changed.
+///      How late the transitions are with respect to their deadlines, how many of them are later than
+///      `-deadline_miss_tolerance`, the duration of the updates and the loop overhead are summarized at exit and, when
+///      `-report_period` is positive, every `-report_period` seconds.
+///   5. When `-time_step` is positive, the application runs in stepping mode instead: `-timeout` seconds of simulated
+///      time are run in steps of `-time_step` seconds as fast as possible, and the simulated seconds per wall second
+///      and the same summary of the updates, with the lateness in simulated time, are reported at the end.
+///   6. When `-phase_timeline_file` is set, the phases every phase ring goes through within `-timeout` seconds, as
+///      iterated by the "phase_duration" handler, are written to it as CSV and the application exits.
+///   7. When `-num_environments` is greater than one, that many independent copies of the road network and their
+///      dynamic environment handlers are driven by a pool of `-num_workers` threads until `-timeout`, and only a
+///      summary of the updates, along with the same lateness statistics, is reported. It can't be combined with
+///      `-time_step`.
+///   8. When `-record_file` is set, the state changes are recorded to it as a binary log that the "replay" handler
+///      can play back, with a keyframe every `-keyframe_interval` changes. The application fails when the log can't be
+///      written.
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
-#include <thread>
+#include <vector>
 
 #include <gflags/gflags.h>
 #include <maliput/base/rule_filter.h>
 #include <maliput/base/rule_registry.h>
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_abort.h>
+#include <maliput/common/maliput_throw.h>
 
+#include "integration/composite_dynamic_environment_handler.h"
 #include "integration/create_dynamic_environment_handler.h"
 #include "integration/create_timer.h"
+#include "integration/dynamic_environment_changes.h"
+#include "integration/dynamic_environment_driver.h"
 #include "integration/dynamic_environment_handler.h"
+#include "integration/dynamic_environment_recorder.h"
+#include "integration/dynamic_environment_replay_handler.h"
+#include "integration/dynamic_environment_scheduler.h"
+#include "integration/phase_timeline.h"
+#include "integration/rule_state_schedule.h"
+#include "integration/simulated_timer.h"
 #include "integration/timer.h"
 #include "integration/tools.h"
+#include "integration/update_latency_stats.h"
 #include "maliput_gflags.h"
 
 COMMON_PROPERTIES_FLAGS();
@@ -76,6 +117,45 @@ DEFINE_string(maliput_backend, "malidrive",
               "Whether to use <dragway>, <multilane> or <malidrive>. Default is dragway.");
 DEFINE_double(phase_duration, 2, "Duration of the phase in seconds.");
 DEFINE_double(timeout, 20., "Timeout for calling off the simulation in seconds.");
+DEFINE_string(dynamic_environment_handler, "fixed",
+              "Whether to iterate all the phase rings at once every phase_duration seconds <fixed> or each phase ring "
+              "after the duration of its current phase <phase_duration>, or to apply the rule state changes of "
+              "-rule_state_schedule_file <schedule>, or to play back -replay_file <replay>. Several of them can be "
+              "listed, separated by commas, from the highest priority to the lowest.");
+DEFINE_double(tick_budget, 1e-3,
+              "Time in seconds the updates of several dynamic environment handlers can take before the rest are "
+              "deferred to the next update.");
+DEFINE_string(rule_state_schedule_file, "",
+              "YAML file with the rule state changes applied by the <schedule> dynamic environment handler.");
+DEFINE_string(replay_file, "", "Log played back by the <replay> dynamic environment handler.");
+DEFINE_string(replay_speed, "realtime",
+              "Whether the <replay> dynamic environment handler follows the pace of the log <realtime> or applies a "
+              "record per update <max>.");
+DEFINE_double(replay_start, 0., "Time of the log, in seconds, the <replay> dynamic environment handler starts at.");
+DEFINE_string(record_file, "", "When set, the binary log file where the state changes are recorded to.");
+DEFINE_int32(keyframe_interval, 100, "Number of recorded state changes between keyframes of -record_file.");
+DEFINE_double(poll_period, 0.25,
+              "Update period in seconds of dynamic environment handlers that can't tell when their next state change "
+              "is due.");
+DEFINE_double(deadline_miss_tolerance, 1e-3,
+              "Time in seconds a transition can be applied after its deadline before it counts as a missed deadline.");
+DEFINE_double(report_period, 0.,
+              "When positive, period in seconds of the reports of the update lateness and loop overhead.");
+DEFINE_string(timer, "chrono",
+              "Clock the simulation follows: std::chrono::high_resolution_clock <chrono>, std::chrono::steady_clock "
+              "<steady> or the time stamp counter of the processor <tsc>.");
+DEFINE_double(time_step, 0.,
+              "When positive, simulated time is advanced in steps of this many seconds as fast as possible instead of "
+              "following the wall clock.");
+DEFINE_string(phase_timeline_file, "",
+              "When set, the CSV file where the phases of every phase ring within -timeout seconds are written to, "
+              "instead of running the simulation.");
+DEFINE_int32(num_environments, 1,
+             "Number of independent road networks, each with its own dynamic environment handler, to drive at once. "
+             "It can't be combined with -time_step.");
+DEFINE_int32(num_workers, 0,
+             "Number of threads that drive the road networks when -num_environments is greater than one. When "
+             "non-positive, the number of concurrent threads supported by the hardware.");
 
 namespace maliput {
 namespace integration {
@@ -84,6 +164,99 @@ namespace {
 using maliput::api::rules::DiscreteValueRule;
 using maliput::api::rules::RangeValueRule;
 
+// Holds the DynamicEnvironmentHandlerType of every `-dynamic_environment_handler` value.
+const std::map<std::string, DynamicEnvironmentHandlerType> kDynamicEnvironmentHandlerTypes{
+    {"fixed", DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler},
+    {"phase_duration", DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler},
+    {"schedule", DynamicEnvironmentHandlerType::kScheduledRuleStateHandler},
+    {"replay", DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler},
+};
+
+// Holds the TimerType of every `-timer` value.
+const std::map<std::string, TimerType> kTimerTypes{
+    {"chrono", TimerType::kChronoTimer},
+    {"steady", TimerType::kSteadyTimer},
+    {"tsc", TimerType::kTscTimer},
+};
+
+// @returns The timer selected with `-timer`.
+std::unique_ptr<Timer> CreateWallTimer() {
+  const auto timer_type = kTimerTypes.find(FLAGS_timer);
+  MALIPUT_VALIDATE(timer_type != kTimerTypes.end(), "Unknown timer: " + FLAGS_timer);
+  return CreateTimer(timer_type->second);
+}
+
+// Creates a @p type DynamicEnvironmentHandler of @p rn driven by @p timer.
+// @param schedule The schedule applied by a DynamicEnvironmentHandlerType::kScheduledRuleStateHandler.
+std::unique_ptr<DynamicEnvironmentHandler> MakeDynamicEnvironmentHandler(DynamicEnvironmentHandlerType type,
+                                                                         const RuleStateSchedule& schedule,
+                                                                         const Timer* timer, api::RoadNetwork* rn) {
+  if (type == DynamicEnvironmentHandlerType::kScheduledRuleStateHandler) {
+    return CreateDynamicEnvironmentHandler(type, timer, rn, schedule);
+  }
+  if (type == DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler) {
+    MALIPUT_VALIDATE(FLAGS_replay_speed == "realtime" || FLAGS_replay_speed == "max",
+                     "Unknown replay speed: " + FLAGS_replay_speed);
+    // The log is fully read by the handler's constructor.
+    std::ifstream log(FLAGS_replay_file, std::ios::binary);
+    MALIPUT_VALIDATE(log.is_open(), "Could not open: " + FLAGS_replay_file);
+    auto deh = std::make_unique<DynamicEnvironmentReplayHandler>(
+        timer, rn, &log,
+        FLAGS_replay_speed == "max" ? DynamicEnvironmentReplayHandler::Speed::kMaximum
+                                    : DynamicEnvironmentReplayHandler::Speed::kRealTime);
+    if (FLAGS_replay_start > 0.) {
+      deh->Seek(FLAGS_replay_start);
+    }
+    return deh;
+  }
+  return CreateDynamicEnvironmentHandler(type, timer, rn, FLAGS_phase_duration);
+}
+
+// @returns The DynamicEnvironmentHandlerTypes of the comma separated @p handler_names.
+std::vector<DynamicEnvironmentHandlerType> ParseDynamicEnvironmentHandlerTypes(const std::string& handler_names) {
+  std::vector<DynamicEnvironmentHandlerType> types;
+  std::stringstream names(handler_names);
+  for (std::string name; std::getline(names, name, ',');) {
+    const auto type = kDynamicEnvironmentHandlerTypes.find(name);
+    MALIPUT_VALIDATE(type != kDynamicEnvironmentHandlerTypes.end(), "Unknown dynamic environment handler: " + name);
+    types.push_back(type->second);
+  }
+  MALIPUT_VALIDATE(!types.empty(), "-dynamic_environment_handler must be set.");
+  return types;
+}
+
+// Creates a DynamicEnvironmentHandler of @p rn driven by @p timer for every type of @p types. When there are several,
+// they are run by a CompositeDynamicEnvironmentHandler in decreasing order of priority.
+std::unique_ptr<DynamicEnvironmentHandler> MakeDynamicEnvironmentHandler(
+    const std::vector<DynamicEnvironmentHandlerType>& types, const RuleStateSchedule& schedule, const Timer* timer,
+    api::RoadNetwork* rn) {
+  if (types.size() == 1) {
+    return MakeDynamicEnvironmentHandler(types.front(), schedule, timer, rn);
+  }
+  auto composite = std::make_unique<CompositeDynamicEnvironmentHandler>(timer, rn, FLAGS_tick_budget);
+  for (int i = 0; i < static_cast<int>(types.size()); ++i) {
+    composite->AddHandler(MakeDynamicEnvironmentHandler(types[i], schedule, timer, rn),
+                          static_cast<int>(types.size()) - i);
+  }
+  return composite;
+}
+
+// Logs the cost of the children of @p deh, when it is a CompositeDynamicEnvironmentHandler.
+void LogHandlerCosts(const DynamicEnvironmentHandler* deh) {
+  const auto* composite = dynamic_cast<const CompositeDynamicEnvironmentHandler*>(deh);
+  if (composite == nullptr) {
+    return;
+  }
+  log()->info(composite->num_over_budget_ticks(), " updates exceeded the budget of ", composite->tick_budget() * 1e6,
+              " us.");
+  for (int i = 0; i < composite->num_handlers(); ++i) {
+    const CompositeDynamicEnvironmentHandler::HandlerStats& stats = composite->handler_stats(i);
+    log()->info("\tHandler ", i, ": ", stats.num_updates, " updates, mean ",
+                stats.num_updates > 0 ? stats.total_cost / stats.num_updates * 1e6 : 0., " us, max ",
+                stats.max_cost * 1e6, " us, ", stats.num_deferrals, " deferrals.");
+  }
+}
+
 // Obtains all the monostate DiscreteValueRules.
 // @param rulebook RoadRulebook pointer.
 std::map<DiscreteValueRule::Id, DiscreteValueRule> GetStaticDiscreteRules(
@@ -165,27 +338,142 @@ void PrintPhaseRingsCurrentStates(maliput::api::RoadNetwork* rn) {
   // @endcode
 }
 
+// Prints the phase rings, Right-Of-Way rules and bulbs that changed.
+// @param changes The changes made by DynamicEnvironmentHandler::Update().
+void PrintChanges(const DynamicEnvironmentChanges& changes) {
+  std::cout << "Time: " << changes.time << std::endl;
+  for (const auto& phase_change : changes.phases) {
+    std::cout << "PhaseRingId: " << phase_change.phase_ring_id << " | Current Phase: " << phase_change.phase_id
+              << std::endl;
+  }
+  for (const auto& discrete_value_rule_state : changes.discrete_value_rule_states) {
+    std::cout << "\tDiscrete Value Rule: " << discrete_value_rule_state.first.string()
+              << " | State: " << discrete_value_rule_state.second.value << std::endl;
+  }
+  for (const auto& range_value_rule_state : changes.range_value_rule_states) {
+    std::cout << "\tRange Value Rule: " << range_value_rule_state.first.string() << " | State: ["
+              << range_value_rule_state.second.min << ", " << range_value_rule_state.second.max << "]" << std::endl;
+  }
+  for (const auto& bulb_state : changes.bulb_states) {
+    std::cout << "\tBulbUniqueId: " << bulb_state.first.string()
+              << " | State: " << (bulb_state.second == maliput::api::rules::BulbState::kOn ? "On" : "Off") << std::endl;
+  }
+}
+
+// Runs @p end_time seconds of simulated time in steps of @p time_step seconds, as fast as possible, and prints the
+// simulated seconds per wall second and the update statistics at the end. The lateness of the transitions is measured
+// in simulated time, i.e. it comes from the step size, while the durations of the updates and the loop overhead are
+// measured in wall time.
+void RunSteps(double end_time, double time_step, SimulatedTimer* timer, DynamicEnvironmentHandler* deh) {
+  MALIPUT_THROW_UNLESS(timer != nullptr);
+  const std::unique_ptr<Timer> wall_timer = CreateWallTimer();
+  UpdateLatencyStats stats(FLAGS_deadline_miss_tolerance);
+  double loop_start_time{0.};
+  while (timer->Elapsed() < end_time) {
+    const std::optional<double> next_update_time = deh->NextUpdateTime();
+    timer->Advance(std::min(time_step, end_time - timer->Elapsed()));
+    const double update_start_time = wall_timer->Elapsed();
+    deh->Update();
+    const double update_end_time = wall_timer->Elapsed();
+    stats.AddUpdate(update_end_time - update_start_time, update_start_time - loop_start_time);
+    stats.AddTransitions(deh->last_changes(), next_update_time, timer->Elapsed());
+    loop_start_time = update_end_time;
+  }
+  const double wall_time = wall_timer->Elapsed();
+  log()->info("Simulated ", timer->Elapsed(), " s in ", wall_time, " s of wall time: ",
+              wall_time > 0. ? timer->Elapsed() / wall_time : 0., " simulated seconds per wall second.");
+  log()->info("All updates: ", stats.Summary());
+}
+
+// Drives @p deh_types handlers over every road network of @p road_networks until @p end_time with a pool of
+// @p num_workers threads and reports how many updates and changes were made.
+void RunEnvironments(const std::vector<std::unique_ptr<api::RoadNetwork>>& road_networks,
+                     const std::vector<DynamicEnvironmentHandlerType>& deh_types, const RuleStateSchedule& schedule,
+                     double end_time, int num_workers) {
+  const std::unique_ptr<Timer> timer = CreateWallTimer();
+  DynamicEnvironmentDriver driver(timer.get(), num_workers, FLAGS_poll_period, FLAGS_deadline_miss_tolerance);
+  // The handlers take their first deadlines from the timer, so it is reset before they are built.
+  timer->Reset();
+  // Subscribers run in the worker threads.
+  std::atomic<int64_t> num_changes{0};
+  for (const auto& rn : road_networks) {
+    std::unique_ptr<DynamicEnvironmentHandler> deh =
+        MakeDynamicEnvironmentHandler(deh_types, schedule, timer.get(), rn.get());
+    deh->Subscribe([&num_changes](const DynamicEnvironmentChanges&) { ++num_changes; });
+    driver.AddHandler(std::move(deh));
+  }
+  log()->info("Driving ", driver.num_handlers(), " dynamic environments with ", driver.num_threads(), " threads...");
+  const DynamicEnvironmentDriver::Report report = driver.Run(end_time);
+  log()->info("Made ", report.num_updates, " updates, ", num_changes, " of which changed states, and ",
+              report.num_steals, " steals. The largest update delay was ", report.max_update_delay * 1e6, " us.");
+  log()->info("All updates: ", report.stats.Summary());
+}
+
 int Main(int argc, char* argv[]) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
   common::set_log_level(FLAGS_log_level);
 
   log()->info("Loading road network using ", FLAGS_maliput_backend, " backend implementation...");
   const MaliputImplementation maliput_implementation{StringToMaliputImplementation(FLAGS_maliput_backend)};
-  auto rn = LoadRoadNetwork(
-      maliput_implementation,
-      {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width, FLAGS_maximum_height}, {FLAGS_yaml_file},
-      {FLAGS_xodr_file_path, GetLinearToleranceFlag(), GetMaxLinearToleranceFlag(), GetAngularToleranceFlag(),
-       FLAGS_build_policy, FLAGS_num_threads, FLAGS_simplification_policy, FLAGS_standard_strictness_policy,
-       FLAGS_omit_nondrivable_lanes, FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file,
-       FLAGS_phase_ring_book_file, FLAGS_intersection_book_file},
-      {FLAGS_osm_file, FLAGS_linear_tolerance, FLAGS_max_linear_tolerance,
-       maliput::math::Vector2::FromStr(FLAGS_origin), FLAGS_rule_registry_file, FLAGS_road_rule_book_file,
-       FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file, FLAGS_intersection_book_file});
+  const auto load_road_network = [maliput_implementation]() {
+    return LoadRoadNetwork(
+        maliput_implementation,
+        {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width, FLAGS_maximum_height},
+        {FLAGS_yaml_file},
+        {FLAGS_xodr_file_path, GetLinearToleranceFlag(), GetMaxLinearToleranceFlag(), GetAngularToleranceFlag(),
+         FLAGS_build_policy, FLAGS_num_threads, FLAGS_simplification_policy, FLAGS_standard_strictness_policy,
+         FLAGS_omit_nondrivable_lanes, FLAGS_rule_registry_file, FLAGS_road_rule_book_file,
+         FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file, FLAGS_intersection_book_file},
+        {FLAGS_osm_file, FLAGS_linear_tolerance, FLAGS_max_linear_tolerance,
+         maliput::math::Vector2::FromStr(FLAGS_origin), FLAGS_rule_registry_file, FLAGS_road_rule_book_file,
+         FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file, FLAGS_intersection_book_file});
+  };
+  auto rn = load_road_network();
   log()->info("RoadNetwork loaded successfully.");
 
-  const std::unique_ptr<const Timer> timer = CreateTimer(TimerType::kChronoTimer);
-  const std::unique_ptr<DynamicEnvironmentHandler> deh = CreateDynamicEnvironmentHandler(
-      DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler, timer.get(), rn.get(), FLAGS_phase_duration);
+  if (!FLAGS_phase_timeline_file.empty()) {
+    const PhaseTimeline phase_timeline(rn->phase_ring_book(), rn->phase_provider(), FLAGS_phase_duration);
+    std::ofstream file(FLAGS_phase_timeline_file);
+    MALIPUT_VALIDATE(file.is_open(), "Could not open: " + FLAGS_phase_timeline_file);
+    phase_timeline.WriteCsv(FLAGS_timeout, &file);
+    MALIPUT_VALIDATE(static_cast<bool>(file), "Could not write: " + FLAGS_phase_timeline_file);
+    file.close();
+    MALIPUT_VALIDATE(!file.fail(), "Could not write: " + FLAGS_phase_timeline_file);
+    log()->info("Phase timeline written to ", FLAGS_phase_timeline_file, ".");
+    return 0;
+  }
+
+  const std::vector<DynamicEnvironmentHandlerType> handler_types =
+      ParseDynamicEnvironmentHandlerTypes(FLAGS_dynamic_environment_handler);
+  MALIPUT_VALIDATE(FLAGS_time_step >= 0., "-time_step must be non-negative.");
+  MALIPUT_VALIDATE(FLAGS_deadline_miss_tolerance >= 0., "-deadline_miss_tolerance must be non-negative.");
+  MALIPUT_VALIDATE(FLAGS_num_environments > 0, "-num_environments must be positive.");
+  MALIPUT_VALIDATE(FLAGS_record_file.empty() || FLAGS_num_environments == 1,
+                   "-record_file requires a single environment.");
+  MALIPUT_VALIDATE(FLAGS_time_step == 0. || FLAGS_num_environments == 1, "-time_step requires a single environment.");
+  RuleStateSchedule schedule;
+  const auto schedule_type = DynamicEnvironmentHandlerType::kScheduledRuleStateHandler;
+  if (std::find(handler_types.begin(), handler_types.end(), schedule_type) != handler_types.end()) {
+    MALIPUT_VALIDATE(!FLAGS_rule_state_schedule_file.empty(), "-rule_state_schedule_file must be set.");
+    schedule = LoadRuleStateScheduleFromFile(FLAGS_rule_state_schedule_file);
+  }
+  if (FLAGS_num_environments > 1) {
+    // Each environment needs its own road network, as the handlers change the states of their road network
+    // concurrently.
+    std::vector<std::unique_ptr<api::RoadNetwork>> road_networks;
+    road_networks.reserve(FLAGS_num_environments);
+    road_networks.push_back(std::move(rn));
+    while (static_cast<int>(road_networks.size()) < FLAGS_num_environments) {
+      road_networks.push_back(load_road_network());
+    }
+    log()->info(road_networks.size(), " RoadNetworks loaded successfully.");
+    RunEnvironments(road_networks, handler_types, schedule, FLAGS_timeout, FLAGS_num_workers);
+    return 0;
+  }
+  const std::unique_ptr<Timer> timer =
+      FLAGS_time_step > 0. ? CreateTimer(TimerType::kSimulatedTimer) : CreateWallTimer();
+  const std::unique_ptr<DynamicEnvironmentHandler> deh =
+      MakeDynamicEnvironmentHandler(handler_types, schedule, timer.get(), rn.get());
 
   // Obtains static rules.
   PrintStaticDiscreteRulesStates(rn.get());
@@ -194,12 +482,58 @@ int Main(int argc, char* argv[]) {
   // Dynamics rules can also be queried via `DiscreteValueRuleStateProvider` and `RangeValueRuleStateProvider`.
   // In particular for the intersections, maliput provides some convenient classes to obtain the current phase which
   // matches with current states in the Right-Of-Way Rule Type rules and bulb states that are present.
-  while (timer->Elapsed() <= FLAGS_timeout) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(250));
-    std::cout << "Time: " << timer->Elapsed() << std::endl;
-    deh->Update();
-    PrintPhaseRingsCurrentStates(rn.get());
+  std::cout << "Time: " << timer->Elapsed() << std::endl;
+  PrintPhaseRingsCurrentStates(rn.get());
+  std::ofstream record_file;
+  std::unique_ptr<DynamicEnvironmentRecorder> recorder;
+  if (!FLAGS_record_file.empty()) {
+    record_file.open(FLAGS_record_file, std::ios::binary);
+    MALIPUT_VALIDATE(record_file.is_open(), "Could not open: " + FLAGS_record_file);
+    recorder = std::make_unique<DynamicEnvironmentRecorder>(timer.get(), rn.get(), deh.get(), &record_file,
+                                                            FLAGS_keyframe_interval);
+  }
+  // Flushes and closes `record_file`, so that write errors after the last keyframe are reported too.
+  const auto finish_recording = [&record_file, &recorder]() {
+    if (recorder != nullptr) {
+      recorder->Flush();
+      MALIPUT_VALIDATE(static_cast<bool>(record_file), "Could not write: " + FLAGS_record_file);
+      log()->info("Recorded ", recorder->num_deltas(), " state changes and ", recorder->num_keyframes(),
+                  " keyframes in ", recorder->bytes_written(), " bytes to ", FLAGS_record_file, ".");
+      recorder.reset();
+      record_file.close();
+      MALIPUT_VALIDATE(!record_file.fail(), "Could not write: " + FLAGS_record_file);
+    }
+  };
+  // From now on, only what changes is printed.
+  int num_updates{0};
+  deh->Subscribe([&num_updates](const DynamicEnvironmentChanges& changes) {
+    ++num_updates;
+    PrintChanges(changes);
+  });
+  if (FLAGS_time_step > 0.) {
+    RunSteps(FLAGS_timeout, FLAGS_time_step, dynamic_cast<SimulatedTimer*>(timer.get()), deh.get());
+    log()->info("States changed in ", num_updates, " updates.");
+    finish_recording();
+    LogHandlerCosts(deh.get());
+    return 0;
+  }
+  // The scheduler sleeps until the next phase transition is due, so states are only printed when they change.
+  DynamicEnvironmentScheduler scheduler(timer.get(), deh.get(), FLAGS_poll_period, FLAGS_deadline_miss_tolerance);
+  UpdateLatencyStats stats(FLAGS_deadline_miss_tolerance);
+  double next_report_time{FLAGS_report_period};
+  while (scheduler.WaitAndUpdate(FLAGS_timeout)) {
+    log()->debug("Update delayed ", scheduler.last_update_delay() * 1e6, " us from its deadline.");
+    if (FLAGS_report_period > 0. && timer->Elapsed() >= next_report_time) {
+      log()->info("Updates until ", timer->Elapsed(), " s: ", scheduler.stats().Summary());
+      stats.Merge(scheduler.stats());
+      scheduler.ResetStats();
+      next_report_time = timer->Elapsed() + FLAGS_report_period;
+    }
   }
+  stats.Merge(scheduler.stats());
+  log()->info("All updates: ", stats.Summary());
+  LogHandlerCosts(deh.get());
+  finish_recording();
 
   return 0;
 }
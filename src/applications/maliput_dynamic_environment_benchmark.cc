@@ -0,0 +1,643 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file maliput_dynamic_environment_benchmark.cc
+///
+/// Measures the cost of the building blocks of the dynamic environment handlers on synthetic data, so that they can
+/// be assessed at scales the available maps don't reach.
+///
+/// @note
+///   1. The benchmark to run is selected with `-benchmark`:
+///      - "lane_rules": builds a dragway of `-num_lanes` lanes with `-num_rules` speed limit and right-of-way rules
+///        over random s ranges, and runs `-num_ticks` queries over random s ranges of its lanes, both through
+///        RoadRulebook::FindRules() and the state providers, as maliput_query does, and through a LaneRuleIndex.
+///        Every query finds the most restrictive speed limit and the right-of-way rules. The time and the number of
+///        heap allocations per query are reported, along with the number of queries whose results differ.
+///      - "phase_update": builds `-num_phase_rings` phase rings of `-num_phases` phases each and advances all of them
+///        `-num_ticks` times, both by looking every phase ring up as the handlers used to do and through a
+///        PhaseRingTable, as they do now. Then, it calls Update() `-num_ticks` times on a FixedPhaseIterationHandler
+///        and on a PhaseDurationIterationHandler, advancing a SimulatedTimer so that every phase ring changes its
+///        phase on every call. The time and the number of heap allocations per tick are reported.
+///      - "snapshot_contention": `-num_readers` threads look up the states of `-num_rules` discrete value rules for
+///        `-duration` seconds while the main thread changes one of them every `-write_period` seconds. The states are
+///        guarded by a global mutex first and kept in a LeftRight, as DynamicEnvironmentSnapshotPublisher does,
+///        next. The reads per second and the mean write time are reported.
+///      - "timer_elapsed": calls Timer::Elapsed() `-num_calls` times on every TimerType that the platform supports,
+///        and std::chrono::steady_clock::now() directly as a baseline. The time per call and the smallest non-zero
+///        difference between consecutive readings are reported.
+///   2. The level of the logger is selected with `-log_level`.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/rule_registry.h>
+#include <maliput/api/segment.h>
+#include <maliput/base/intersection_book.h>
+#include <maliput/base/manual_discrete_value_rule_state_provider.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/base/manual_phase_ring_book.h>
+#include <maliput/base/manual_range_value_rule_state_provider.h>
+#include <maliput/base/manual_right_of_way_rule_state_provider.h>
+#include <maliput/base/manual_rulebook.h>
+#include <maliput/base/rule_registry.h>
+#include <maliput/base/traffic_light_book.h>
+#include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput_dragway/road_geometry.h>
+
+#include "integration/create_timer.h"
+#include "integration/fixed_phase_iteration_handler.h"
+#include "integration/lane_rule_index.h"
+#include "integration/left_right.h"
+#include "integration/phase_duration_iteration_handler.h"
+#include "integration/phase_ring_table.h"
+#include "integration/simulated_timer.h"
+#include "integration/timer.h"
+#include "integration/tsc_timer.h"
+#include "maliput_gflags.h"
+
+namespace {
+
+// Number of calls to the global operator new, so that benchmarks can report the allocations they make.
+std::atomic<int64_t> num_allocations{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++num_allocations;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace maliput {
+namespace integration {
+namespace {
+
+MALIPUT_APPLICATION_DEFINE_LOG_LEVEL_FLAG();
+
+DEFINE_string(benchmark, "phase_update",
+              "Benchmark to run: <lane_rules>, <phase_update>, <snapshot_contention> or <timer_elapsed>.");
+DEFINE_int32(num_phase_rings, 5000, "Number of synthetic phase rings.");
+DEFINE_int32(num_phases, 4, "Number of phases of every synthetic phase ring. It must be at least two.");
+DEFINE_int32(num_ticks, 1000, "Number of measured ticks.");
+DEFINE_int32(num_readers, 8, "Number of reader threads.");
+DEFINE_int32(num_rules, 1000, "Number of synthetic rules.");
+DEFINE_int32(num_lanes, 10, "Number of lanes of the synthetic dragway.");
+DEFINE_double(duration, 1., "Duration of every contention measurement, in seconds.");
+DEFINE_double(write_period, 0.01, "Period of the writes during contention measurements, in seconds.");
+DEFINE_int32(num_calls, 10000000, "Number of measured calls of every timer.");
+
+// Cost of a benchmarked tick.
+struct TickCost {
+  // Mean duration of a tick, in seconds.
+  double duration{};
+  // Mean number of heap allocations of a tick.
+  double allocations{};
+};
+
+// Measures `tick` over `num_ticks` calls, after a first warm-up call.
+TickCost MeasureTicks(int num_ticks, const std::function<void()>& tick) {
+  tick();
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  const int64_t allocations_before = num_allocations;
+  timer->Reset();
+  for (int i = 0; i < num_ticks; ++i) {
+    tick();
+  }
+  const double duration = timer->Elapsed();
+  const int64_t allocations = num_allocations - allocations_before;
+  return {duration / num_ticks, static_cast<double>(allocations) / num_ticks};
+}
+
+// Populates @p phase_ring_book and @p phase_provider with @p num_phase_rings phase rings that cycle through
+// @p num_phases phases of one second each. Every phase ring has a right-of-way rule whose state changes with every
+// phase.
+void BuildPhaseRings(int num_phase_rings, int num_phases, ManualPhaseRingBook* phase_ring_book,
+                     ManualPhaseProvider* phase_provider) {
+  std::unordered_map<api::rules::Phase::Id, std::vector<api::rules::PhaseRing::NextPhase>> next_phases;
+  std::vector<api::rules::Phase::Id> phase_ids;
+  for (int i = 0; i < num_phases; ++i) {
+    phase_ids.emplace_back("Phase_" + std::to_string(i));
+  }
+  for (int i = 0; i < num_phases; ++i) {
+    next_phases.emplace(phase_ids[i], std::vector<api::rules::PhaseRing::NextPhase>{
+                                          {phase_ids[(i + 1) % num_phases], std::optional<double>(1.)}});
+  }
+  for (int i = 0; i < num_phase_rings; ++i) {
+    const api::rules::PhaseRing::Id phase_ring_id("Ring_" + std::to_string(i));
+    const api::rules::Rule::Id rule_id("Right-Of-Way Rule Type/Rule_" + std::to_string(i));
+    std::vector<api::rules::Phase> phases;
+    for (int j = 0; j < num_phases; ++j) {
+      api::rules::DiscreteValueRule::DiscreteValue state;
+      state.value = "State_" + std::to_string(j);
+      phases.emplace_back(phase_ids[j], api::rules::DiscreteValueRuleStates{{rule_id, state}});
+    }
+    phase_ring_book->AddPhaseRing(api::rules::PhaseRing(phase_ring_id, phases, next_phases));
+    phase_provider->AddPhaseRing(phase_ring_id, phase_ids[0], phase_ids[1], 1.);
+  }
+}
+
+// Length of the lanes of the benchmark dragways, in meters.
+constexpr double kDragwayLength{100.};
+
+// @returns A dragway of @p num_lanes lanes of kDragwayLength meters.
+std::unique_ptr<dragway::RoadGeometry> BuildDragway(int num_lanes) {
+  return std::make_unique<dragway::RoadGeometry>(
+      api::RoadGeometryId{"Benchmark dragway"}, num_lanes, kDragwayLength, 3.7 /* lane_width */,
+      0. /* shoulder_width */, 5. /* maximum_height */, std::numeric_limits<double>::epsilon(),
+      std::numeric_limits<double>::epsilon(), maliput::math::Vector3(0, 0, 0));
+}
+
+// @returns A single lane dragway road network whose phase ring book and phase provider hold @p num_phase_rings
+//          phase rings of @p num_phases phases each. See BuildPhaseRings().
+std::unique_ptr<api::RoadNetwork> BuildRoadNetwork(int num_phase_rings, int num_phases) {
+  auto road_geometry = BuildDragway(1);
+  auto rulebook = std::make_unique<ManualRulebook>();
+  auto phase_ring_book = std::make_unique<ManualPhaseRingBook>();
+  auto phase_provider = std::make_unique<ManualPhaseProvider>();
+  BuildPhaseRings(num_phase_rings, num_phases, phase_ring_book.get(), phase_provider.get());
+  auto intersection_book = std::make_unique<IntersectionBook>(road_geometry.get());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  auto right_of_way_rule_state_provider = std::make_unique<ManualRightOfWayRuleStateProvider>();
+#pragma GCC diagnostic pop
+  auto discrete_value_rule_state_provider = std::make_unique<ManualDiscreteValueRuleStateProvider>(rulebook.get());
+  auto range_value_rule_state_provider = std::make_unique<ManualRangeValueRuleStateProvider>(rulebook.get());
+  return std::make_unique<api::RoadNetwork>(
+      std::move(road_geometry), std::move(rulebook), std::make_unique<TrafficLightBook>(),
+      std::move(intersection_book), std::move(phase_ring_book), std::move(right_of_way_rule_state_provider),
+      std::move(phase_provider), std::make_unique<api::rules::RuleRegistry>(),
+      std::move(discrete_value_rule_state_provider), std::move(range_value_rule_state_provider));
+}
+
+// A query over an s range of a lane.
+struct LaneQuery {
+  int lane_index{};
+  double s0{};
+  double s1{};
+};
+
+// Results of a LaneQuery.
+struct LaneQueryResult {
+  // Maximum speed of the most restrictive speed limit, if any.
+  std::optional<double> max_speed;
+  // Number of right-of-way rules.
+  int num_right_of_ways{};
+};
+
+// Tolerance of the queries, in meters.
+constexpr double kQueryTolerance{1e-3};
+// Length of the s ranges of the queries, in meters.
+constexpr double kQueryLength{10.};
+
+// @returns A dragway road network of @p num_lanes lanes whose rulebook holds @p num_rules rules, alternating speed
+//          limits and right-of-way rules over random s ranges of the lanes. Every rule has a known state.
+std::unique_ptr<api::RoadNetwork> BuildRuleRoadNetwork(int num_lanes, int num_rules, std::mt19937* generator) {
+  auto road_geometry = BuildDragway(num_lanes);
+  auto rulebook = std::make_unique<ManualRulebook>();
+  std::vector<api::rules::DiscreteValueRule> discrete_value_rules;
+  std::vector<api::rules::RangeValueRule> range_value_rules;
+  std::uniform_real_distribution<double> s_distribution(0., kDragwayLength);
+  std::uniform_real_distribution<double> speed_distribution(10., 40.);
+  api::rules::DiscreteValueRule::DiscreteValue go;
+  go.value = "Go";
+  api::rules::DiscreteValueRule::DiscreteValue stop;
+  stop.value = "Stop";
+  for (int i = 0; i < num_rules; ++i) {
+    const api::Lane* lane = road_geometry->junction(0)->segment(0)->lane(i % num_lanes);
+    const double s0 = s_distribution(*generator);
+    const double s1 = s_distribution(*generator);
+    const api::LaneSRoute zone({api::LaneSRange(lane->id(), api::SRange(std::min(s0, s1), std::max(s0, s1)))});
+    if (i % 2 == 0) {
+      api::rules::RangeValueRule::Range range;
+      range.description = "Speed limit";
+      range.min = 0.;
+      range.max = speed_distribution(*generator);
+      range_value_rules.emplace_back(
+          api::rules::Rule::Id(SpeedLimitRuleTypeId().string() + "/Rule_" + std::to_string(i)),
+          SpeedLimitRuleTypeId(), zone, std::vector<api::rules::RangeValueRule::Range>{range});
+      rulebook->AddRule(range_value_rules.back());
+    } else {
+      discrete_value_rules.emplace_back(
+          api::rules::Rule::Id(RightOfWayRuleTypeId().string() + "/Rule_" + std::to_string(i)),
+          RightOfWayRuleTypeId(), zone, std::vector<api::rules::DiscreteValueRule::DiscreteValue>{go, stop});
+      rulebook->AddRule(discrete_value_rules.back());
+    }
+  }
+  auto intersection_book = std::make_unique<IntersectionBook>(road_geometry.get());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  auto right_of_way_rule_state_provider = std::make_unique<ManualRightOfWayRuleStateProvider>();
+#pragma GCC diagnostic pop
+  auto discrete_value_rule_state_provider = std::make_unique<ManualDiscreteValueRuleStateProvider>(rulebook.get());
+  for (const auto& rule : discrete_value_rules) {
+    discrete_value_rule_state_provider->SetState(rule.id(), rule.states().front(), std::nullopt, std::nullopt);
+  }
+  auto range_value_rule_state_provider = std::make_unique<ManualRangeValueRuleStateProvider>(rulebook.get());
+  for (const auto& rule : range_value_rules) {
+    range_value_rule_state_provider->SetState(rule.id(), rule.states().front(), std::nullopt, std::nullopt);
+  }
+  return std::make_unique<api::RoadNetwork>(
+      std::move(road_geometry), std::move(rulebook), std::make_unique<TrafficLightBook>(),
+      std::move(intersection_book), std::make_unique<ManualPhaseRingBook>(),
+      std::move(right_of_way_rule_state_provider), std::make_unique<ManualPhaseProvider>(),
+      std::make_unique<api::rules::RuleRegistry>(),
+      std::move(discrete_value_rule_state_provider), std::move(range_value_rule_state_provider));
+}
+
+// Runs @p query through RoadRulebook::FindRules() and the state providers of @p road_network.
+LaneQueryResult QueryRulebook(api::RoadNetwork* road_network, const LaneQuery& query) {
+  const api::Lane* lane = road_network->road_geometry()->junction(0)->segment(0)->lane(query.lane_index);
+  const api::rules::RoadRulebook::QueryResults rules = road_network->rulebook()->FindRules(
+      {api::LaneSRange(lane->id(), api::SRange(query.s0, query.s1))}, kQueryTolerance);
+  LaneQueryResult result;
+  for (const auto& id_rule : rules.range_value_rules) {
+    if (id_rule.second.type_id() != SpeedLimitRuleTypeId()) {
+      continue;
+    }
+    const auto state = road_network->range_value_rule_state_provider()->GetState(id_rule.first);
+    if (state.has_value() && (!result.max_speed.has_value() || state->state.max < *result.max_speed)) {
+      result.max_speed = state->state.max;
+    }
+  }
+  for (const auto& id_rule : rules.discrete_value_rules) {
+    if (id_rule.second.type_id() == RightOfWayRuleTypeId() &&
+        road_network->discrete_value_rule_state_provider()->GetState(id_rule.first).has_value()) {
+      ++result.num_right_of_ways;
+    }
+  }
+  return result;
+}
+
+// Runs @p query through @p index. The lane is looked up by ID, as a query that comes from a user would be.
+LaneQueryResult QueryIndex(const api::RoadNetwork& road_network, const LaneRuleIndex& index, const LaneQuery& query,
+                           std::vector<int>* rule_indices) {
+  const api::Lane* lane = road_network.road_geometry()->junction(0)->segment(0)->lane(query.lane_index);
+  const int lane_index = index.LaneIndex(lane->id()).value();
+  LaneQueryResult result;
+  const std::optional<int> speed_limit = index.FindMaxSpeedLimit(lane_index, query.s0, query.s1, kQueryTolerance);
+  if (speed_limit.has_value()) {
+    result.max_speed = index.range_value_rule_state(*speed_limit)->max;
+  }
+  rule_indices->clear();
+  index.FindRightOfWays(lane_index, query.s0, query.s1, kQueryTolerance, rule_indices);
+  for (int rule_index : *rule_indices) {
+    if (index.discrete_value_rule_state(rule_index).has_value()) {
+      ++result.num_right_of_ways;
+    }
+  }
+  return result;
+}
+
+void BenchmarkLaneRules() {
+  MALIPUT_VALIDATE(FLAGS_num_lanes > 0, "--num_lanes must be positive.");
+  MALIPUT_VALIDATE(FLAGS_num_rules > 0, "--num_rules must be positive.");
+  // A fixed seed makes runs comparable.
+  std::mt19937 generator(42);
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      BuildRuleRoadNetwork(FLAGS_num_lanes, FLAGS_num_rules, &generator);
+  std::uniform_int_distribution<int> lane_distribution(0, FLAGS_num_lanes - 1);
+  std::uniform_real_distribution<double> s_distribution(0., kDragwayLength - kQueryLength);
+  std::vector<LaneQuery> queries(FLAGS_num_ticks);
+  for (LaneQuery& query : queries) {
+    query.lane_index = lane_distribution(generator);
+    query.s0 = s_distribution(generator);
+    query.s1 = query.s0 + kQueryLength;
+  }
+  log()->info("Lanes: ", FLAGS_num_lanes, ", rules: ", FLAGS_num_rules, ", queries: ", FLAGS_num_ticks, ".");
+
+  std::vector<LaneQueryResult> rulebook_results(queries.size());
+  size_t next_query{0};
+  const TickCost rulebook_cost = MeasureTicks(FLAGS_num_ticks, [&]() {
+    const size_t i = next_query++ % queries.size();
+    rulebook_results[i] = QueryRulebook(road_network.get(), queries[i]);
+  });
+  log()->info("\tRoadRulebook::FindRules: ", rulebook_cost.duration * 1e6, " us/query, ", rulebook_cost.allocations,
+              " allocations/query.");
+
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  const LaneRuleIndex index(road_network.get());
+  log()->info("\tLaneRuleIndex construction: ", timer->Elapsed() * 1e3, " ms.");
+  std::vector<LaneQueryResult> index_results(queries.size());
+  std::vector<int> rule_indices;
+  rule_indices.reserve(FLAGS_num_rules);
+  next_query = 0;
+  const TickCost index_cost = MeasureTicks(FLAGS_num_ticks, [&]() {
+    const size_t i = next_query++ % queries.size();
+    index_results[i] = QueryIndex(*road_network, index, queries[i], &rule_indices);
+  });
+  log()->info("\tLaneRuleIndex: ", index_cost.duration * 1e6, " us/query, ", index_cost.allocations,
+              " allocations/query.");
+
+  int num_mismatches{0};
+  for (size_t i = 0; i < queries.size(); ++i) {
+    if (rulebook_results[i].max_speed != index_results[i].max_speed ||
+        rulebook_results[i].num_right_of_ways != index_results[i].num_right_of_ways) {
+      ++num_mismatches;
+    }
+  }
+  log()->info("\tMismatching queries: ", num_mismatches, ".");
+}
+
+// Measures @p handler over `-num_ticks` Update() calls, advancing @p timer by a phase on every call.
+TickCost MeasureHandlerUpdates(SimulatedTimer* timer, DynamicEnvironmentHandler* handler) {
+  return MeasureTicks(FLAGS_num_ticks, [&]() {
+    timer->Advance(1.);
+    handler->Update();
+  });
+}
+
+// Advances every phase ring by looking it up in @p phase_ring_book and @p phase_provider.
+void AdvanceByLookup(const ManualPhaseRingBook& phase_ring_book, ManualPhaseProvider* phase_provider) {
+  for (const auto& phase_ring_id : phase_ring_book.GetPhaseRings()) {
+    const auto phase_ring = phase_ring_book.GetPhaseRing(phase_ring_id);
+    const auto phase_provider_result = phase_provider->GetPhase(phase_ring_id);
+    if (!phase_provider_result.has_value() || !phase_provider_result->next.has_value()) {
+      continue;
+    }
+    const auto new_phase_id = phase_provider_result->next.value().state;
+    const auto next_phases = phase_ring->GetNextPhases(new_phase_id);
+    phase_provider->SetPhase(phase_ring_id, new_phase_id, next_phases.front().id, next_phases.front().duration_until);
+  }
+}
+
+void BenchmarkPhaseUpdate() {
+  MALIPUT_VALIDATE(FLAGS_num_phase_rings > 0, "--num_phase_rings must be positive.");
+  MALIPUT_VALIDATE(FLAGS_num_phases > 1, "--num_phases must be at least two.");
+  ManualPhaseRingBook phase_ring_book;
+  ManualPhaseProvider phase_provider;
+  BuildPhaseRings(FLAGS_num_phase_rings, FLAGS_num_phases, &phase_ring_book, &phase_provider);
+  log()->info("Phase rings: ", FLAGS_num_phase_rings, ", phases per ring: ", FLAGS_num_phases,
+              ", ticks: ", FLAGS_num_ticks, ".");
+
+  const TickCost lookup_cost =
+      MeasureTicks(FLAGS_num_ticks, [&]() { AdvanceByLookup(phase_ring_book, &phase_provider); });
+  log()->info("\tLookup: ", lookup_cost.duration * 1e6, " us/tick, ", lookup_cost.allocations, " allocations/tick.");
+
+  PhaseRingTable phase_ring_table(&phase_ring_book, &phase_provider);
+  const TickCost table_cost = MeasureTicks(FLAGS_num_ticks, [&]() {
+    for (int i = 0; i < phase_ring_table.num_phase_rings(); ++i) {
+      phase_ring_table.Advance(i, &phase_provider);
+    }
+  });
+  log()->info("\tPhaseRingTable: ", table_cost.duration * 1e6, " us/tick, ", table_cost.allocations,
+              " allocations/tick.");
+
+  // Every handler updates the phases of its own road network.
+  {
+    const std::unique_ptr<api::RoadNetwork> road_network = BuildRoadNetwork(FLAGS_num_phase_rings, FLAGS_num_phases);
+    SimulatedTimer timer;
+    FixedPhaseIterationHandler handler(&timer, road_network.get(), 1.);
+    const TickCost cost = MeasureHandlerUpdates(&timer, &handler);
+    log()->info("\tFixedPhaseIterationHandler::Update: ", cost.duration * 1e6, " us/tick, ", cost.allocations,
+                " allocations/tick.");
+  }
+  {
+    const std::unique_ptr<api::RoadNetwork> road_network = BuildRoadNetwork(FLAGS_num_phase_rings, FLAGS_num_phases);
+    SimulatedTimer timer;
+    PhaseDurationIterationHandler handler(&timer, road_network.get(), 1.);
+    const TickCost cost = MeasureHandlerUpdates(&timer, &handler);
+    log()->info("\tPhaseDurationIterationHandler::Update: ", cost.duration * 1e6, " us/tick, ", cost.allocations,
+                " allocations/tick.");
+  }
+}
+
+// Throughput of a contention measurement.
+struct ContentionCost {
+  // Reads per second, adding up all the readers.
+  double reads_per_second{};
+  // Mean duration of a write, in seconds.
+  double write_duration{};
+};
+
+// Runs @p num_readers threads that call `read(i)` with increasing `i` while the calling thread calls `write(i)`
+// every @p write_period seconds, for @p duration seconds.
+template <typename ReadFunction, typename WriteFunction>
+ContentionCost MeasureContention(int num_readers, double duration, double write_period, const ReadFunction& read,
+                                 const WriteFunction& write) {
+  std::atomic<bool> done{false};
+  std::atomic<int64_t> num_reads{0};
+  // Accumulates the results of the reads, so that they can't be optimized away.
+  std::atomic<size_t> checksum{0};
+  std::vector<std::thread> readers;
+  readers.reserve(num_readers);
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  for (int i = 0; i < num_readers; ++i) {
+    readers.emplace_back([&, i]() {
+      int64_t reads{0};
+      size_t sum{0};
+      for (int j = i; !done; ++j, ++reads) {
+        sum += read(j);
+      }
+      num_reads += reads;
+      checksum += sum;
+    });
+  }
+  const std::unique_ptr<Timer> write_timer = CreateTimer(TimerType::kChronoTimer);
+  double write_duration{0.};
+  int num_writes{0};
+  while (timer->Elapsed() < duration) {
+    write_timer->Reset();
+    write(num_writes++);
+    write_duration += write_timer->Elapsed();
+    std::this_thread::sleep_for(std::chrono::duration<double>(write_period));
+  }
+  done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  const double elapsed = timer->Elapsed();
+  log()->trace("Checksum: ", checksum.load());
+  return {static_cast<double>(num_reads) / elapsed, num_writes > 0 ? write_duration / num_writes : 0.};
+}
+
+void BenchmarkSnapshotContention() {
+  MALIPUT_VALIDATE(FLAGS_num_readers > 0, "--num_readers must be positive.");
+  MALIPUT_VALIDATE(FLAGS_num_rules > 0, "--num_rules must be positive.");
+  MALIPUT_VALIDATE(FLAGS_duration > 0., "--duration must be positive.");
+  MALIPUT_VALIDATE(FLAGS_write_period >= 0., "--write_period must be non-negative.");
+  using RuleStates = std::unordered_map<api::rules::Rule::Id, api::rules::DiscreteValueRule::DiscreteValue>;
+  std::vector<api::rules::Rule::Id> rule_ids;
+  RuleStates initial_states;
+  api::rules::DiscreteValueRule::DiscreteValue go;
+  go.value = "Go";
+  api::rules::DiscreteValueRule::DiscreteValue stop;
+  stop.value = "Stop";
+  for (int i = 0; i < FLAGS_num_rules; ++i) {
+    rule_ids.emplace_back("Right-Of-Way Rule Type/Rule_" + std::to_string(i));
+    initial_states.emplace(rule_ids.back(), go);
+  }
+  // @returns The size of the state of the @p i -th rule in @p states, so that lookups can't be optimized away.
+  const auto lookup = [&rule_ids](const RuleStates& states, int i) {
+    return states.at(rule_ids[i % rule_ids.size()]).value.size();
+  };
+  log()->info("Readers: ", FLAGS_num_readers, ", rules: ", FLAGS_num_rules, ", write period: ", FLAGS_write_period,
+              " s.");
+
+  RuleStates mutex_states = initial_states;
+  std::mutex mutex;
+  const ContentionCost mutex_cost = MeasureContention(
+      FLAGS_num_readers, FLAGS_duration, FLAGS_write_period,
+      [&](int i) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return lookup(mutex_states, i);
+      },
+      [&](int i) {
+        std::lock_guard<std::mutex> lock(mutex);
+        mutex_states[rule_ids[i % rule_ids.size()]] = i % 2 == 0 ? stop : go;
+      });
+  log()->info("\tMutex: ", mutex_cost.reads_per_second, " reads/s, ", mutex_cost.write_duration * 1e6,
+              " us/write.");
+
+  LeftRight<RuleStates> left_right_states(initial_states);
+  const ContentionCost left_right_cost = MeasureContention(
+      FLAGS_num_readers, FLAGS_duration, FLAGS_write_period,
+      [&](int i) { return left_right_states.Read([&](const RuleStates& states) { return lookup(states, i); }); },
+      [&](int i) {
+        left_right_states.Modify(
+            [&](RuleStates* states) { (*states)[rule_ids[i % rule_ids.size()]] = i % 2 == 0 ? stop : go; });
+      });
+  log()->info("\tLeftRight: ", left_right_cost.reads_per_second, " reads/s, ", left_right_cost.write_duration * 1e6,
+              " us/write.");
+}
+
+// Cost of reading a timer.
+struct ReadCost {
+  // Mean duration of a reading, in seconds.
+  double duration{};
+  // Smallest non-zero difference between consecutive readings, in seconds, or zero when they never differed.
+  double resolution{};
+};
+
+// Measures @p num_calls consecutive calls to @p read, which returns a time in seconds.
+template <typename ReadFunction>
+ReadCost MeasureReads(int num_calls, const ReadFunction& read) {
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kSteadyTimer);
+  double previous = read();
+  double resolution{0.};
+  timer->Reset();
+  for (int i = 0; i < num_calls; ++i) {
+    const double current = read();
+    const double step = current - previous;
+    if (step > 0. && (resolution == 0. || step < resolution)) {
+      resolution = step;
+    }
+    previous = current;
+  }
+  return {timer->Elapsed() / num_calls, resolution};
+}
+
+void BenchmarkTimerElapsed() {
+  MALIPUT_VALIDATE(FLAGS_num_calls > 0, "--num_calls must be positive.");
+  log()->info("Calls: ", FLAGS_num_calls, ".");
+  const auto log_cost = [](const std::string& name, const ReadCost& cost) {
+    log()->info("\t", name, ": ", cost.duration * 1e9, " ns/call, ", cost.resolution * 1e9, " ns resolution.");
+  };
+
+  // Reading the clock without going through a Timer shows the cost of the virtual call.
+  const auto start = std::chrono::steady_clock::now();
+  log_cost("steady_clock::now", MeasureReads(FLAGS_num_calls, [&start]() {
+             return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+           }));
+
+  std::vector<std::pair<std::string, TimerType>> timer_types{
+      {"ChronoTimer", TimerType::kChronoTimer},
+      {"SteadyTimer", TimerType::kSteadyTimer},
+      {"SimulatedTimer", TimerType::kSimulatedTimer},
+  };
+  if (TscTimer::IsSupported()) {
+    timer_types.emplace_back("TscTimer", TimerType::kTscTimer);
+  } else {
+    log()->info("\tTscTimer: not supported by this processor.");
+  }
+  for (const auto& timer_type : timer_types) {
+    const std::unique_ptr<Timer> timer = CreateTimer(timer_type.second);
+    log_cost(timer_type.first, MeasureReads(FLAGS_num_calls, [&timer]() { return timer->Elapsed(); }));
+  }
+}
+
+// Benchmarks by name.
+const std::map<std::string, std::function<void()>> kBenchmarks{
+    {"lane_rules", BenchmarkLaneRules},
+    {"phase_update", BenchmarkPhaseUpdate},
+    {"snapshot_contention", BenchmarkSnapshotContention},
+    {"timer_elapsed", BenchmarkTimerElapsed},
+};
+
+int Main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  common::set_log_level(FLAGS_log_level);
+
+  const auto benchmark = kBenchmarks.find(FLAGS_benchmark);
+  if (benchmark == kBenchmarks.end()) {
+    log()->error("Unknown benchmark: ", FLAGS_benchmark, ".");
+    return 1;
+  }
+  MALIPUT_VALIDATE(FLAGS_num_ticks > 0, "--num_ticks must be positive.");
+  benchmark->second();
+  return 0;
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
+
+int main(int argc, char* argv[]) { return maliput::integration::Main(argc, argv); }
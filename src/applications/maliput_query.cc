@@ -44,8 +44,14 @@
 ///         -intersection_book_file
 /// 2. The level of the logger could be setted by: -log_level.
 
+#include <algorithm>
 #include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -71,6 +77,9 @@
 #include <maliput_object/base/manual_object_book.h>
 #include <maliput_object/base/simple_object_query.h>
 
+#include "integration/lane_sample_table.h"
+#include "integration/lane_sweep.h"
+#include "integration/parallel_for.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
@@ -241,6 +250,22 @@ const std::map<const std::string, const Command> CommandsUsage() {
         3}},
       {"GetNumberOfLanes",
        {"GetNumberOfLanes", "GetNumberOfLanes", {"Obtains number of lanes in the RoadGeometry."}, 1}},
+      {"MeasureLaneSampleTables",
+       {"MeasureLaneSampleTables",
+        "MeasureLaneSampleTables max_position_error max_orientation_error max_h num_queries_per_lane",
+        {"Builds a LaneSampleTable for every Lane, with the given error bounds in meters and radians",
+         "checked up to an elevation of max_h, and compares num_queries_per_lane random",
+         "ToInertialPosition and GetOrientation queries against the exact Lane queries.",
+         "Reports the number of samples, the errors found and the time spent by both."},
+        5}},
+      {"SweepLanes",
+       {"SweepLanes",
+        "SweepLanes s_step num_threads format output_file",
+        {"Samples the centerline position, orientation, lane, segment and elevation bounds of every",
+         "Lane every s_step meters, with 1, 2, 4, ... up to num_threads worker threads (all the",
+         "hardware threads when it is 0). Reports the samples per second and the speedup of every",
+         "run and writes the samples to output_file with the given format: <csv> or <binary>."},
+        5}},
 
       {"FindOverlappingLanesIn",
        {"FindOverlappingLanesIn",
@@ -858,6 +883,81 @@ class RoadNetworkQuery {
     PrintQueryTime(duration.count());
   }
 
+  /// Measures the accuracy and speed of the LaneSampleTables of every Lane built with @p options.
+  void MeasureLaneSampleTables(const LaneSampleTableOptions& options, int num_queries_per_lane) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    const LaneSampleTableReport report =
+        maliput::integration::MeasureLaneSampleTables(rn_->road_geometry(), options, num_queries_per_lane, 0);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double num_queries = static_cast<double>(std::max<int64_t>(report.num_queries, 1));
+    (*out_) << "MeasureLaneSampleTables(max_position_error: " << options.max_position_error
+            << ", max_orientation_error: " << options.max_orientation_error << ", max_h: " << options.max_h
+            << ", num_queries_per_lane: " << num_queries_per_lane << ")" << std::endl;
+    (*out_) << "              : Lanes: " << report.num_lanes
+            << ", over tolerance: " << report.num_lanes_over_tolerance << std::endl;
+    (*out_) << "              : Samples: " << report.num_s_samples << " s coordinates, " << report.num_bytes
+            << " bytes, built in " << report.build_time << " s" << std::endl;
+    (*out_) << "              : Max error of " << report.num_queries << " random queries: " << report.max_position_error
+            << " m, " << report.max_orientation_error << " rad" << std::endl;
+    (*out_) << "              : Time per query: exact " << report.exact_query_time / num_queries << " s, table "
+            << report.table_query_time / num_queries << " s" << std::endl;
+    const std::chrono::duration<double> duration = (end - start);
+    PrintQueryTime(duration.count());
+  }
+
+  /// Samples every Lane every @p s_step meters with 1, 2, 4, ... up to @p num_threads worker threads, reports the
+  /// speed of every run and writes the samples to @p output_file, in the binary lane sweep format when @p binary is
+  /// true and as CSV otherwise.
+  void SweepLanes(double s_step, int num_threads, bool binary, const std::string& output_file) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    const int max_threads = ResolveNumberOfThreads(num_threads);
+    (*out_) << "SweepLanes(s_step: " << s_step << ", num_threads: " << max_threads
+            << ", format: " << (binary ? "binary" : "csv") << ", output_file: " << output_file << ")" << std::endl;
+    LaneSweepOptions options;
+    options.s_step = s_step;
+    LaneSweep sweep;
+    double sequential_rate{};
+    for (int threads = 1;; threads = std::min(2 * threads, max_threads)) {
+      options.num_threads = threads;
+      LaneSweepReport report;
+      sweep = maliput::integration::SweepLanes(rn_->road_geometry(), options, &report);
+      const double rate = static_cast<double>(report.num_samples) / std::max(report.sampling_time, 1e-9);
+      if (threads == 1) {
+        sequential_rate = rate;
+      }
+      (*out_) << "              : " << threads << " threads: " << report.num_samples << " samples of "
+              << report.num_lanes << " lanes in " << report.sampling_time << " s, " << rate
+              << " samples/s, speedup: " << rate / sequential_rate << std::endl;
+      if (threads == max_threads) {
+        break;
+      }
+    }
+
+    const auto write_start = std::chrono::high_resolution_clock::now();
+    std::ofstream file(output_file, std::ios::binary);
+    if (!file.is_open()) {
+      maliput::log()->error("Could not open output file: ", output_file);
+      return;
+    }
+    if (binary) {
+      WriteLaneSweepBinary(sweep, &file);
+    } else {
+      WriteLaneSweepCsv(sweep, &file);
+    }
+    const std::streamoff num_bytes = file.tellp();
+    file.close();
+    if (!file) {
+      maliput::log()->error("Could not write output file: ", output_file);
+      return;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> write_duration = (end - write_start);
+    (*out_) << "              : Wrote " << num_bytes << " bytes in " << write_duration.count() << " s" << std::endl;
+    const std::chrono::duration<double> duration = (end - start);
+    PrintQueryTime(duration.count());
+  }
+
   /// Gets all the Lanes (according to the overlapping type) in respect to a BoundingRegion
   void FindOverlappingLanesIn(const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr,
                               const maliput::math::OverlappingType overlapping_type) {
@@ -1149,6 +1249,35 @@ bool BoolFromCLI(char** argv) {
   MALIPUT_THROW_MESSAGE("Cannot convert token into bool, try with true or false.");
 }
 
+/// @return The number represented by `*argv`, or std::nullopt when `*argv` is not entirely a number.
+/// @pre `argv` is not nullptr.
+/// @throws maliput::common::assertion_error When preconditions are not met.
+std::optional<double> DoubleFromCLI(char** argv) {
+  MALIPUT_THROW_UNLESS(argv != nullptr);
+  char* end{};
+  const double value = std::strtod(argv[0], &end);
+  if (end == argv[0] || *end != '\0') {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// @return The integer represented by `*argv`, or std::nullopt when `*argv` is not entirely an integer or doesn't
+///         fit in an int.
+/// @pre `argv` is not nullptr.
+/// @throws maliput::common::assertion_error When preconditions are not met.
+std::optional<int> IntFromCLI(char** argv) {
+  MALIPUT_THROW_UNLESS(argv != nullptr);
+  char* end{};
+  errno = 0;
+  const long value = std::strtol(argv[0], &end, 10);
+  if (end == argv[0] || *end != '\0' || errno == ERANGE || value < std::numeric_limits<int>::min() ||
+      value > std::numeric_limits<int>::max()) {
+    return std::nullopt;
+  }
+  return static_cast<int>(value);
+}
+
 /// @return A maliput::routing::RoutingConstraints represented by @p argv.
 /// @p It must point to at least 3 different char sequences.
 /// @pre `argv` is not nullptr.
@@ -1293,6 +1422,37 @@ int Main(int argc, char* argv[]) {
     query.GetLaneLength(lane_id);
   } else if (command.name.compare("GetNumberOfLanes") == 0) {
     query.GetNumberOfLanes();
+  } else if (command.name.compare("MeasureLaneSampleTables") == 0) {
+    const std::optional<double> max_position_error = DoubleFromCLI(&(argv[2]));
+    const std::optional<double> max_orientation_error = DoubleFromCLI(&(argv[3]));
+    const std::optional<double> max_h = DoubleFromCLI(&(argv[4]));
+    const std::optional<int> num_queries_per_lane = IntFromCLI(&(argv[5]));
+    // The error bounds and the number of queries must be positive and the height must not be negative.
+    if (!max_position_error.has_value() || !(*max_position_error > 0.) || !max_orientation_error.has_value() ||
+        !(*max_orientation_error > 0.) || !max_h.has_value() || !(*max_h >= 0.) || !num_queries_per_lane.has_value() ||
+        *num_queries_per_lane <= 0) {
+      maliput::log()->error("Invalid arguments for command: ", command.usage,
+                            "\nRun 'maliput_query --help' for help.\n");
+      return 1;
+    }
+    LaneSampleTableOptions options;
+    options.max_position_error = *max_position_error;
+    options.max_orientation_error = *max_orientation_error;
+    options.max_h = *max_h;
+
+    query.MeasureLaneSampleTables(options, *num_queries_per_lane);
+
+  } else if (command.name.compare("SweepLanes") == 0) {
+    const double s_step = std::strtod(argv[2], nullptr);
+    const int num_threads = std::atoi(argv[3]);
+    const std::string format = argv[4];
+    if (format != "csv" && format != "binary") {
+      maliput::log()->error("Invalid format: ", format, "\nRun 'maliput_query --help' for help.\n");
+      return 1;
+    }
+    const std::string output_file = argv[5];
+
+    query.SweepLanes(s_step, num_threads, format == "binary", output_file);
 
   } else if (command.name.compare("FindOverlappingLanesIn") == 0) {
     const maliput::math::OverlappingType overlapping_type = OverlappingTypeFromCLI(&(argv[2]));
@@ -46,18 +46,49 @@
 ///      -obj_dir, -obj_file, -max_grid_unit, -min_grid_resolution, -draw_elevation_bounds, -simplify_mesh_threshold
 /// 3. An urdf file can also be created by passing -urdf flag.
 /// 4. The level of the logger could be setted by: -log_level.
+/// 5. The OBJ file can be meshed concurrently by passing -num_workers. The road geometry is split into pieces of
+///    contiguous junctions that are meshed by different threads and merged afterwards. Timings of every stage and the
+///    meshing throughput are logged. It does not apply to URDF file creation.
+/// 6. A tiled export is enabled by passing -tile_size. The map is partitioned into a grid of square tiles and every
+///    tile is written once per level of detail, see -lod_max_grid_units and -lod_simplify_mesh_thresholds, along with
+///    an index file that lists the bounds and files of every tile.
+/// 7. The mesh can be written as binary glTF (.glb) or binary PLY instead of OBJ by passing -mesh_format. When
+///    -compare_with_obj is passed, the OBJ file is written as well and the size and write time of both are logged.
+///    Neither flag applies to -urdf nor -tile_size, which always write OBJ files, and combining them is an error.
+///    The mesh is still generated through scratch OBJ files, which are parsed back before the binary file is written.
+/// 8. Incremental regeneration is enabled by passing -mesh_cache_dir. Segments are meshed one by one and cached in
+///    that directory keyed by a hash of their geometry and the mesh settings, so later runs only re-mesh the segments
+///    that changed. The geometry is hashed from lane samples taken every -mesh_cache_sampling_step meters, so changes
+///    between samples go unnoticed. -mesh_cache_max_entries bounds the number of cached meshes.
+/// 9. Adaptive meshing is enabled by passing -adaptive_max_error and/or -adaptive_triangle_budget. Every segment is
+///    meshed with a grid unit chosen from its measured curvature and elevation variation, bounded by
+///    -adaptive_min_grid_unit and -adaptive_max_grid_unit. The grid unit applies to every lane of the segment.
+/// 10. -urdf, -tile_size, -mesh_cache_dir and adaptive meshing select different exports, so at most one of them may
+///     be passed. The flags that only configure one of them, e.g. -lod_max_grid_units, -mesh_cache_max_entries or
+///     -adaptive_min_grid_unit, are rejected when their export is not selected.
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <limits>
+#include <map>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <gflags/gflags.h>
 #include <maliput/common/filesystem.h>
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_abort.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/utility/generate_obj.h>
 #include <maliput/utility/generate_urdf.h>
 #include <yaml-cpp/yaml.h>
 
+#include "integration/adaptive_mesh.h"
+#include "integration/generate_mesh.h"
+#include "integration/mesh_cache.h"
+#include "integration/tiled_mesh.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
@@ -99,16 +130,142 @@ DEFINE_bool(draw_stripes, maliput::utility::ObjFeatures().draw_stripes,
 DEFINE_bool(draw_lane_haze, maliput::utility::ObjFeatures().draw_lane_haze,
             "Whether to draw the highlighting swath with boundaries of each lane");
 
+// Gflag for concurrent OBJ generation.
+DEFINE_int32(num_workers, 1,
+             "Number of threads used to mesh the road geometry. When it is 0 the number of hardware threads is used. "
+             "When it is 1 the road geometry is meshed at once by maliput::utility::GenerateObjFile().");
+
+// Gflags for the mesh file format.
+DEFINE_string(mesh_format, "obj", "Format of the mesh file: <obj>, <glb> (binary glTF 2.0) or <ply> (binary PLY).");
+DEFINE_bool(compare_with_obj, false,
+            "When --mesh_format is not obj, also write the OBJ file and log the size and write time of both.");
+
+// Gflag for incremental mesh generation.
+DEFINE_string(mesh_cache_dir, "",
+              "Directory that caches the mesh of every segment. When set, only the segments whose geometry or mesh "
+              "settings changed since a previous run are re-meshed.");
+DEFINE_double(mesh_cache_sampling_step, 0.,
+              "Longitudinal distance between the lane samples that identify the geometry of a cached segment, in "
+              "meters. Geometry changes between samples go unnoticed. When non-positive, half of -max_grid_unit.");
+DEFINE_int32(mesh_cache_max_entries, 0,
+             "Maximum number of segment meshes kept in -mesh_cache_dir. When positive, the least recently used ones "
+             "are deleted.");
+
+// Gflags for adaptive mesh generation.
+DEFINE_double(adaptive_max_error, 0.,
+              "Maximum distance between the mesh and the road surface, in meters. When positive, every segment is "
+              "meshed with a grid unit adapted to its curvature and elevation variation.");
+DEFINE_int64(adaptive_triangle_budget, 0,
+             "Target number of road surface triangles. When positive, segments are meshed adaptively with the "
+             "finest grid that fits the budget.");
+DEFINE_double(adaptive_min_grid_unit, maliput::integration::AdaptiveMeshOptions().min_grid_unit,
+              "Smallest grid unit of the adaptive meshing, in meters.");
+DEFINE_double(adaptive_max_grid_unit, maliput::integration::AdaptiveMeshOptions().max_grid_unit,
+              "Largest grid unit of the adaptive meshing, in meters.");
+
+// Gflags for tiled OBJ generation.
+DEFINE_double(tile_size, 0.,
+              "Side of the square tiles, in meters. When positive, the map is exported as a grid of tiles with "
+              "several levels of detail instead of a single OBJ file.");
+DEFINE_string(lod_max_grid_units, "",
+              "Comma-separated max_grid_unit of each level of detail of the tiled export, e.g. \"1,4,16\". When "
+              "empty, --max_grid_unit is used.");
+DEFINE_string(lod_simplify_mesh_thresholds, "",
+              "Comma-separated simplify_mesh_threshold of each level of detail of the tiled export, e.g. "
+              "\"0,0.05,0.2\". When empty, --simplify_mesh_threshold is used.");
+
 namespace maliput {
 namespace integration {
 namespace {
 
+// Holds the conversions from std::string to MeshFormat.
+const std::map<std::string, MeshFormat> string_to_mesh_format{
+    {"obj", MeshFormat::kObj},
+    {"glb", MeshFormat::kGlb},
+    {"ply", MeshFormat::kPly},
+};
+
+// Logs the size and write time of a mesh file.
+void LogMeshWriteReport(const MeshWriteReport& report) {
+  log()->info("Written ", report.file_path, ": ", report.file_size, " bytes in ", report.write_time, " s.");
+}
+
+// Parses the comma-separated list of numbers @p list given to the @p flag_name flag.
+std::vector<double> ParseDoubleList(const std::string& flag_name, const std::string& list) {
+  std::vector<double> values;
+  std::stringstream ss(list);
+  std::string value;
+  while (std::getline(ss, value, ',')) {
+    char* end{nullptr};
+    errno = 0;
+    const double number = std::strtod(value.c_str(), &end);
+    const size_t num_parsed = static_cast<size_t>(end - value.c_str());
+    const bool is_number = num_parsed > 0 && value.find_first_not_of(" \t", num_parsed) == std::string::npos;
+    MALIPUT_VALIDATE(is_number && errno != ERANGE, "Invalid number \"" + value + "\" in --" + flag_name + ": " + list);
+    values.push_back(number);
+  }
+  return values;
+}
+
+// Builds the levels of detail of the tiled export from the --lod_* flags.
+std::vector<LevelOfDetail> GetLevelsOfDetail() {
+  std::vector<double> max_grid_units = ParseDoubleList("lod_max_grid_units", FLAGS_lod_max_grid_units);
+  std::vector<double> simplify_mesh_thresholds =
+      ParseDoubleList("lod_simplify_mesh_thresholds", FLAGS_lod_simplify_mesh_thresholds);
+  if (max_grid_units.empty()) {
+    max_grid_units.resize(std::max<size_t>(1, simplify_mesh_thresholds.size()), FLAGS_max_grid_unit);
+  }
+  if (simplify_mesh_thresholds.empty()) {
+    simplify_mesh_thresholds.resize(max_grid_units.size(), FLAGS_simplify_mesh_threshold);
+  }
+  MALIPUT_VALIDATE(max_grid_units.size() == simplify_mesh_thresholds.size(),
+                   "--lod_max_grid_units and --lod_simplify_mesh_thresholds must have the same number of values.");
+  std::vector<LevelOfDetail> levels_of_detail;
+  for (size_t i = 0; i < max_grid_units.size(); ++i) {
+    levels_of_detail.push_back({max_grid_units[i], simplify_mesh_thresholds[i]});
+  }
+  return levels_of_detail;
+}
+
+// @returns Whether adaptive meshing was requested.
+bool IsAdaptive() { return FLAGS_adaptive_max_error > 0. || FLAGS_adaptive_triangle_budget > 0; }
+
+// @returns Whether the @p flag_name flag was passed.
+bool IsSet(const char* flag_name) { return !gflags::GetCommandLineFlagInfoOrDie(flag_name).is_default; }
+
+// Rejects the combinations of flags that can't be honored together, so that no flag is silently ignored.
+void ValidateFlagCombinations(MeshFormat mesh_format) {
+  const int num_exports = static_cast<int>(FLAGS_urdf) + static_cast<int>(FLAGS_tile_size > 0.) +
+                          static_cast<int>(!FLAGS_mesh_cache_dir.empty()) + static_cast<int>(IsAdaptive());
+  MALIPUT_VALIDATE(num_exports <= 1,
+                   "--urdf, --tile_size, --mesh_cache_dir and --adaptive_max_error or --adaptive_triangle_budget "
+                   "select different exports and can't be combined.");
+  const bool writes_only_obj = FLAGS_urdf || FLAGS_tile_size > 0.;
+  MALIPUT_VALIDATE(!writes_only_obj || (mesh_format == MeshFormat::kObj && !FLAGS_compare_with_obj),
+                   "--mesh_format and --compare_with_obj don't apply to --urdf and --tile_size, which write OBJ.");
+  const bool has_levels_of_detail = !FLAGS_lod_max_grid_units.empty() || !FLAGS_lod_simplify_mesh_thresholds.empty();
+  MALIPUT_VALIDATE(FLAGS_tile_size > 0. || !has_levels_of_detail,
+                   "--lod_max_grid_units and --lod_simplify_mesh_thresholds require --tile_size.");
+  const bool has_cache_settings = IsSet("mesh_cache_sampling_step") || IsSet("mesh_cache_max_entries");
+  MALIPUT_VALIDATE(!FLAGS_mesh_cache_dir.empty() || !has_cache_settings,
+                   "--mesh_cache_sampling_step and --mesh_cache_max_entries require --mesh_cache_dir.");
+  const bool has_adaptive_settings = IsSet("adaptive_min_grid_unit") || IsSet("adaptive_max_grid_unit");
+  MALIPUT_VALIDATE(IsAdaptive() || !has_adaptive_settings,
+                   "--adaptive_min_grid_unit and --adaptive_max_grid_unit require --adaptive_max_error or "
+                   "--adaptive_triangle_budget.");
+}
+
 // Generates an OBJ file from a YAML file path or from
 // configurable values given as CLI arguments.
 int Main(int argc, char* argv[]) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
   common::set_log_level(FLAGS_log_level);
 
+  const auto mesh_format_it = string_to_mesh_format.find(FLAGS_mesh_format);
+  MALIPUT_VALIDATE(mesh_format_it != string_to_mesh_format.end(), "Unknown mesh format: " + FLAGS_mesh_format);
+  const MeshFormat mesh_format = mesh_format_it->second;
+  ValidateFlagCombinations(mesh_format);
+
   log()->info("Loading road network using ", FLAGS_maliput_backend, " backend implementation...");
   const MaliputImplementation maliput_implementation{StringToMaliputImplementation(FLAGS_maliput_backend)};
   auto rn = LoadRoadNetwork(
@@ -146,9 +303,84 @@ int Main(int argc, char* argv[]) {
   FLAGS_dirpath == "." ? log()->info("OBJ", urdf, " files location: ", my_path.get_path(), ".")
                        : log()->info("OBJ", urdf, " files location: ", FLAGS_dirpath, ".");
 
+  const bool adaptive = IsAdaptive();
+
   log()->info("Generating OBJ", urdf, " ...");
-  FLAGS_urdf ? GenerateUrdfFile(rn->road_geometry(), FLAGS_dirpath, FLAGS_file_name_root, features)
-             : GenerateObjFile(rn->road_geometry(), FLAGS_dirpath, FLAGS_file_name_root, features);
+  if (FLAGS_urdf) {
+    GenerateUrdfFile(rn->road_geometry(), FLAGS_dirpath, FLAGS_file_name_root, features);
+  } else if (FLAGS_tile_size > 0.) {
+    TiledMeshOptions options;
+    options.tile_size = FLAGS_tile_size;
+    options.levels_of_detail = GetLevelsOfDetail();
+    options.generation.num_threads = FLAGS_num_workers;
+    options.generation.scratch_dirpath = FLAGS_dirpath;
+    const TiledMeshIndex index =
+        GenerateTiledObjFiles(rn->road_geometry(), FLAGS_dirpath, FLAGS_file_name_root, features, options);
+    log()->info("Written ", index.tiles.size(), " tiles with ", index.levels_of_detail.size(),
+                " levels of detail. Index file: ", FLAGS_file_name_root, "_tiles.yaml.");
+  } else if (mesh_format != MeshFormat::kObj || !FLAGS_mesh_cache_dir.empty() || adaptive) {
+    RoadMesh road_mesh;
+    if (adaptive) {
+      AdaptiveMeshOptions options;
+      options.max_error = FLAGS_adaptive_max_error;
+      options.triangle_budget = FLAGS_adaptive_triangle_budget;
+      options.min_grid_unit = FLAGS_adaptive_min_grid_unit;
+      options.max_grid_unit = FLAGS_adaptive_max_grid_unit;
+      options.num_threads = FLAGS_num_workers;
+      options.scratch_dirpath = FLAGS_dirpath;
+      AdaptiveMeshReport report;
+      road_mesh = GenerateRoadMeshAdaptively(rn->road_geometry(), features, options, &report);
+      log()->info("Meshed ", report.num_segments, " segments for a maximum error of ", report.max_error,
+                  " m with grid units in [", report.min_grid_unit, ", ", report.max_grid_unit, "] m.");
+      log()->info("Measuring time: ", report.measuring_time, " s, meshing time: ", report.meshing_time,
+                  " s, merging time: ", report.merging_time, " s. Triangles: ", report.num_triangles,
+                  " (road surface estimation: ", report.estimated_triangles, ").");
+    } else if (!FLAGS_mesh_cache_dir.empty()) {
+      common::Path cache_directory(FLAGS_mesh_cache_dir);
+      if (!cache_directory.exists()) {
+        common::Filesystem::create_directory_recursive(cache_directory);
+      }
+      IncrementalMeshOptions options;
+      options.cache_dirpath = FLAGS_mesh_cache_dir;
+      options.scratch_dirpath = FLAGS_dirpath;
+      options.num_threads = FLAGS_num_workers;
+      options.sampling_step = FLAGS_mesh_cache_sampling_step;
+      options.max_cache_entries = FLAGS_mesh_cache_max_entries;
+      IncrementalMeshReport report;
+      road_mesh = GenerateRoadMeshIncrementally(rn->road_geometry(), features, options, &report);
+      log()->info("Re-meshed ", report.num_units - report.num_cache_hits, " out of ", report.num_units,
+                  " units, the rest were cached. Evicted ", report.num_evictions, " cached meshes.");
+      log()->info("Hashing time: ", report.hashing_time, " s, meshing time: ", report.meshing_time,
+                  " s, merging time: ", report.merging_time, " s. Triangles: ", report.num_triangles, ".");
+    } else {
+      MeshGenerationOptions options;
+      options.num_threads = FLAGS_num_workers;
+      options.scratch_dirpath = FLAGS_dirpath;
+      MeshGenerationReport report;
+      road_mesh = GenerateRoadMesh(rn->road_geometry(), features, options, &report);
+      log()->info("Meshing time: ", report.meshing_time, " s, parsing time: ", report.parsing_time,
+                  " s, merging time: ", report.merging_time, " s. Triangles: ", report.num_triangles, ".");
+    }
+    const MeshWriteReport write_report = WriteRoadMesh(road_mesh, FLAGS_dirpath, FLAGS_file_name_root, mesh_format);
+    LogMeshWriteReport(write_report);
+    if (FLAGS_compare_with_obj && mesh_format != MeshFormat::kObj) {
+      const MeshWriteReport obj_report =
+          WriteRoadMesh(road_mesh, FLAGS_dirpath, FLAGS_file_name_root, MeshFormat::kObj);
+      LogMeshWriteReport(obj_report);
+      log()->info(FLAGS_mesh_format, " vs obj: ",
+                  static_cast<double>(write_report.file_size) / static_cast<double>(obj_report.file_size),
+                  " times the size, ", write_report.write_time, " s vs ", obj_report.write_time, " s.");
+    }
+  } else if (FLAGS_num_workers == 1) {
+    GenerateObjFile(rn->road_geometry(), FLAGS_dirpath, FLAGS_file_name_root, features);
+  } else {
+    const MeshGenerationReport report = GenerateObjFileInParallel(rn->road_geometry(), FLAGS_dirpath,
+                                                                  FLAGS_file_name_root, features, FLAGS_num_workers);
+    log()->info("Meshed ", report.num_chunks, " pieces using ", report.num_threads, " threads.");
+    log()->info("Meshing time: ", report.meshing_time, " s, parsing time: ", report.parsing_time,
+                " s, merging time: ", report.merging_time, " s, writing time: ", report.writing_time, " s.");
+    log()->info("Triangles: ", report.num_triangles, " (", report.triangles_per_second(), " triangles/s).");
+  }
   log()->info("OBJ", urdf, " creation has finished.");
 
   return 0;
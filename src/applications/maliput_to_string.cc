@@ -45,16 +45,31 @@
 ///      -include_type_labels, -include_road_geometry_id, -include_junction_ids,
 ///      -include_segment_ids, -include_lane_ids, -include_lane_details.
 ///   3. The level of the logger is selected with `-log_level`.
+///   4. The description is streamed to the standard output one junction at a time. Junctions are formatted by
+///      `-num_workers` threads, so the memory in use is proportional to a few junctions rather than to the whole map.
+///   5. `-check_invariants` verifies the maliput invariants with api::RoadGeometry::CheckInvariants(). Passing
+///      `-parallel_invariants` as well checks the segments with `-num_workers` threads instead (see
+///      integration::CheckInvariantsInParallel()) and logs violations as they are found. That check covers a subset of
+///      the maliput invariants and stops after `-max_violations` violations.
+///   6. `-topology_file` and `-topology_json_file` export the junction, segment, lane and branch point topology in a
+///      compact binary format (see integration::TopologyView) and as JSON, respectively. When any of them is passed,
+///      the text description is not printed.
 
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gflags/gflags.h>
 #include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/utility/generate_string.h>
 
+#include "integration/check_invariants.h"
+#include "integration/generate_string.h"
 #include "integration/tools.h"
+#include "integration/topology.h"
 #include "maliput_gflags.h"
 
 COMMON_PROPERTIES_FLAGS();
@@ -67,6 +82,12 @@ MALIPUT_APPLICATION_DEFINE_LOG_LEVEL_FLAG();
 DEFINE_string(maliput_backend, "malidrive",
               "Whether to use <dragway>, <multilane> or <malidrive>. Default is malidrive.");
 DEFINE_bool(check_invariants, false, "Whether to enable maliput invariants verification.");
+DEFINE_bool(parallel_invariants, false,
+            "Whether to check the invariants of every segment concurrently with -num_workers threads. It covers a "
+            "subset of the maliput invariants.");
+DEFINE_int32(max_violations, 0,
+             "Number of invariant violations after which the -parallel_invariants verification stops. Use 0 to report "
+             "all of them.");
 // Gflags to select options for serialization.
 DEFINE_bool(include_type_labels, false, "Whether to include type labels in the output string");
 DEFINE_bool(include_road_geometry_id, false, "Whether to include road geometry IDs in the output string");
@@ -74,6 +95,11 @@ DEFINE_bool(include_junction_ids, false, "Whether to include junction IDs in the
 DEFINE_bool(include_segment_ids, false, "Whether to include segment IDs in the output string");
 DEFINE_bool(include_lane_ids, false, "Whether to include lane IDs in the output string");
 DEFINE_bool(include_lane_details, false, "Whether to include lane details in the output string");
+// Gflags to export the topology.
+DEFINE_string(topology_file, "", "Path of the binary topology file to write. Empty to skip it.");
+DEFINE_string(topology_json_file, "", "Path of the JSON topology file to write. Empty to skip it.");
+DEFINE_int32(num_workers, 1,
+             "Number of threads that format junctions concurrently. Use 0 to match the hardware concurrency.");
 
 namespace maliput {
 namespace integration {
@@ -96,7 +122,7 @@ int Main(int argc, char* argv[]) {
        maliput::math::Vector2::FromStr(FLAGS_origin), FLAGS_rule_registry_file, FLAGS_road_rule_book_file,
        FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file, FLAGS_intersection_book_file});
   log()->info("RoadNetwork loaded successfully.");
-  if (FLAGS_check_invariants) {
+  if (FLAGS_check_invariants && !FLAGS_parallel_invariants) {
     log()->info("Checking invariants...");
     const auto violations = rn->road_geometry()->CheckInvariants();
     violations.empty() ? log()->info("No invariant violations were found.")
@@ -104,14 +130,57 @@ int Main(int argc, char* argv[]) {
     for (const auto& v : violations) {
       log()->warn(v);
     }
+  } else if (FLAGS_check_invariants) {
+    log()->info("Checking segment invariants concurrently...");
+    InvariantCheckOptions check_options;
+    check_options.num_threads = FLAGS_num_workers;
+    check_options.max_violations = FLAGS_max_violations;
+    int last_decile{0};
+    const InvariantCheckReport check_report = CheckInvariantsInParallel(
+        rn->road_geometry(), check_options, [](const std::string& violation) { log()->warn(violation); },
+        [&last_decile](int num_checked, int num_segments) {
+          const int decile = 10 * num_checked / num_segments;
+          if (decile > last_decile) {
+            last_decile = decile;
+            log()->debug("Checked ", num_checked, " of ", num_segments, " segments.");
+          }
+        });
+    check_report.num_violations == 0
+        ? log()->info("No invariant violations were found.")
+        : log()->warn(check_report.num_violations, " invariant violations were found",
+                      check_report.aborted ? ", stopped at -max_violations." : ".");
+    log()->info("Checked ", check_report.num_checked_segments, " of ", check_report.num_segments, " segments using ",
+                check_report.num_threads, " threads in ", check_report.checking_time, " s.");
+  }
+
+  if (!FLAGS_topology_file.empty() || !FLAGS_topology_json_file.empty()) {
+    const std::vector<char> topology = SerializeTopology(rn->road_geometry());
+    if (!FLAGS_topology_file.empty()) {
+      WriteTopologyFile(topology, FLAGS_topology_file);
+      log()->info("Wrote ", topology.size(), " bytes of topology to ", FLAGS_topology_file, ".");
+    }
+    if (!FLAGS_topology_json_file.empty()) {
+      std::ofstream json_file(FLAGS_topology_json_file);
+      MALIPUT_VALIDATE(json_file.is_open(), "Could not open topology file: " + FLAGS_topology_json_file);
+      WriteTopologyJson(TopologyView(topology.data(), topology.size()), &json_file);
+      MALIPUT_VALIDATE(static_cast<bool>(json_file), "Could not write topology file: " + FLAGS_topology_json_file);
+      json_file.close();
+      MALIPUT_VALIDATE(!json_file.fail(), "Could not write topology file: " + FLAGS_topology_json_file);
+      log()->info("Wrote the JSON topology to ", FLAGS_topology_json_file, ".");
+    }
+    return 0;
   }
 
   const maliput::utility::GenerateStringOptions options{FLAGS_include_type_labels,  FLAGS_include_road_geometry_id,
                                                         FLAGS_include_junction_ids, FLAGS_include_segment_ids,
                                                         FLAGS_include_lane_ids,     FLAGS_include_lane_details};
-  const std::string result = maliput::utility::GenerateString(*(rn->road_geometry()), options);
-
-  std::cout << result << std::endl;
+  StringGenerationOptions generation_options;
+  generation_options.num_threads = FLAGS_num_workers;
+  const StringGenerationReport report =
+      GenerateStringToStream(rn->road_geometry(), options, generation_options, &std::cout);
+  std::cout << std::endl;
+  log()->info("Wrote ", report.num_characters, " characters in ", report.num_chunks, " chunks using ",
+              report.num_threads, " threads in ", report.generation_time, " s.");
   return 0;
 }
 
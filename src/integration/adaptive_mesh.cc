@@ -0,0 +1,236 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/adaptive_mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+#include "integration/road_geometry_view.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Bounds and number of iterations of the bisection that fits the triangle budget, in meters.
+constexpr double kMinSearchError{1e-6};
+constexpr double kMaxSearchError{1e3};
+constexpr int kSearchIterations{60};
+
+// Updates @p complexity with the curvatures measured on the polyline @p points, which are sampled along a lane.
+void MeasureCurve(const std::vector<maliput::math::Vector3>& points, SegmentComplexity* complexity) {
+  for (size_t i = 1; i + 1 < points.size(); ++i) {
+    const maliput::math::Vector3& p0 = points[i - 1];
+    const maliput::math::Vector3& p1 = points[i];
+    const maliput::math::Vector3& p2 = points[i + 1];
+    // Menger curvature of the XY projection: four times the triangle area over the product of its sides.
+    const double ax = p1.x() - p0.x();
+    const double ay = p1.y() - p0.y();
+    const double bx = p2.x() - p1.x();
+    const double by = p2.y() - p1.y();
+    const double d01 = std::hypot(ax, ay);
+    const double d12 = std::hypot(bx, by);
+    const double d02 = std::hypot(p2.x() - p0.x(), p2.y() - p0.y());
+    if (d01 <= 0. || d12 <= 0. || d02 <= 0.) {
+      continue;
+    }
+    complexity->max_curvature =
+        std::max(complexity->max_curvature, 2. * std::abs(ax * by - ay * bx) / (d01 * d12 * d02));
+    // Second derivative of the elevation with respect to the horizontal distance.
+    const double z_second_derivative = 2. * ((p2.z() - p1.z()) / d12 - (p1.z() - p0.z()) / d01) / (d01 + d12);
+    complexity->max_vertical_curvature = std::max(complexity->max_vertical_curvature, std::abs(z_second_derivative));
+  }
+}
+
+// @returns The largest grid unit whose chords deviate at most @p max_error from an arc of @p curvature.
+double ChordLengthForError(double curvature, double max_error) {
+  return curvature > 0. ? std::sqrt(8. * max_error / curvature) : std::numeric_limits<double>::infinity();
+}
+
+// @returns The estimated triangles of every segment when meshed for @p max_error.
+int64_t EstimateTotalTriangles(const std::vector<SegmentComplexity>& complexities, double max_error,
+                               const AdaptiveMeshOptions& options) {
+  int64_t total{0};
+  for (const SegmentComplexity& complexity : complexities) {
+    total += EstimateTriangles(
+        complexity, GridUnitForError(complexity, max_error, options.min_grid_unit, options.max_grid_unit),
+        options.min_grid_resolution);
+  }
+  return total;
+}
+
+// @returns The maximum error the segments must be meshed for to satisfy @p options.
+double ResolveMaxError(const std::vector<SegmentComplexity>& complexities, const AdaptiveMeshOptions& options) {
+  if (options.triangle_budget <= 0) {
+    return options.max_error;
+  }
+  // Estimated triangles decrease as the error grows, so the smallest error within budget is bisected in log space.
+  double low = kMinSearchError;
+  double high = kMaxSearchError;
+  if (EstimateTotalTriangles(complexities, low, options) > options.triangle_budget) {
+    for (int i = 0; i < kSearchIterations; ++i) {
+      const double middle = std::sqrt(low * high);
+      (EstimateTotalTriangles(complexities, middle, options) > options.triangle_budget ? low : high) = middle;
+    }
+  } else {
+    high = low;
+  }
+  // A finer mesh than needed for the maximum error is not produced.
+  return std::max(high, options.max_error);
+}
+
+}  // namespace
+
+SegmentComplexity MeasureSegment(const api::Segment* segment, double sampling_step) {
+  MALIPUT_THROW_UNLESS(segment != nullptr);
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  SegmentComplexity complexity;
+  for (int i = 0; i < segment->num_lanes(); ++i) {
+    const api::Lane* lane = segment->lane(i);
+    const double length = lane->length();
+    const int num_samples = std::max(3, static_cast<int>(std::ceil(length / sampling_step)) + 1);
+    std::vector<maliput::math::Vector3> centerline;
+    std::vector<maliput::math::Vector3> left_boundary;
+    std::vector<maliput::math::Vector3> right_boundary;
+    double width{0.};
+    for (int j = 0; j < num_samples; ++j) {
+      const double s = length * j / (num_samples - 1);
+      const api::RBounds lane_bounds = lane->lane_bounds(s);
+      const api::RBounds segment_bounds = lane->segment_bounds(s);
+      width = std::max(width, lane_bounds.max() - lane_bounds.min());
+      centerline.push_back(lane->ToInertialPosition({s, 0., 0.}).xyz());
+      right_boundary.push_back(lane->ToInertialPosition({s, segment_bounds.min(), 0.}).xyz());
+      left_boundary.push_back(lane->ToInertialPosition({s, segment_bounds.max(), 0.}).xyz());
+    }
+    MeasureCurve(centerline, &complexity);
+    MeasureCurve(right_boundary, &complexity);
+    MeasureCurve(left_boundary, &complexity);
+    complexity.lane_sizes.emplace_back(length, width);
+  }
+  return complexity;
+}
+
+double GridUnitForError(const SegmentComplexity& complexity, double max_error, double min_grid_unit,
+                        double max_grid_unit) {
+  const double grid_unit = std::min(ChordLengthForError(complexity.max_curvature, max_error),
+                                    ChordLengthForError(complexity.max_vertical_curvature, max_error));
+  return std::clamp(grid_unit, min_grid_unit, max_grid_unit);
+}
+
+int64_t EstimateTriangles(const SegmentComplexity& complexity, double grid_unit, double min_grid_resolution) {
+  int64_t triangles{0};
+  for (const auto& lane_size : complexity.lane_sizes) {
+    const double length = lane_size.first;
+    const double width = lane_size.second;
+    const double unit = std::min(grid_unit, std::min(length, width) / std::max(1., min_grid_resolution));
+    if (unit <= 0.) {
+      continue;
+    }
+    triangles += 2 * static_cast<int64_t>(std::ceil(length / unit)) * static_cast<int64_t>(std::ceil(width / unit));
+  }
+  return triangles;
+}
+
+RoadMesh GenerateRoadMeshAdaptively(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                                    const AdaptiveMeshOptions& options, AdaptiveMeshReport* report) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(options.max_error > 0. || options.triangle_budget > 0);
+  MALIPUT_THROW_UNLESS(options.min_grid_unit > 0. && options.min_grid_unit <= options.max_grid_unit);
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+
+  std::vector<const api::Segment*> segments;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      segments.push_back(junction->segment(j));
+    }
+  }
+  const int num_segments = static_cast<int>(segments.size());
+  std::vector<SegmentComplexity> complexities(num_segments);
+  ParallelFor(num_segments, num_threads,
+              [&](int i) { complexities[i] = MeasureSegment(segments[i], options.sampling_step); });
+  const double max_error = ResolveMaxError(complexities, options);
+  std::vector<double> grid_units(num_segments);
+  for (int i = 0; i < num_segments; ++i) {
+    grid_units[i] = GridUnitForError(complexities[i], max_error, options.min_grid_unit, options.max_grid_unit);
+  }
+  const double measuring_time = timer->Elapsed();
+
+  timer->Reset();
+  const bool draw_branch_points = features.draw_branch_points && road_geometry->num_branch_points() > 0;
+  std::vector<RoadMesh> meshes(num_segments + (draw_branch_points ? 1 : 0));
+  ParallelFor(static_cast<int>(meshes.size()), num_threads, [&](int i) {
+    const std::string scratch_fileroot = "adaptive_" + std::to_string(i) + "_" + road_geometry->id().string();
+    if (i == num_segments) {
+      const RoadGeometryView view(road_geometry, std::vector<const api::Junction*>{}, true);
+      meshes[i] = MeshRoadGeometry(&view, features, options.scratch_dirpath, scratch_fileroot);
+      return;
+    }
+    utility::ObjFeatures segment_features = features;
+    segment_features.max_grid_unit = grid_units[i];
+    segment_features.min_grid_resolution = options.min_grid_resolution;
+    // Branch points are meshed on their own.
+    segment_features.draw_branch_points = false;
+    const std::unique_ptr<RoadGeometryView> view = MakeSegmentView(road_geometry, segments[i]);
+    meshes[i] = MeshRoadGeometry(view.get(), segment_features, options.scratch_dirpath, scratch_fileroot);
+  });
+  const double meshing_time = timer->Elapsed();
+
+  timer->Reset();
+  RoadMesh result = MergeRoadMeshes(&meshes);
+  const double merging_time = timer->Elapsed();
+
+  if (report != nullptr) {
+    report->num_segments = num_segments;
+    report->max_error = max_error;
+    report->estimated_triangles = 0;
+    for (int i = 0; i < num_segments; ++i) {
+      report->estimated_triangles += EstimateTriangles(complexities[i], grid_units[i], options.min_grid_resolution);
+    }
+    report->min_grid_unit = grid_units.empty() ? 0. : *std::min_element(grid_units.begin(), grid_units.end());
+    report->max_grid_unit = grid_units.empty() ? 0. : *std::max_element(grid_units.begin(), grid_units.end());
+    report->measuring_time = measuring_time;
+    report->meshing_time = meshing_time;
+    report->merging_time = merging_time;
+    report->num_triangles = CountTriangles(result.mesh);
+  }
+  return result;
+}
+
+}  // namespace integration
+}  // namespace maliput
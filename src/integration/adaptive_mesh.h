@@ -0,0 +1,147 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/segment.h>
+#include <maliput/utility/generate_obj.h>
+
+#include "integration/generate_mesh.h"
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of GenerateRoadMeshAdaptively().
+///
+/// At least one of `max_error` and `triangle_budget` must be positive. When both are, the coarsest grid that
+/// satisfies either of them is used, i.e. the budget is honored but the mesh is never finer than needed to meet
+/// `max_error`.
+struct AdaptiveMeshOptions {
+  /// Maximum distance between the mesh and the road surface, in meters. Non-positive to disable it.
+  double max_error{0.};
+  /// Target number of road surface triangles of the whole mesh. Non-positive to disable it.
+  int64_t triangle_budget{0};
+  /// Smallest grid unit a segment can be meshed with, in meters.
+  double min_grid_unit{0.1};
+  /// Largest grid unit a segment can be meshed with, in meters.
+  double max_grid_unit{20.};
+  /// Minimum number of grid units in either direction of a lane. It overrides
+  /// maliput::utility::ObjFeatures::min_grid_resolution, whose default would otherwise force a fine grid on narrow
+  /// lanes regardless of their shape.
+  double min_grid_resolution{1.};
+  /// Longitudinal distance between the samples used to measure the segments, in meters.
+  double sampling_step{1.};
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Directory where the intermediate meshes are written. It must exist.
+  std::string scratch_dirpath{"."};
+};
+
+/// Shape measurements of a segment.
+struct SegmentComplexity {
+  /// Length and width of every lane, in meters.
+  std::vector<std::pair<double, double>> lane_sizes;
+  /// Maximum horizontal curvature of the lane centerlines and segment boundaries, in 1/m.
+  double max_curvature{};
+  /// Maximum absolute second derivative of the elevation along the lane centerlines and segment boundaries, in 1/m.
+  double max_vertical_curvature{};
+};
+
+/// Holds the measurements of an adaptive mesh generation.
+struct AdaptiveMeshReport {
+  /// Number of meshed segments.
+  int num_segments{};
+  /// Maximum geometric error the grid units were chosen for, in meters.
+  double max_error{};
+  /// Estimated number of road surface triangles. See EstimateTriangles().
+  int64_t estimated_triangles{};
+  /// Smallest grid unit chosen for a segment, in meters.
+  double min_grid_unit{};
+  /// Largest grid unit chosen for a segment, in meters.
+  double max_grid_unit{};
+  /// Time spent measuring the segments and choosing their grid units, in seconds.
+  double measuring_time{};
+  /// Time spent meshing the segments, in seconds.
+  double meshing_time{};
+  /// Time spent merging the meshes of the segments, in seconds.
+  double merging_time{};
+  /// Number of triangles of the merged mesh, including stripes, arrows and any other feature.
+  int64_t num_triangles{};
+};
+
+/// Samples the lanes of @p segment every @p sampling_step meters and measures their size and curvature.
+///
+/// Curvatures are estimated from every three consecutive samples of the lane centerlines and of the segment
+/// boundaries, so both the horizontal alignment and the elevation and superelevation profiles are accounted for.
+///
+/// @param segment Segment to measure. It must not be nullptr.
+/// @param sampling_step Longitudinal distance between samples, in meters. It must be positive.
+/// @throws maliput::common::assertion_error When @p segment is nullptr or @p sampling_step is not positive.
+SegmentComplexity MeasureSegment(const api::Segment* segment, double sampling_step);
+
+/// @returns The largest grid unit, clamped to [@p min_grid_unit, @p max_grid_unit], whose chords deviate at most
+///          @p max_error from arcs of the maximum curvatures of @p complexity, i.e. sqrt(8 * max_error / curvature).
+double GridUnitForError(const SegmentComplexity& complexity, double max_error, double min_grid_unit,
+                        double max_grid_unit);
+
+/// @returns An estimation of the number of road surface triangles maliput::utility::GenerateObjFile() produces for
+///          the lanes measured by @p complexity when meshed with @p grid_unit and @p min_grid_resolution.
+int64_t EstimateTriangles(const SegmentComplexity& complexity, double grid_unit, double min_grid_resolution);
+
+/// Meshes @p road_geometry segment by segment, each one with a grid unit adapted to its shape.
+///
+/// Segments are measured with MeasureSegment() and their grid unit is chosen with GridUnitForError(). When a triangle
+/// budget is given, the maximum error is found by bisection so that the estimated triangles fit the budget. Flat and
+/// straight segments are therefore meshed with few large triangles, while tight curves keep a fine grid. Segments are
+/// meshed concurrently and merged in road geometry order; branch points, when drawn, are meshed with @p features.
+///
+/// The segment is the finest unit the grid adapts to. maliput::utility::GenerateObjFile() covers the road surface of
+/// a segment with a single grid, so the grid unit of a segment is chosen for its most curved lane or boundary and
+/// applies to all of its lanes along their whole length. A segment with one tight curve is thus meshed finely
+/// everywhere.
+///
+/// The backend of @p road_geometry must support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to mesh. It must not be nullptr.
+/// @param features Meshing configuration. `max_grid_unit` and `min_grid_resolution` are chosen per segment.
+/// @param options Adaptive meshing configuration.
+/// @param report When not nullptr, it is filled with the measurements of the generation.
+/// @returns The merged RoadMesh.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or @p options is invalid.
+RoadMesh GenerateRoadMeshAdaptively(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                                    const AdaptiveMeshOptions& options, AdaptiveMeshReport* report);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,401 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/binary_mesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Size of the staging buffer used to stream binary data.
+constexpr size_t kStagingBufferSize{1 << 16};
+
+// glTF constants, see https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html.
+constexpr uint32_t kGlbMagic{0x46546C67};          // "glTF"
+constexpr uint32_t kGlbVersion{2};
+constexpr uint32_t kGlbJsonChunkType{0x4E4F534A};  // "JSON"
+constexpr uint32_t kGlbBinChunkType{0x004E4942};   // "BIN\0"
+constexpr int kGltfArrayBuffer{34962};
+constexpr int kGltfElementArrayBuffer{34963};
+constexpr int kGltfFloat{5126};
+constexpr int kGltfUnsignedInt{5125};
+
+// @returns Whether the host stores multi-byte values in little-endian order, as glTF and the written PLY files do.
+bool IsLittleEndianHost() {
+  const uint32_t value{1};
+  uint8_t first_byte;
+  std::memcpy(&first_byte, &value, sizeof(first_byte));
+  return first_byte == 1;
+}
+
+// Color of the faces without a known material.
+constexpr std::array<double, 4> kDefaultColor{0.8, 0.8, 0.8, 1.};
+
+// Accumulates binary data and writes it to a stream in chunks of kStagingBufferSize bytes.
+class StagingWriter {
+ public:
+  explicit StagingWriter(std::ostream* out) : out_(out) { buffer_.reserve(kStagingBufferSize); }
+
+  ~StagingWriter() { Flush(); }
+
+  // Appends the in-memory representation of @p value.
+  template <typename T>
+  void Append(const T& value) {
+    if (buffer_.size() + sizeof(T) > kStagingBufferSize) {
+      Flush();
+    }
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+  }
+
+  // Writes the pending data.
+  void Flush() {
+    out_->write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+  }
+
+ private:
+  std::ostream* out_{};
+  std::vector<char> buffer_;
+};
+
+// Distinct (vertex, normal) pairs of the corners of a mesh, as required by formats with per-vertex attributes.
+struct UnifiedCorners {
+  // Vertex and normal index of every unified vertex. Normal indices are -1 when there is no normal.
+  std::vector<std::pair<int, int>> vertices;
+  // Unified vertex of every corner.
+  std::vector<uint32_t> corner_vertices;
+  // Whether any corner has a normal.
+  bool has_normals{false};
+};
+
+UnifiedCorners UnifyCorners(const Mesh& mesh) {
+  UnifiedCorners result;
+  result.corner_vertices.reserve(mesh.vertex_indices.size());
+  std::unordered_map<uint64_t, uint32_t> unified_index;
+  for (size_t corner = 0; corner < mesh.vertex_indices.size(); ++corner) {
+    const int vertex = mesh.vertex_indices[corner];
+    const int normal = mesh.normal_indices[corner];
+    result.has_normals |= normal != -1;
+    const uint64_t key = (static_cast<uint64_t>(vertex) << 32) | static_cast<uint32_t>(normal + 1);
+    const auto it = unified_index.emplace(key, static_cast<uint32_t>(result.vertices.size()));
+    if (it.second) {
+      result.vertices.emplace_back(vertex, normal);
+    }
+    result.corner_vertices.push_back(it.first->second);
+  }
+  return result;
+}
+
+// @returns The RGBA color described by the `Kd` and `d` statements of @p material.
+std::array<double, 4> GetColor(const Material& material) {
+  std::array<double, 4> color = kDefaultColor;
+  for (const std::string& statement : material.statements) {
+    std::istringstream ss(statement);
+    std::string keyword;
+    ss >> keyword;
+    if (keyword == "Kd") {
+      ss >> color[0] >> color[1] >> color[2];
+    } else if (keyword == "d") {
+      ss >> color[3];
+    }
+  }
+  return color;
+}
+
+// @returns The color of every material of @p mesh, looked up by name in @p materials.
+std::vector<std::array<double, 4>> GetMeshColors(const Mesh& mesh, const MaterialLibrary& materials) {
+  std::vector<std::array<double, 4>> colors;
+  for (const std::string& name : mesh.materials) {
+    const auto it =
+        std::find_if(materials.begin(), materials.end(), [&name](const Material& m) { return m.name == name; });
+    colors.push_back(it != materials.end() ? GetColor(*it) : kDefaultColor);
+  }
+  return colors;
+}
+
+// @returns @p v expressed in the glTF frame, i.e. y up.
+std::array<double, 3> ToGltfFrame(const maliput::math::Vector3& v) { return {v.x(), v.z(), -v.y()}; }
+
+// @returns A JSON representation of @p value that round-trips when parsed as a double.
+std::string JsonNumber(double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  return buffer;
+}
+
+// @returns A JSON string literal of @p value.
+std::string JsonString(const std::string& value) {
+  std::string result{"\""};
+  for (const char c : value) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result + "\"";
+}
+
+// @returns A JSON array of @p values.
+template <size_t N>
+std::string JsonArray(const std::array<double, N>& values) {
+  std::string result{"["};
+  for (size_t i = 0; i < N; ++i) {
+    result += (i == 0 ? "" : ",") + JsonNumber(values[i]);
+  }
+  return result + "]";
+}
+
+// Triangles of the faces that share a material, written as a glTF primitive.
+struct Primitive {
+  int material{-1};
+  int64_t num_indices{0};
+};
+
+}  // namespace
+
+void WriteGlb(const Mesh& mesh, const MaterialLibrary& materials, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  // Buffers are written in the host byte order.
+  MALIPUT_THROW_UNLESS(IsLittleEndianHost());
+  const UnifiedCorners unified = UnifyCorners(mesh);
+  const size_t num_vertices = unified.vertices.size();
+
+  // The bounding box is computed in the glTF frame. Positions are stored relative to its minimum corner.
+  std::array<double, 3> origin{0., 0., 0.};
+  if (num_vertices > 0) {
+    origin.fill(std::numeric_limits<double>::infinity());
+    for (const auto& vertex : unified.vertices) {
+      const std::array<double, 3> p = ToGltfFrame(mesh.vertices[vertex.first]);
+      for (int i = 0; i < 3; ++i) {
+        origin[i] = std::min(origin[i], p[i]);
+      }
+    }
+  }
+  std::array<double, 3> min_position{0., 0., 0.};
+  std::array<double, 3> max_position{0., 0., 0.};
+  for (size_t v = 0; v < num_vertices; ++v) {
+    const std::array<double, 3> p = ToGltfFrame(mesh.vertices[unified.vertices[v].first]);
+    for (int i = 0; i < 3; ++i) {
+      const double offset = static_cast<double>(static_cast<float>(p[i] - origin[i]));
+      min_position[i] = v == 0 ? offset : std::min(min_position[i], offset);
+      max_position[i] = v == 0 ? offset : std::max(max_position[i], offset);
+    }
+  }
+
+  // One primitive per material, in order of first use. Faces without material go last.
+  std::vector<Primitive> primitives(mesh.materials.size() + 1);
+  for (size_t i = 0; i < mesh.materials.size(); ++i) {
+    primitives[i].material = static_cast<int>(i);
+  }
+  for (int face = 0; face < mesh.num_faces(); ++face) {
+    const int material = mesh.face_materials[face];
+    primitives[material == -1 ? mesh.materials.size() : material].num_indices +=
+        3 * std::max(0, mesh.num_corners(face) - 2);
+  }
+  primitives.erase(std::remove_if(primitives.begin(), primitives.end(),
+                                  [](const Primitive& p) { return p.num_indices == 0; }),
+                   primitives.end());
+
+  const size_t positions_size = num_vertices * 3 * sizeof(float);
+  const size_t normals_size = unified.has_normals ? positions_size : 0;
+  int64_t num_indices{0};
+  for (const Primitive& primitive : primitives) {
+    num_indices += primitive.num_indices;
+  }
+  // glTF requires at least one primitive, and every buffer and accessor to be non-empty.
+  MALIPUT_THROW_UNLESS(num_indices > 0);
+  // Vertex indices are stored as uint32_t.
+  MALIPUT_THROW_UNLESS(num_vertices <= std::numeric_limits<uint32_t>::max());
+  const size_t indices_size = num_indices * sizeof(uint32_t);
+  const size_t bin_size = positions_size + normals_size + indices_size;
+
+  // JSON chunk.
+  const std::vector<std::array<double, 4>> colors = GetMeshColors(mesh, materials);
+  std::ostringstream json;
+  json << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"maliput_integration\"},\"scene\":0,"
+       << "\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0,\"translation\":" << JsonArray(origin) << "}],"
+       << "\"buffers\":[{\"byteLength\":" << bin_size << "}],\"bufferViews\":["
+       << "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << positions_size << ",\"target\":" << kGltfArrayBuffer
+       << "}";
+  if (unified.has_normals) {
+    json << ",{\"buffer\":0,\"byteOffset\":" << positions_size << ",\"byteLength\":" << normals_size
+         << ",\"target\":" << kGltfArrayBuffer << "}";
+  }
+  const int indices_view = unified.has_normals ? 2 : 1;
+  json << ",{\"buffer\":0,\"byteOffset\":" << positions_size + normals_size << ",\"byteLength\":" << indices_size
+       << ",\"target\":" << kGltfElementArrayBuffer << "}],\"accessors\":["
+       << "{\"bufferView\":0,\"componentType\":" << kGltfFloat << ",\"count\":" << num_vertices
+       << ",\"type\":\"VEC3\",\"min\":" << JsonArray(min_position) << ",\"max\":" << JsonArray(max_position) << "}";
+  if (unified.has_normals) {
+    json << ",{\"bufferView\":1,\"componentType\":" << kGltfFloat << ",\"count\":" << num_vertices
+         << ",\"type\":\"VEC3\"}";
+  }
+  const int first_index_accessor = unified.has_normals ? 2 : 1;
+  int64_t index_offset{0};
+  for (const Primitive& primitive : primitives) {
+    json << ",{\"bufferView\":" << indices_view << ",\"byteOffset\":" << index_offset * sizeof(uint32_t)
+         << ",\"componentType\":" << kGltfUnsignedInt << ",\"count\":" << primitive.num_indices
+         << ",\"type\":\"SCALAR\"}";
+    index_offset += primitive.num_indices;
+  }
+  json << "],\"meshes\":[{\"primitives\":[";
+  for (size_t i = 0; i < primitives.size(); ++i) {
+    json << (i == 0 ? "" : ",") << "{\"attributes\":{\"POSITION\":0"
+         << (unified.has_normals ? ",\"NORMAL\":1" : "") << "},\"indices\":" << first_index_accessor + i;
+    if (primitives[i].material != -1) {
+      json << ",\"material\":" << primitives[i].material;
+    }
+    json << ",\"mode\":4}";
+  }
+  json << "]}]";
+  // Primitives without material use the glTF default material. Empty top level arrays are not allowed.
+  if (!mesh.materials.empty()) {
+    json << ",\"materials\":[";
+  }
+  for (size_t i = 0; i < mesh.materials.size(); ++i) {
+    json << (i == 0 ? "" : ",") << "{\"name\":" << JsonString(mesh.materials[i])
+         << ",\"pbrMetallicRoughness\":{\"baseColorFactor\":" << JsonArray(colors[i])
+         << ",\"metallicFactor\":0,\"roughnessFactor\":1},\"doubleSided\":true"
+         << (colors[i][3] < 1. ? ",\"alphaMode\":\"BLEND\"" : "") << "}";
+  }
+  json << (mesh.materials.empty() ? "}" : "]}");
+  std::string json_chunk = json.str();
+  // Chunks are 4-byte aligned; JSON is padded with spaces. The binary chunk is always aligned.
+  json_chunk.append((4 - json_chunk.size() % 4) % 4, ' ');
+
+  // Chunk lengths and the total length are stored as uint32_t.
+  const size_t glb_size = 12 + 8 + json_chunk.size() + 8 + bin_size;
+  MALIPUT_THROW_UNLESS(glb_size <= std::numeric_limits<uint32_t>::max());
+  StagingWriter writer(out);
+  const uint32_t total_size = static_cast<uint32_t>(glb_size);
+  writer.Append(kGlbMagic);
+  writer.Append(kGlbVersion);
+  writer.Append(total_size);
+  writer.Append(static_cast<uint32_t>(json_chunk.size()));
+  writer.Append(kGlbJsonChunkType);
+  writer.Flush();
+  out->write(json_chunk.data(), json_chunk.size());
+  writer.Append(static_cast<uint32_t>(bin_size));
+  writer.Append(kGlbBinChunkType);
+  for (const auto& vertex : unified.vertices) {
+    const std::array<double, 3> p = ToGltfFrame(mesh.vertices[vertex.first]);
+    for (int i = 0; i < 3; ++i) {
+      writer.Append(static_cast<float>(p[i] - origin[i]));
+    }
+  }
+  if (unified.has_normals) {
+    for (const auto& vertex : unified.vertices) {
+      const std::array<double, 3> n =
+          ToGltfFrame(vertex.second == -1 ? maliput::math::Vector3{0., 0., 1.} : mesh.normals[vertex.second]);
+      for (int i = 0; i < 3; ++i) {
+        writer.Append(static_cast<float>(n[i]));
+      }
+    }
+  }
+  for (const Primitive& primitive : primitives) {
+    for (int face = 0; face < mesh.num_faces(); ++face) {
+      if (mesh.face_materials[face] != primitive.material) {
+        continue;
+      }
+      const int first = mesh.face_offsets[face];
+      for (int corner = first + 1; corner + 1 < mesh.face_offsets[face + 1]; ++corner) {
+        writer.Append(unified.corner_vertices[first]);
+        writer.Append(unified.corner_vertices[corner]);
+        writer.Append(unified.corner_vertices[corner + 1]);
+      }
+    }
+  }
+  writer.Flush();
+}
+
+void WritePly(const Mesh& mesh, const MaterialLibrary& materials, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  // Buffers are written in the host byte order.
+  MALIPUT_THROW_UNLESS(IsLittleEndianHost());
+  const UnifiedCorners unified = UnifyCorners(mesh);
+  const std::vector<std::array<double, 4>> colors = GetMeshColors(mesh, materials);
+
+  (*out) << "ply\nformat binary_little_endian 1.0\ncomment Generated by maliput_integration\n"
+         << "element vertex " << unified.vertices.size() << "\n"
+         << "property double x\nproperty double y\nproperty double z\n";
+  if (unified.has_normals) {
+    (*out) << "property float nx\nproperty float ny\nproperty float nz\n";
+  }
+  (*out) << "element face " << mesh.num_faces() << "\n"
+         << "property list uchar uint vertex_indices\n"
+         << "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+         << "end_header\n";
+
+  StagingWriter writer(out);
+  for (const auto& vertex : unified.vertices) {
+    const maliput::math::Vector3& p = mesh.vertices[vertex.first];
+    writer.Append(p.x());
+    writer.Append(p.y());
+    writer.Append(p.z());
+    if (unified.has_normals) {
+      const maliput::math::Vector3 n =
+          vertex.second == -1 ? maliput::math::Vector3{0., 0., 1.} : mesh.normals[vertex.second];
+      writer.Append(static_cast<float>(n.x()));
+      writer.Append(static_cast<float>(n.y()));
+      writer.Append(static_cast<float>(n.z()));
+    }
+  }
+  for (int face = 0; face < mesh.num_faces(); ++face) {
+    const int num_corners = mesh.num_corners(face);
+    MALIPUT_VALIDATE(num_corners <= std::numeric_limits<uint8_t>::max(), "PLY faces can't exceed 255 corners.");
+    writer.Append(static_cast<uint8_t>(num_corners));
+    for (int corner = mesh.face_offsets[face]; corner < mesh.face_offsets[face + 1]; ++corner) {
+      writer.Append(unified.corner_vertices[corner]);
+    }
+    const int material = mesh.face_materials[face];
+    const std::array<double, 4>& color = material == -1 ? kDefaultColor : colors[material];
+    for (int i = 0; i < 3; ++i) {
+      writer.Append(static_cast<uint8_t>(std::clamp(color[i], 0., 1.) * 255. + 0.5));
+    }
+  }
+  writer.Flush();
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,75 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <ostream>
+
+#include "integration/mesh.h"
+
+namespace maliput {
+namespace integration {
+
+/// Writes @p mesh as a binary glTF 2.0 (.glb) stream.
+///
+/// Every distinct (vertex, normal) pair of the corners of @p mesh becomes a glTF vertex and faces are triangulated as
+/// fans. Faces are grouped into one primitive per material, whose base color and opacity are taken from the `Kd` and
+/// `d` statements of @p materials. Coordinates are converted from the maliput inertial frame (z up) to the glTF frame
+/// (y up), and are stored as single precision offsets from the minimum corner of the mesh bounding box, which is
+/// stored in double precision as the node translation.
+///
+/// Vertex and index buffers are streamed through a small fixed-size staging buffer; only the vertex deduplication
+/// tables are held in memory. Binary data is written in the host byte order, which glTF requires to be
+/// little-endian, so big-endian hosts are rejected.
+///
+/// Faces without material use the glTF default material, and the `materials` array is omitted when @p mesh has no
+/// materials.
+///
+/// @param mesh Mesh to serialize. It must have at least one face with three or more corners.
+/// @param materials Materials referenced by @p mesh. Unknown materials are rendered in light gray.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p out is nullptr, when @p mesh has no triangles, when the
+///         result does not fit in the 32-bit lengths of the GLB container, or when the host is big-endian.
+void WriteGlb(const Mesh& mesh, const MaterialLibrary& materials, std::ostream* out);
+
+/// Writes @p mesh as a binary little-endian PLY stream.
+///
+/// Every distinct (vertex, normal) pair of the corners of @p mesh becomes a PLY vertex, with double precision
+/// coordinates and single precision normals. Faces keep their corners and carry the `Kd` color of their material.
+/// Data is streamed as described in WriteGlb().
+///
+/// @param mesh Mesh to serialize.
+/// @param materials Materials referenced by @p mesh. Unknown materials are rendered in light gray.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p out is nullptr, a face has more than 255 corners or the host is
+///         big-endian.
+void WritePly(const Mesh& mesh, const MaterialLibrary& materials, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
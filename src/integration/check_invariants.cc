@@ -0,0 +1,213 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/check_invariants.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of segments each worker thread may check ahead of the reported ones.
+constexpr int kSegmentsPerThread{4};
+
+// @returns A printable name of @p end.
+const char* EndName(api::LaneEnd::Which end) { return end == api::LaneEnd::kStart ? "start" : "finish"; }
+
+// @returns The inertial position of @p lane_end.
+api::InertialPosition LaneEndPosition(const api::LaneEnd& lane_end) {
+  const double s = lane_end.end == api::LaneEnd::kStart ? 0. : lane_end.lane->length();
+  return lane_end.lane->ToInertialPosition(api::LanePosition(s, 0., 0.));
+}
+
+// @returns The orientation of @p lane_end, pointing out of its lane.
+api::Rotation OrientationOutFromLane(const api::LaneEnd& lane_end) {
+  if (lane_end.end == api::LaneEnd::kStart) {
+    return lane_end.lane->GetOrientation(api::LanePosition(0., 0., 0.)).Reverse();
+  }
+  return lane_end.lane->GetOrientation(api::LanePosition(lane_end.lane->length(), 0., 0.));
+}
+
+// @returns Whether @p lane_ends holds @p lane_end.
+bool Contains(const api::LaneEndSet* lane_ends, const api::LaneEnd& lane_end) {
+  for (int i = 0; i < lane_ends->size(); ++i) {
+    if (lane_ends->get(i).lane == lane_end.lane && lane_ends->get(i).end == lane_end.end) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Checks that @p adjacent, the lane to the left of @p lane when @p is_left or to its right otherwise, belongs to the
+// same segment and refers back to @p lane.
+void CheckAdjacentLane(const api::Lane* lane, const api::Lane* adjacent, bool is_left,
+                       std::vector<std::string>* violations) {
+  if (adjacent == nullptr) {
+    return;
+  }
+  const std::string name = "Lane " + lane->id().string() + " has lane " + adjacent->id().string() + " to its " +
+                           (is_left ? "left" : "right");
+  if ((is_left ? adjacent->to_right() : adjacent->to_left()) != lane) {
+    violations->push_back(name + ", which does not have it on the other side.");
+  }
+  if (adjacent->segment() != lane->segment()) {
+    violations->push_back(name + ", which belongs to another segment.");
+  }
+}
+
+// Checks the branch point at @p lane_end.
+void CheckLaneEnd(const api::LaneEnd& lane_end, double linear_tolerance, double angular_tolerance,
+                  std::vector<std::string>* violations) {
+  const std::string name = "Lane " + lane_end.lane->id().string() + " " + EndName(lane_end.end);
+  const api::BranchPoint* branch_point = lane_end.lane->GetBranchPoint(lane_end.end);
+  if (branch_point == nullptr) {
+    violations->push_back(name + " has no branch point.");
+    return;
+  }
+  const bool is_a_side = Contains(branch_point->GetASide(), lane_end);
+  if (!is_a_side && !Contains(branch_point->GetBSide(), lane_end)) {
+    violations->push_back(name + " is not listed by its branch point " + branch_point->id().string() + ".");
+    return;
+  }
+  // Every lane end is compared against the first A-side lane end, or the first B-side one when the A-side is empty.
+  const bool is_reference_a_side = branch_point->GetASide()->size() > 0;
+  const api::LaneEnd& reference =
+      is_reference_a_side ? branch_point->GetASide()->get(0) : branch_point->GetBSide()->get(0);
+  if (reference.lane == lane_end.lane && reference.end == lane_end.end) {
+    return;
+  }
+  const double distance = LaneEndPosition(reference).Distance(LaneEndPosition(lane_end));
+  if (distance > linear_tolerance) {
+    std::ostringstream message;
+    message << name << " is " << distance << " m away from " << reference.lane->id().string() << " "
+            << EndName(reference.end) << " at branch point " << branch_point->id().string() << ".";
+    violations->push_back(message.str());
+  }
+  // Lane ends on opposite sides point in opposite directions.
+  const api::Rotation orientation = is_a_side == is_reference_a_side ? OrientationOutFromLane(lane_end)
+                                                                     : OrientationOutFromLane(lane_end).Reverse();
+  const double angle = OrientationOutFromLane(reference).Distance(orientation);
+  if (angle > angular_tolerance) {
+    std::ostringstream message;
+    message << name << " is rotated " << angle << " rad from " << reference.lane->id().string() << " "
+            << EndName(reference.end) << " at branch point " << branch_point->id().string() << ".";
+    violations->push_back(message.str());
+  }
+}
+
+}  // namespace
+
+std::vector<std::string> CheckSegmentInvariants(const api::Segment* segment, double linear_tolerance,
+                                                double angular_tolerance) {
+  MALIPUT_THROW_UNLESS(segment != nullptr);
+  std::vector<std::string> violations;
+  for (int i = 0; i < segment->num_lanes(); ++i) {
+    const api::Lane* lane = segment->lane(i);
+    if (lane->segment() != segment) {
+      violations.push_back("Lane " + lane->id().string() + " does not refer back to segment " +
+                           segment->id().string() + ".");
+    }
+    CheckAdjacentLane(lane, lane->to_left(), true, &violations);
+    CheckAdjacentLane(lane, lane->to_right(), false, &violations);
+    CheckLaneEnd(api::LaneEnd(lane, api::LaneEnd::kStart), linear_tolerance, angular_tolerance, &violations);
+    CheckLaneEnd(api::LaneEnd(lane, api::LaneEnd::kFinish), linear_tolerance, angular_tolerance, &violations);
+  }
+  return violations;
+}
+
+InvariantCheckReport CheckInvariantsInParallel(const api::RoadGeometry* road_geometry,
+                                               const InvariantCheckOptions& options,
+                                               const std::function<void(const std::string&)>& on_violation,
+                                               const std::function<void(int, int)>& on_progress) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(static_cast<bool>(on_violation));
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  const double linear_tolerance = options.linear_tolerance.value_or(road_geometry->linear_tolerance());
+  const double angular_tolerance = options.angular_tolerance.value_or(road_geometry->angular_tolerance());
+
+  std::vector<const api::Segment*> segments;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      segments.push_back(junction->segment(j));
+    }
+  }
+  const int num_segments = static_cast<int>(segments.size());
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+
+  InvariantCheckReport report;
+  report.num_segments = num_segments;
+  const int max_pending_segments = num_threads * kSegmentsPerThread;
+  std::vector<std::vector<std::string>> pending_violations(max_pending_segments);
+  OrderedParallelFor(
+      num_segments, num_threads, max_pending_segments,
+      [&](int i) {
+        pending_violations[i % max_pending_segments] =
+            CheckSegmentInvariants(segments[i], linear_tolerance, angular_tolerance);
+      },
+      [&](int i) {
+        std::vector<std::string>& violations = pending_violations[i % max_pending_segments];
+        for (const std::string& violation : violations) {
+          if (options.max_violations > 0 && report.num_violations >= options.max_violations) {
+            report.aborted = true;
+            break;
+          }
+          on_violation(violation);
+          ++report.num_violations;
+        }
+        violations.clear();
+        ++report.num_checked_segments;
+        if (on_progress) {
+          on_progress(report.num_checked_segments, num_segments);
+        }
+        if (options.max_violations > 0 && report.num_violations >= options.max_violations) {
+          report.aborted = report.aborted || report.num_checked_segments < num_segments;
+          return false;
+        }
+        return true;
+      });
+  report.num_threads = std::min(num_threads, std::max(num_segments, 1));
+  report.checking_time = timer->Elapsed();
+  return report;
+}
+
+}  // namespace integration
+}  // namespace maliput
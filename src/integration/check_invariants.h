@@ -0,0 +1,111 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/segment.h>
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of CheckInvariantsInParallel().
+struct InvariantCheckOptions {
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Number of violations after which the check stops. When non-positive, every segment is checked.
+  int max_violations{0};
+  /// Maximum distance between the lane ends of a branch point. Defaults to the linear tolerance of the road geometry.
+  std::optional<double> linear_tolerance{};
+  /// Maximum angle between the lane ends of a branch point. Defaults to the angular tolerance of the road geometry.
+  std::optional<double> angular_tolerance{};
+};
+
+/// Holds the measurements of an invariant check.
+struct InvariantCheckReport {
+  /// Number of segments of the road geometry.
+  int num_segments{};
+  /// Number of segments whose violations were reported.
+  int num_checked_segments{};
+  /// Number of violations reported.
+  int num_violations{};
+  /// Number of worker threads used.
+  int num_threads{};
+  /// Whether the check stopped after `max_violations` violations, leaving violations or segments unreported.
+  bool aborted{};
+  /// Time spent checking, in seconds.
+  double checking_time{};
+};
+
+/// Checks the invariants of every lane of @p segment.
+///
+/// For each lane it verifies that:
+/// - It belongs to @p segment and its adjacent lanes belong to @p segment and refer back to it.
+/// - Both of its ends have a branch point that lists them.
+/// - Both of its ends coincide with the first A-side lane end of their branch point within @p linear_tolerance, and
+///   are oriented alike (A-side) or opposite (B-side) within @p angular_tolerance.
+///
+/// @param segment The api::Segment to check. It must not be nullptr.
+/// @param linear_tolerance Maximum distance between lane ends of a branch point.
+/// @param angular_tolerance Maximum angle between lane ends of a branch point.
+/// @returns The description of every violation, in lane order.
+/// @throws maliput::common::assertion_error When @p segment is nullptr.
+std::vector<std::string> CheckSegmentInvariants(const api::Segment* segment, double linear_tolerance,
+                                                double angular_tolerance);
+
+/// Concurrent and streaming check of a subset of the invariants verified by api::RoadGeometry::CheckInvariants().
+///
+/// It only performs the per lane checks of CheckSegmentInvariants() and words its violations differently, so it is
+/// not a drop-in replacement for api::RoadGeometry::CheckInvariants().
+///
+/// Segments are checked with CheckSegmentInvariants() by worker threads and their violations are handed over to
+/// @p on_violation in the calling thread, in segment order, as soon as every preceding segment is done. Hence, the
+/// reported violations do not depend on the number of threads.
+///
+/// The backend of @p road_geometry must support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to check. It must not be nullptr.
+/// @param options Check configuration.
+/// @param on_violation Called with the description of every violation. It must not be empty.
+/// @param on_progress When not empty, called after every segment with the number of checked segments and the
+///                    total number of segments.
+/// @returns The measurements of the check.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or @p on_violation is empty.
+InvariantCheckReport CheckInvariantsInParallel(const api::RoadGeometry* road_geometry,
+                                               const InvariantCheckOptions& options,
+                                               const std::function<void(const std::string&)>& on_violation,
+                                               const std::function<void(int, int)>& on_progress);
+
+}  // namespace integration
+}  // namespace maliput
@@ -39,10 +39,7 @@ ChronoTimer::ChronoTimer() : Timer(), start_(std::chrono::high_resolution_clock:
 void ChronoTimer::DoReset() { start_ = std::chrono::high_resolution_clock::now(); }
 
 double ChronoTimer::DoElapsed() const {
-  return static_cast<double>(
-             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_)
-                 .count()) /
-         1000.;
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start_).count();
 }
 
 }  // namespace integration
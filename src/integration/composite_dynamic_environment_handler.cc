@@ -0,0 +1,163 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/composite_dynamic_environment_handler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The seconds from @p start to now.
+double SecondsSince(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+CompositeDynamicEnvironmentHandler::CompositeDynamicEnvironmentHandler(const Timer* timer,
+                                                                       api::RoadNetwork* road_network,
+                                                                       double tick_budget)
+    : DynamicEnvironmentHandler(timer, road_network), tick_budget_(tick_budget) {
+  MALIPUT_THROW_UNLESS(tick_budget_ > 0.);
+}
+
+int CompositeDynamicEnvironmentHandler::AddHandler(std::unique_ptr<DynamicEnvironmentHandler> handler, int priority) {
+  MALIPUT_THROW_UNLESS(handler != nullptr);
+  // Children publish within Update(), so their changes are gathered in the ongoing tick.
+  handler->Subscribe([this](const DynamicEnvironmentChanges& changes) {
+    if (current_changes_ != nullptr) {
+      current_changes_->Append(changes);
+    }
+  });
+  const int index = num_handlers();
+  Child child;
+  child.handler = std::move(handler);
+  child.stats.priority = priority;
+  children_.push_back(std::move(child));
+  // Keeps the order stable for children with the same priority.
+  const auto position = std::upper_bound(order_.begin(), order_.end(), priority,
+                                         [this](int value, int i) { return value > children_[i].stats.priority; });
+  order_.insert(position, index);
+  return index;
+}
+
+DynamicEnvironmentHandler* CompositeDynamicEnvironmentHandler::handler(int index) const {
+  MALIPUT_THROW_UNLESS(index >= 0 && index < num_handlers());
+  return children_[index].handler.get();
+}
+
+const CompositeDynamicEnvironmentHandler::HandlerStats& CompositeDynamicEnvironmentHandler::handler_stats(
+    int index) const {
+  MALIPUT_THROW_UNLESS(index >= 0 && index < num_handlers());
+  return children_[index].stats;
+}
+
+void CompositeDynamicEnvironmentHandler::Update() {
+  current_changes_ = BeginChanges();
+  const double now = current_changes_->time;
+  const auto tick_start = std::chrono::steady_clock::now();
+  const auto update_child = [this](Child* child) {
+    const auto update_start = std::chrono::steady_clock::now();
+    child->handler->Update();
+    const double cost = SecondsSince(update_start);
+    // Updates that change no state aren't published, but the deadlines they reached still count for the lateness.
+    const DynamicEnvironmentChanges& child_changes = child->handler->last_changes();
+    if (child_changes.empty()) {
+      current_changes_->deadlines.insert(current_changes_->deadlines.end(), child_changes.deadlines.begin(),
+                                         child_changes.deadlines.end());
+    }
+    ++child->stats.num_updates;
+    child->stats.last_cost = cost;
+    child->stats.total_cost += cost;
+    child->stats.max_cost = std::max(child->stats.max_cost, cost);
+  };
+  // Children deferred by the last tick run first, regardless of the budget, so they are never deferred twice in a row.
+  bool any_updated{false};
+  for (const int index : order_) {
+    Child& child = children_[index];
+    if (child.deferred) {
+      child.deferred = false;
+      update_child(&child);
+      child.updated = true;
+      any_updated = true;
+    }
+  }
+  bool any_deferred{false};
+  for (const int index : order_) {
+    Child& child = children_[index];
+    if (child.updated) {
+      child.updated = false;
+      continue;
+    }
+    const std::optional<double> next_update_time = child.handler->NextUpdateTime();
+    if (next_update_time.has_value() && *next_update_time > now) {
+      continue;
+    }
+    if (any_updated && SecondsSince(tick_start) >= tick_budget_) {
+      child.deferred = true;
+      ++child.stats.num_deferrals;
+      any_deferred = true;
+      continue;
+    }
+    update_child(&child);
+    any_updated = true;
+  }
+  last_tick_cost_ = SecondsSince(tick_start);
+  if (any_deferred) {
+    ++num_over_budget_ticks_;
+  }
+  current_changes_ = nullptr;
+  PublishChanges();
+}
+
+std::optional<double> CompositeDynamicEnvironmentHandler::NextUpdateTime() const {
+  std::optional<double> next_update_time;
+  for (const Child& child : children_) {
+    if (child.deferred) {
+      return timer_->Elapsed();
+    }
+  }
+  for (const Child& child : children_) {
+    const std::optional<double> child_next_update_time = child.handler->NextUpdateTime();
+    if (!child_next_update_time.has_value()) {
+      return std::nullopt;
+    }
+    next_update_time = std::min(next_update_time.value_or(*child_next_update_time), *child_next_update_time);
+  }
+  return next_update_time;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,147 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_changes.h"
+#include "integration/dynamic_environment_handler.h"
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// DynamicEnvironmentHandler class implementation.
+/// Runs several handlers, e.g. one for the phases and another one for the speed limits, as a single one.
+///
+/// Every Update() call updates the children that are due, as given by their NextUpdateTime(), in decreasing order of
+/// priority, and measures how long each one takes. Once the updates of a tick have taken `tick_budget` seconds, the
+/// due children left are deferred to the next tick. Deferred children run first in the next tick, in decreasing order
+/// of priority and regardless of the budget, before any other due child. Hence no child is delayed by more than one
+/// tick, even when higher priority children exhaust the budget every tick, and the first child of every tick always
+/// runs.
+///
+/// The changes of all the children in a tick are published as a single change. The deadlines reached by children that
+/// changed no state, whose changes aren't published, are added to last_changes() as well.
+class CompositeDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  /// Cost of the updates of a child.
+  struct HandlerStats {
+    /// Priority of the child.
+    int priority{};
+    /// Number of Update() calls.
+    int64_t num_updates{0};
+    /// Number of ticks the child was due but was deferred because the budget was exhausted.
+    int64_t num_deferrals{0};
+    /// Duration of the last Update() call, in seconds.
+    double last_cost{0.};
+    /// Total duration of the Update() calls, in seconds.
+    double total_cost{0.};
+    /// Longest Update() call, in seconds.
+    double max_cost{0.};
+  };
+
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CompositeDynamicEnvironmentHandler)
+  CompositeDynamicEnvironmentHandler() = delete;
+
+  /// Constructs a CompositeDynamicEnvironmentHandler without children.
+  ///
+  /// @param timer Timer implementation pointer.
+  /// @param road_network maliput::api::RoadNetwork pointer.
+  /// @param tick_budget Time, in seconds, the children of a tick can take before the rest are deferred. It must be
+  ///        positive. Costs are measured with std::chrono::steady_clock, regardless of @p timer.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met.
+  CompositeDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network, double tick_budget);
+
+  ~CompositeDynamicEnvironmentHandler() override = default;
+
+  /// Adds a child.
+  ///
+  /// @param handler The child. It must not be nullptr and is expected to be driven by the same timer.
+  /// @param priority Children with a greater priority run first. Children with the same priority run in the order they
+  ///        were added.
+  /// @returns The index of the child.
+  /// @throws maliput::common::assertion_error When @p handler is nullptr.
+  int AddHandler(std::unique_ptr<DynamicEnvironmentHandler> handler, int priority);
+
+  /// @returns The number of children.
+  int num_handlers() const { return static_cast<int>(children_.size()); }
+
+  /// @returns The @p index -th child, in the order they were added.
+  /// @throws maliput::common::assertion_error When @p index is out of range.
+  DynamicEnvironmentHandler* handler(int index) const;
+
+  /// @returns The cost of the updates of the @p index -th child.
+  /// @throws maliput::common::assertion_error When @p index is out of range.
+  const HandlerStats& handler_stats(int index) const;
+
+  /// @returns The time the children of a tick can take before the rest are deferred, in seconds.
+  double tick_budget() const { return tick_budget_; }
+
+  /// @returns The duration of the last Update() call, in seconds.
+  double last_tick_cost() const { return last_tick_cost_; }
+
+  /// @returns The number of Update() calls that deferred any child.
+  int64_t num_over_budget_ticks() const { return num_over_budget_ticks_; }
+
+  void Update() override;
+
+  /// @returns The current time of the timer when a child was deferred, std::nullopt when any child can't tell when
+  ///          its next update is due, or else the earliest NextUpdateTime() of the children.
+  std::optional<double> NextUpdateTime() const override;
+
+ private:
+  struct Child {
+    std::unique_ptr<DynamicEnvironmentHandler> handler;
+    HandlerStats stats;
+    // Whether the child was due in the last tick but didn't run.
+    bool deferred{false};
+    // Whether the child already ran in the ongoing tick, for being deferred by the last one.
+    bool updated{false};
+  };
+
+  const double tick_budget_{};
+  std::vector<Child> children_;
+  // Indices of `children_` in running order.
+  std::vector<int> order_;
+  // The changes of the ongoing Update() call, where the changes of the children are appended to, nullptr otherwise.
+  DynamicEnvironmentChanges* current_changes_{};
+  double last_tick_cost_{0.};
+  int64_t num_over_budget_ticks_{0};
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -30,9 +30,16 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
 
 #include "integration/dynamic_environment_handler.h"
+#include "integration/dynamic_environment_replay_handler.h"
 #include "integration/fixed_phase_iteration_handler.h"
+#include "integration/phase_duration_iteration_handler.h"
+#include "integration/scheduled_rule_state_handler.h"
 
 namespace maliput {
 namespace integration {
@@ -40,19 +47,106 @@ namespace integration {
 /// Types of DynamicEnvironmentHandler implementations.
 enum class DynamicEnvironmentHandlerType {
   kFixedPhaseIterationHandler,
+  kPhaseDurationIterationHandler,
+  kScheduledRuleStateHandler,
+  kDynamicEnvironmentReplayHandler,
+};
+
+namespace internal {
+
+// Maps a DynamicEnvironmentHandlerType to its implementation.
+template <DynamicEnvironmentHandlerType kType>
+struct DynamicEnvironmentHandlerClass;
+
+template <>
+struct DynamicEnvironmentHandlerClass<DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler> {
+  using type = FixedPhaseIterationHandler;
+};
+
+template <>
+struct DynamicEnvironmentHandlerClass<DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler> {
+  using type = PhaseDurationIterationHandler;
+};
+
+template <>
+struct DynamicEnvironmentHandlerClass<DynamicEnvironmentHandlerType::kScheduledRuleStateHandler> {
+  using type = ScheduledRuleStateHandler;
 };
 
-/// Create Timer.
+template <>
+struct DynamicEnvironmentHandlerClass<DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler> {
+  using type = DynamicEnvironmentReplayHandler;
+};
+
+// Whether the implementation of @p kType can be constructed from @p Args.
+template <DynamicEnvironmentHandlerType kType, typename... Args>
+constexpr bool kIsConstructible =
+    std::is_constructible_v<typename DynamicEnvironmentHandlerClass<kType>::type, Args...>;
+
+// @returns The implementation of @p kType constructed from @p args.
+// @throws maliput::common::assertion_error When it can't be constructed from @p args.
+template <DynamicEnvironmentHandlerType kType, typename... Args>
+std::unique_ptr<DynamicEnvironmentHandler> MakeDynamicEnvironmentHandler(Args&&... args) {
+  if constexpr (kIsConstructible<kType, Args&&...>) {
+    return std::make_unique<typename DynamicEnvironmentHandlerClass<kType>::type>(std::forward<Args>(args)...);
+  } else {
+    MALIPUT_THROW_MESSAGE("The DynamicEnvironmentHandlerType can't be constructed from the given arguments.");
+  }
+}
+
+}  // namespace internal
+
+/// Create DynamicEnvironmentHandler.
+/// @param args Arguments to be forwarded to the implementation.
+/// @returns A DynamicEnvironmentHandler instance of the implementation of @p kType.
+/// @tparam kType A DynamicEnvironmentHandlerType. Arguments that its implementation can't be constructed from fail to
+///               compile.
+/// @tparam Args Type of the arguments to be forwarded to the implementation.
+template <DynamicEnvironmentHandlerType kType, typename... Args>
+std::unique_ptr<DynamicEnvironmentHandler> CreateDynamicEnvironmentHandler(Args&&... args) {
+  return std::make_unique<typename internal::DynamicEnvironmentHandlerClass<kType>::type>(std::forward<Args>(args)...);
+}
+
+/// Create DynamicEnvironmentHandler.
+///
+/// Implementations take different arguments, so, as @p type is only known at run time, arguments that the selected
+/// implementation can't be constructed from throw. Arguments that no implementation can be constructed from fail to
+/// compile. Use the overload that takes the type as a template argument when it is known at compile time.
+///
 /// @param type A DynamicEnvironmentHandlerType.
 /// @param args Arguments to be forwarded to the selected implementation.
 /// @returns A DynamicEnvironmentHandler instance based on the selected implementation.
+/// @throws maliput::common::assertion_error When the selected implementation can't be constructed from @p args.
 /// @tparam Args Type of the arguments to be forwarded to the selected implementation.
 template <typename... Args>
 std::unique_ptr<DynamicEnvironmentHandler> CreateDynamicEnvironmentHandler(const DynamicEnvironmentHandlerType& type,
                                                                            Args&&... args) {
+  static_assert(internal::kIsConstructible<DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler, Args&&...> ||
+                    internal::kIsConstructible<DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler,
+                                               Args&&...> ||
+                    internal::kIsConstructible<DynamicEnvironmentHandlerType::kScheduledRuleStateHandler, Args&&...> ||
+                    internal::kIsConstructible<DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler,
+                                               Args&&...>,
+                "No DynamicEnvironmentHandler implementation can be constructed from the given arguments.");
   switch (type) {
     case DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler:
-      return std::make_unique<maliput::integration::FixedPhaseIterationHandler>(std::forward<Args>(args)...);
+      return internal::MakeDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler>(
+          std::forward<Args>(args)...);
+      break;
+
+    case DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler:
+      return internal::MakeDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler>(
+          std::forward<Args>(args)...);
+      break;
+
+    case DynamicEnvironmentHandlerType::kScheduledRuleStateHandler:
+      return internal::MakeDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kScheduledRuleStateHandler>(
+          std::forward<Args>(args)...);
+      break;
+
+    case DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler:
+      return internal::MakeDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler>(
+          std::forward<Args>(args)...);
       break;
 
     default:
@@ -32,6 +32,9 @@
 #include <maliput/common/maliput_throw.h>
 
 #include "integration/chrono_timer.h"
+#include "integration/simulated_timer.h"
+#include "integration/steady_timer.h"
+#include "integration/tsc_timer.h"
 
 namespace maliput {
 namespace integration {
@@ -41,6 +44,15 @@ std::unique_ptr<Timer> CreateTimer(const TimerType& type) {
     case TimerType::kChronoTimer:
       return std::make_unique<maliput::integration::ChronoTimer>();
       break;
+    case TimerType::kSimulatedTimer:
+      return std::make_unique<maliput::integration::SimulatedTimer>();
+      break;
+    case TimerType::kSteadyTimer:
+      return std::make_unique<maliput::integration::SteadyTimer>();
+      break;
+    case TimerType::kTscTimer:
+      return std::make_unique<maliput::integration::TscTimer>();
+      break;
 
     default:
       MALIPUT_THROW_MESSAGE("Not identified timer type.");
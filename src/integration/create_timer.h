@@ -39,11 +39,15 @@ namespace integration {
 /// Timer implementations.
 enum class TimerType {
   kChronoTimer,
+  kSimulatedTimer,
+  kSteadyTimer,
+  kTscTimer,
 };
 
 /// Create Timer.
 /// @param type A TimerType.
 /// @returns A Timer instance based on the selected implementation.
+/// @throws maliput::common::assertion_error When @p type is TimerType::kTscTimer and TscTimer::IsSupported() is false.
 std::unique_ptr<Timer> CreateTimer(const TimerType& type);
 
 }  // namespace integration
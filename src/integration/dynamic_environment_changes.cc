@@ -0,0 +1,134 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_changes.h"
+
+#include <optional>
+#include <utility>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Moves the elements of @p values to the back of @p spare, which keeps their memory, and clears @p values.
+template <typename T>
+void Recycle(std::vector<T>* values, std::vector<T>* spare) {
+  for (T& value : *values) {
+    spare->push_back(std::move(value));
+  }
+  values->clear();
+}
+
+// Moves an element of @p spare to the back of @p values, so that assigning to it reuses the memory of the strings and
+// containers it holds.
+// @returns The appended element, or nullptr when @p spare is empty.
+template <typename T>
+T* AppendSpare(std::vector<T>* spare, std::vector<T>* values) {
+  if (spare->empty()) {
+    return nullptr;
+  }
+  values->push_back(std::move(spare->back()));
+  spare->pop_back();
+  return &values->back();
+}
+
+// Appends the elements of [@p first, @p last) to @p values, reusing the elements of @p spare.
+template <typename T, typename Iterator>
+void AppendReusing(Iterator first, Iterator last, std::vector<T>* spare, std::vector<T>* values) {
+  for (; first != last; ++first) {
+    if (T* value = AppendSpare(spare, values)) {
+      *value = *first;
+    } else {
+      values->push_back(*first);
+    }
+  }
+}
+
+}  // namespace
+
+PhaseStateChanges DiffPhases(const api::rules::Phase& from, const api::rules::Phase& to) {
+  PhaseStateChanges changes;
+  const api::rules::DiscreteValueRuleStates& from_states = from.discrete_value_rule_states();
+  for (const auto& state : to.discrete_value_rule_states()) {
+    const auto it = from_states.find(state.first);
+    if (it == from_states.end() || it->second != state.second) {
+      changes.discrete_value_rule_states.push_back(state);
+    }
+  }
+  if (to.bulb_states().has_value()) {
+    const std::optional<api::rules::BulbStates>& from_bulb_states = from.bulb_states();
+    for (const auto& bulb_state : *to.bulb_states()) {
+      if (!from_bulb_states.has_value()) {
+        changes.bulb_states.push_back(bulb_state);
+        continue;
+      }
+      const auto it = from_bulb_states->find(bulb_state.first);
+      if (it == from_bulb_states->end() || it->second != bulb_state.second) {
+        changes.bulb_states.push_back(bulb_state);
+      }
+    }
+  }
+  return changes;
+}
+
+void DynamicEnvironmentChanges::Clear(double new_time) {
+  time = new_time;
+  Recycle(&phases, &spare_phases_);
+  Recycle(&discrete_value_rule_states, &spare_discrete_value_rule_states_);
+  Recycle(&range_value_rule_states, &spare_range_value_rule_states_);
+  Recycle(&bulb_states, &spare_bulb_states_);
+  deadlines.clear();
+}
+
+void DynamicEnvironmentChanges::Append(const api::rules::PhaseRing::Id& phase_ring_id,
+                                       const api::rules::Phase::Id& phase_id, const PhaseStateChanges& state_changes) {
+  if (PhaseChange* phase_change = AppendSpare(&spare_phases_, &phases)) {
+    phase_change->phase_ring_id = phase_ring_id;
+    phase_change->phase_id = phase_id;
+  } else {
+    phases.push_back(PhaseChange{phase_ring_id, phase_id});
+  }
+  AppendReusing(state_changes.discrete_value_rule_states.begin(), state_changes.discrete_value_rule_states.end(),
+                &spare_discrete_value_rule_states_, &discrete_value_rule_states);
+  AppendReusing(state_changes.bulb_states.begin(), state_changes.bulb_states.end(), &spare_bulb_states_,
+                &bulb_states);
+}
+
+void DynamicEnvironmentChanges::Append(const DynamicEnvironmentChanges& other) {
+  AppendReusing(other.phases.begin(), other.phases.end(), &spare_phases_, &phases);
+  AppendReusing(other.discrete_value_rule_states.begin(), other.discrete_value_rule_states.end(),
+                &spare_discrete_value_rule_states_, &discrete_value_rule_states);
+  AppendReusing(other.range_value_rule_states.begin(), other.range_value_rule_states.end(),
+                &spare_range_value_rule_states_, &range_value_rule_states);
+  AppendReusing(other.bulb_states.begin(), other.bulb_states.end(), &spare_bulb_states_, &bulb_states);
+  deadlines.insert(deadlines.end(), other.deadlines.begin(), other.deadlines.end());
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,117 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/traffic_lights.h>
+
+namespace maliput {
+namespace integration {
+
+/// States that change when moving from a phase to another one.
+struct PhaseStateChanges {
+  /// Discrete value rules whose state changes, along with their new state.
+  std::vector<std::pair<api::rules::Rule::Id, api::rules::DiscreteValueRule::DiscreteValue>>
+      discrete_value_rule_states;
+  /// Bulbs whose state changes, along with their new state.
+  std::vector<std::pair<api::rules::UniqueBulbId, api::rules::BulbState>> bulb_states;
+};
+
+/// @returns The states of @p to that are missing from or differ in @p from.
+PhaseStateChanges DiffPhases(const api::rules::Phase& from, const api::rules::Phase& to);
+
+/// Changes made to the dynamic states of a maliput::api::RoadNetwork by a DynamicEnvironmentHandler::Update() call.
+///
+/// It only lists what changed, so consumers can process each update in time proportional to the number of changes
+/// rather than to the size of the road network.
+///
+/// Clear() keeps the removed changes aside and Append() copies new changes into them, so the strings and containers
+/// they hold are reused. Once the changes of an update have been held, later updates with as many changes and
+/// identifiers that are not longer do not allocate; only the `related_rules` and `related_unique_ids` of non-empty
+/// discrete value rule states are allocated again.
+struct DynamicEnvironmentChanges {
+  /// Phase ring that moved to another phase.
+  struct PhaseChange {
+    /// ID of the phase ring.
+    api::rules::PhaseRing::Id phase_ring_id;
+    /// ID of its new phase.
+    api::rules::Phase::Id phase_id;
+  };
+
+  /// @returns Whether no state changed. `deadlines` is not considered: an update that reaches a transition deadline
+  ///          without changing any state is empty, so it isn't published. Consumers of the deadlines, such as the
+  ///          lateness statistics, read them from DynamicEnvironmentHandler::last_changes() instead.
+  bool empty() const {
+    return phases.empty() && discrete_value_rule_states.empty() && range_value_rule_states.empty() &&
+           bulb_states.empty();
+  }
+
+  /// Removes every change, keeping the memory already allocated, and sets the time to @p new_time.
+  void Clear(double new_time);
+
+  /// Appends that @p phase_ring_id moved to @p phase_id, changing @p state_changes.
+  void Append(const api::rules::PhaseRing::Id& phase_ring_id, const api::rules::Phase::Id& phase_id,
+              const PhaseStateChanges& state_changes);
+
+  /// Appends every change of @p other, keeping the time.
+  void Append(const DynamicEnvironmentChanges& other);
+
+  /// Time of the timer at which the changes were made, in seconds.
+  double time{};
+  /// Phase rings that changed their phase.
+  std::vector<PhaseChange> phases;
+  /// Discrete value rules, e.g. right-of-way rules, whose state changed, along with their new state.
+  std::vector<std::pair<api::rules::Rule::Id, api::rules::DiscreteValueRule::DiscreteValue>>
+      discrete_value_rule_states;
+  /// Range value rules, e.g. speed limits, whose state changed, along with their new state.
+  std::vector<std::pair<api::rules::Rule::Id, api::rules::RangeValueRule::Range>> range_value_rule_states;
+  /// Bulbs whose state changed, along with their new state.
+  std::vector<std::pair<api::rules::UniqueBulbId, api::rules::BulbState>> bulb_states;
+  /// Deadline of every transition applied by the update, i.e. the time of the timer, in seconds, at which it was due.
+  /// Only handlers that know when their transitions are due report them.
+  std::vector<double> deadlines;
+
+ private:
+  // Changes removed by Clear(), whose memory Append() reuses.
+  std::vector<PhaseChange> spare_phases_;
+  std::vector<std::pair<api::rules::Rule::Id, api::rules::DiscreteValueRule::DiscreteValue>>
+      spare_discrete_value_rule_states_;
+  std::vector<std::pair<api::rules::Rule::Id, api::rules::RangeValueRule::Range>> spare_range_value_rule_states_;
+  std::vector<std::pair<api::rules::UniqueBulbId, api::rules::BulbState>> spare_bulb_states_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,247 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_driver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <thread>
+
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/parallel_for.h"
+
+namespace maliput {
+namespace integration {
+
+DynamicEnvironmentDriver::DynamicEnvironmentDriver(const Timer* timer, int num_threads, double poll_period,
+                                                   double deadline_miss_tolerance)
+    : timer_(timer), poll_period_(poll_period), deadline_miss_tolerance_(deadline_miss_tolerance) {
+  MALIPUT_THROW_UNLESS(timer_ != nullptr);
+  MALIPUT_THROW_UNLESS(poll_period_ > 0.);
+  MALIPUT_THROW_UNLESS(deadline_miss_tolerance_ >= 0.);
+  const int num_workers = ResolveNumberOfThreads(num_threads);
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+}
+
+int DynamicEnvironmentDriver::AddHandler(std::unique_ptr<DynamicEnvironmentHandler> handler) {
+  MALIPUT_THROW_UNLESS(handler != nullptr);
+  handlers_.push_back(std::move(handler));
+  return num_handlers() - 1;
+}
+
+DynamicEnvironmentHandler* DynamicEnvironmentDriver::handler(int index) const {
+  MALIPUT_THROW_UNLESS(index >= 0 && index < num_handlers());
+  return handlers_[index].get();
+}
+
+DynamicEnvironmentDriver::Report DynamicEnvironmentDriver::Run(double end_time) {
+  Report report;
+  report.stats = UpdateLatencyStats(deadline_miss_tolerance_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return report;
+    }
+    finished_ = false;
+    failed_ = false;
+    first_exception_ = nullptr;
+    std::vector<Deadline> deadlines;
+    deadlines.reserve(handlers_.size());
+    for (int i = 0; i < num_handlers(); ++i) {
+      deadlines.emplace_back(GetDeadline(i), i);
+    }
+    deadlines_ = DeadlineQueue(std::greater<Deadline>(), std::move(deadlines));
+  }
+
+  std::vector<Report> worker_reports(workers_.size(), report);
+  std::vector<std::thread> threads;
+  threads.reserve(workers_.size());
+  for (int i = 0; i < num_threads(); ++i) {
+    threads.emplace_back([this, i, &worker_reports]() { RunWorker(i, &worker_reports[i]); });
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_ && !failed_) {
+      const double now = timer_->Elapsed();
+      // Handlers being updated are not in `deadlines_`; they are put back once their update is completed.
+      while (!deadlines_.empty() && deadlines_.top().first <= std::min(now, end_time)) {
+        Dispatch(deadlines_.top());
+        deadlines_.pop();
+      }
+      if (now >= end_time) {
+        // Updates in progress may put back deadlines due by `end_time`, so the call only returns once every handler
+        // is back in `deadlines_`, and all of them are past `end_time`.
+        if (static_cast<int>(deadlines_.size()) == num_handlers()) {
+          break;
+        }
+        driver_condition_.wait(lock);
+        continue;
+      }
+      const double wake_up_time = deadlines_.empty() ? end_time : std::min(deadlines_.top().first, end_time);
+      driver_condition_.wait_for(lock, std::chrono::duration<double>(wake_up_time - now));
+    }
+    finished_ = true;
+  }
+  worker_condition_.notify_all();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  // Tasks left behind by a Stop() call or a failure are dropped.
+  for (const auto& worker : workers_) {
+    worker->tasks.clear();
+  }
+  num_pending_tasks_ = 0;
+  if (first_exception_) {
+    std::rethrow_exception(first_exception_);
+  }
+
+  for (const Report& worker_report : worker_reports) {
+    report.num_updates += worker_report.num_updates;
+    report.num_steals += worker_report.num_steals;
+    report.max_update_delay = std::max(report.max_update_delay, worker_report.max_update_delay);
+    report.stats.Merge(worker_report.stats);
+  }
+  return report;
+}
+
+void DynamicEnvironmentDriver::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  driver_condition_.notify_all();
+  worker_condition_.notify_all();
+}
+
+double DynamicEnvironmentDriver::GetDeadline(int index) const {
+  const std::optional<double> next_update_time = handlers_[index]->NextUpdateTime();
+  return next_update_time.has_value() ? *next_update_time : timer_->Elapsed() + poll_period_;
+}
+
+void DynamicEnvironmentDriver::Dispatch(const Deadline& deadline) {
+  Worker* worker = workers_[next_worker_].get();
+  next_worker_ = (next_worker_ + 1) % num_threads();
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->tasks.push_back(deadline);
+  }
+  ++num_pending_tasks_;
+  worker_condition_.notify_one();
+}
+
+bool DynamicEnvironmentDriver::TakeTask(int worker, Deadline* task, Report* report) {
+  // Tasks are dispatched in deadline order, so the front of a queue holds its most urgent task. The owner takes from
+  // the front while thieves take from the back, which keeps them from contending for the same end.
+  {
+    Worker* own = workers_[worker].get();
+    std::lock_guard<std::mutex> lock(own->mutex);
+    if (!own->tasks.empty()) {
+      *task = own->tasks.front();
+      own->tasks.pop_front();
+      --num_pending_tasks_;
+      return true;
+    }
+  }
+  for (int i = 1; i < num_threads(); ++i) {
+    Worker* victim = workers_[(worker + i) % num_threads()].get();
+    std::lock_guard<std::mutex> lock(victim->mutex);
+    if (!victim->tasks.empty()) {
+      *task = victim->tasks.back();
+      victim->tasks.pop_back();
+      --num_pending_tasks_;
+      ++report->num_steals;
+      return true;
+    }
+  }
+  return false;
+}
+
+void DynamicEnvironmentDriver::RunWorker(int worker, Report* report) {
+  Deadline task;
+  // Start of the current loop iteration, and time of it spent waiting for tasks.
+  double loop_start_time = timer_->Elapsed();
+  double wait_duration{0.};
+  while (!stopped_ && !failed_) {
+    if (!TakeTask(worker, &task, report)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      const double wait_start_time = timer_->Elapsed();
+      worker_condition_.wait(lock, [this]() { return stopped_ || failed_ || finished_ || num_pending_tasks_ > 0; });
+      wait_duration += timer_->Elapsed() - wait_start_time;
+      if (finished_ && num_pending_tasks_ == 0) {
+        return;
+      }
+      continue;
+    }
+    DynamicEnvironmentHandler* handler = handlers_[task.second].get();
+    const std::optional<double> next_update_time = handler->NextUpdateTime();
+    const double update_start_time = timer_->Elapsed();
+    report->max_update_delay = std::max(report->max_update_delay, update_start_time - task.first);
+    try {
+      handler->Update();
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!first_exception_) {
+          first_exception_ = std::current_exception();
+        }
+        failed_ = true;
+      }
+      driver_condition_.notify_all();
+      worker_condition_.notify_all();
+      return;
+    }
+    ++report->num_updates;
+    const double update_end_time = timer_->Elapsed();
+    report->stats.AddUpdate(update_end_time - update_start_time, update_start_time - loop_start_time - wait_duration);
+    report->stats.AddTransitions(handler->last_changes(), next_update_time, update_start_time);
+    loop_start_time = update_end_time;
+    wait_duration = 0.;
+    const double deadline = GetDeadline(task.second);
+    bool wake_up_driver{false};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wake_up_driver = deadlines_.empty() || deadline < deadlines_.top().first;
+      deadlines_.emplace(deadline, task.second);
+      wake_up_driver = wake_up_driver || static_cast<int>(deadlines_.size()) == num_handlers();
+    }
+    // The driver only needs to wake up earlier than planned when this is the new earliest deadline, or when no update
+    // is left in progress, which it waits for past the end time.
+    if (wake_up_driver) {
+      driver_condition_.notify_one();
+    }
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
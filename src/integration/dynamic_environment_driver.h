@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_handler.h"
+#include "integration/timer.h"
+#include "integration/update_latency_stats.h"
+
+namespace maliput {
+namespace integration {
+
+/// Drives many independent DynamicEnvironmentHandlers from a fixed number of worker threads.
+///
+/// Every handler is updated once its DynamicEnvironmentHandler::NextUpdateTime() is due, as DynamicEnvironmentScheduler
+/// does for a single handler, so the number of threads doesn't grow with the number of handlers. The thread that
+/// calls Run() sleeps until the earliest deadline and hands the due handlers over to the workers, spreading them
+/// round-robin over per-worker queues. A worker runs the handlers of its own queue in deadline order and, when it runs
+/// out of them, steals from the back of the queue of another worker.
+///
+/// A handler is never updated by two threads at the same time, but different handlers are updated concurrently, so
+/// they must not share any state, e.g. each of them must have its own api::RoadNetwork.
+class DynamicEnvironmentDriver {
+ public:
+  /// Statistics of a Run() call.
+  struct Report {
+    /// Number of DynamicEnvironmentHandler::Update() calls.
+    int64_t num_updates{0};
+    /// Number of updates a worker took from the queue of another worker.
+    int64_t num_steals{0};
+    /// Largest time between the deadline of an update and its start, in seconds.
+    double max_update_delay{0.};
+    /// Lateness of the transitions applied by the updates, duration of the updates and loop overhead, i.e. the time
+    /// workers spent between updates neither waiting for tasks nor updating, as DynamicEnvironmentScheduler records
+    /// them.
+    UpdateLatencyStats stats{0.};
+  };
+
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentDriver)
+  DynamicEnvironmentDriver() = delete;
+
+  /// Constructs a DynamicEnvironmentDriver.
+  /// @param timer The timer the deadlines of the handlers refer to. It must not be nullptr.
+  /// @param num_threads Number of worker threads. See ResolveNumberOfThreads().
+  /// @param poll_period Update period of handlers that report no deadline, in seconds. It must be positive.
+  /// @param deadline_miss_tolerance Lateness, in seconds, above which a transition counts as a missed deadline in
+  ///                                Report::stats. It must be non-negative. By default, every late transition does.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met.
+  DynamicEnvironmentDriver(const Timer* timer, int num_threads, double poll_period,
+                           double deadline_miss_tolerance = 0.);
+
+  /// Takes ownership of @p handler. It must not be called while Run() is running.
+  /// @returns The index of @p handler.
+  /// @throws maliput::common::assertion_error When @p handler is nullptr.
+  int AddHandler(std::unique_ptr<DynamicEnvironmentHandler> handler);
+
+  /// @returns The number of handlers.
+  int num_handlers() const { return static_cast<int>(handlers_.size()); }
+
+  /// @returns The handler at @p index.
+  /// @throws maliput::common::assertion_error When @p index is out of range.
+  DynamicEnvironmentHandler* handler(int index) const;
+
+  /// @returns The number of worker threads.
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+  /// Updates every handler whenever its deadline is due until @p end_time, or until Stop() is called.
+  ///
+  /// The worker threads are started when the call begins and joined before it returns. Every deadline due by
+  /// @p end_time is served, even when the workers fall behind, but no later one is: once @p end_time is reached, the
+  /// call waits for the updates in progress and keeps serving the deadlines due by @p end_time they leave behind.
+  /// After Stop(), only the updates in progress are completed.
+  ///
+  /// @param end_time Time of the timer, in seconds, after which no update is started.
+  /// @returns The statistics of the call.
+  /// @throws The first exception thrown by a DynamicEnvironmentHandler::Update() call, once every worker has finished.
+  Report Run(double end_time);
+
+  /// Makes a running Run() call return after the updates in progress are completed, and every following one return
+  /// right away. It can be called from any thread.
+  void Stop();
+
+ private:
+  // Handler index and deadline, ordered so that a std::priority_queue yields the earliest deadline first.
+  using Deadline = std::pair<double, int>;
+  using DeadlineQueue = std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>>;
+
+  // Queue of the handlers due to be updated by a worker.
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Deadline> tasks;
+  };
+
+  // @returns The deadline of the handler at @p index.
+  double GetDeadline(int index) const;
+
+  // Hands the handler at @p index with @p deadline over to the next worker.
+  void Dispatch(const Deadline& deadline);
+
+  // Takes the next task of the @p worker -th worker or, when its queue is empty, steals one from another worker.
+  // @returns True when a task was taken.
+  bool TakeTask(int worker, Deadline* task, Report* report);
+
+  // Runs the tasks of the @p worker -th worker until Run() finishes.
+  void RunWorker(int worker, Report* report);
+
+  const Timer* timer_{};
+  const double poll_period_{};
+  const double deadline_miss_tolerance_{};
+  std::vector<std::unique_ptr<DynamicEnvironmentHandler>> handlers_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  int next_worker_{0};
+
+  // Guards the members below. Workers wait on `worker_condition_` for tasks, and the thread that runs Run() waits on
+  // `driver_condition_` for the earliest deadline or for a worker to finish an update.
+  std::mutex mutex_;
+  std::condition_variable worker_condition_;
+  std::condition_variable driver_condition_;
+  // Deadlines of the handlers that are not being updated.
+  DeadlineQueue deadlines_;
+  std::exception_ptr first_exception_;
+  bool finished_{false};
+  // The flags below are only modified while holding `mutex_`, but workers read them without it.
+  std::atomic<bool> stopped_{false};
+  std::atomic<bool> failed_{false};
+  // Number of tasks queued in `workers_`. Dispatch() increments it while holding `mutex_`, so a worker that checks it
+  // before waiting on `worker_condition_` can't miss a new task. TakeTask() decrements it while holding only the lock
+  // of the queue it takes the task from; a stale count at most makes a worker look for tasks once more.
+  std::atomic<int> num_pending_tasks_{0};
+};
+
+}  // namespace integration
+}  // namespace maliput
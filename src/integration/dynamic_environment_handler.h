@@ -29,9 +29,17 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include <maliput/api/road_network.h>
 #include <maliput/common/maliput_copyable.h>
 
+#include "integration/dynamic_environment_changes.h"
 #include "integration/timer.h"
 
 namespace maliput {
@@ -39,8 +47,14 @@ namespace integration {
 
 /// Abstract API for managing the rules dynamic states of a maliput::api::RoadNetwork.
 /// The states are expected to change based on time.
+///
+/// Implementations that report their changes describe what every Update() call changed in last_changes() and hand it
+/// over to the subscribers whenever something changed.
 class DynamicEnvironmentHandler {
  public:
+  /// Callable that receives the changes made by an Update() call.
+  using ChangesCallback = std::function<void(const DynamicEnvironmentChanges&)>;
+
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentHandler)
   DynamicEnvironmentHandler() = delete;
 
@@ -49,6 +63,47 @@ class DynamicEnvironmentHandler {
   /// Updates the rule's states.
   virtual void Update() = 0;
 
+  /// @returns The time of the timer, in seconds, at which Update() is due to change the rule's states next, or
+  ///          std::nullopt when it is unknown. Once that time is reached, Update() must move it forward.
+  virtual std::optional<double> NextUpdateTime() const { return std::nullopt; }
+
+  /// Subscribes @p callback to the changes of every Update() call that changes any state. Callbacks are called in
+  /// subscription order, from the thread that calls Update().
+  ///
+  /// Callbacks may call Subscribe() and Unsubscribe(). A subscription made by a callback starts with the next
+  /// changes, and a subscription removed by a callback is not called again, not even for the current changes.
+  /// @returns An ID to Unsubscribe() with.
+  int Subscribe(ChangesCallback callback) {
+    (publishing_ ? pending_subscribers_ : subscribers_).emplace_back(next_subscription_id_, std::move(callback));
+    return next_subscription_id_++;
+  }
+
+  /// Removes the subscription @p subscription_id. Unknown IDs are ignored.
+  void Unsubscribe(int subscription_id) {
+    for (auto it = pending_subscribers_.begin(); it != pending_subscribers_.end(); ++it) {
+      if (it->first == subscription_id) {
+        pending_subscribers_.erase(it);
+        return;
+      }
+    }
+    for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+      if (it->first == subscription_id) {
+        // The subscribers can't be erased while PublishChanges() iterates over them, and the callback may be the one
+        // running. They are flagged instead, and erased once every callback returned.
+        if (publishing_) {
+          it->first = kUnsubscribed;
+        } else {
+          subscribers_.erase(it);
+        }
+        return;
+      }
+    }
+  }
+
+  /// @returns The changes made by the last Update() call. It is empty for implementations that don't report their
+  ///          changes.
+  const DynamicEnvironmentChanges& last_changes() const { return changes_; }
+
  protected:
   /// Creates DynamicEnvironmentHandler
   /// @param timer Timer implementation pointer.
@@ -59,8 +114,61 @@ class DynamicEnvironmentHandler {
     MALIPUT_THROW_UNLESS(timer_ != nullptr);
   }
 
+  /// Clears the changes of the previous Update() call. Implementations that report their changes call it when
+  /// Update() starts.
+  /// @returns The changes to fill in.
+  DynamicEnvironmentChanges* BeginChanges() {
+    changes_.Clear(timer_->Elapsed());
+    return &changes_;
+  }
+
+  /// Hands the changes over to the subscribers, unless nothing changed.
+  void PublishChanges() {
+    if (changes_.empty()) {
+      return;
+    }
+    // Subscribe() and Unsubscribe() defer their changes while publishing, so `subscribers_` keeps its size and the
+    // running callback is never moved nor destroyed.
+    publishing_ = true;
+    try {
+      for (size_t i = 0; i < subscribers_.size(); ++i) {
+        if (subscribers_[i].first != kUnsubscribed) {
+          subscribers_[i].second(changes_);
+        }
+      }
+    } catch (...) {
+      FinishPublishing();
+      throw;
+    }
+    FinishPublishing();
+  }
+
   const Timer* timer_{nullptr};
   api::RoadNetwork* road_network_{nullptr};
+
+ private:
+  // Subscription ID of the subscribers removed while publishing.
+  static constexpr int kUnsubscribed{-1};
+
+  // Applies the subscription changes deferred by PublishChanges().
+  void FinishPublishing() {
+    publishing_ = false;
+    subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                      [](const auto& subscriber) { return subscriber.first == kUnsubscribed; }),
+                       subscribers_.end());
+    if (!pending_subscribers_.empty()) {
+      subscribers_.insert(subscribers_.end(), std::make_move_iterator(pending_subscribers_.begin()),
+                          std::make_move_iterator(pending_subscribers_.end()));
+      pending_subscribers_.clear();
+    }
+  }
+
+  DynamicEnvironmentChanges changes_;
+  std::vector<std::pair<int, ChangesCallback>> subscribers_;
+  // Subscriptions made while publishing, which start with the next changes.
+  std::vector<std::pair<int, ChangesCallback>> pending_subscribers_;
+  bool publishing_{false};
+  int next_subscription_id_{0};
 };
 
 }  // namespace integration
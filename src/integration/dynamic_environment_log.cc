@@ -0,0 +1,323 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Magic number that heads every log.
+constexpr char kLogMagic[] = "MDEL";
+constexpr size_t kLogMagicSize{4};
+// Size of the magic number, version and byte order mark that head every log.
+constexpr size_t kLogHeaderSize{kLogMagicSize + 2 * sizeof(uint32_t)};
+
+// Type of the records that define a string.
+constexpr uint8_t kStringRecordType{0};
+// Size of the type and payload size that head every record.
+constexpr size_t kRecordHeaderSize{sizeof(uint8_t) + sizeof(uint32_t)};
+
+// Flags of a logged phase or rule state.
+constexpr uint8_t kHasNext{1};
+constexpr uint8_t kHasDurationUntil{2};
+
+// Smallest payload of every kind of logged state, used to bound the counts read from a log before reserving memory.
+// Strings take an index and states take at least their flags.
+constexpr size_t kMinPhaseSize{2 * sizeof(uint32_t) + sizeof(uint8_t)};
+constexpr size_t kMinDiscreteValueRuleStateSize{2 * sizeof(uint32_t) + sizeof(uint8_t)};
+constexpr size_t kMinRangeValueRuleStateSize{sizeof(uint32_t) + 2 * sizeof(double) + sizeof(uint8_t)};
+constexpr size_t kMinBulbStateSize{3 * sizeof(uint32_t) + sizeof(uint8_t)};
+
+// Appends the in-memory representation of @p value to @p target.
+template <typename T>
+void Append(const T& value, std::string* target) {
+  target->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// @returns The flags of a state whose next state is @p next_state.
+template <typename T>
+uint8_t GetFlags(const std::optional<T>& next_state, const std::optional<double>& duration_until) {
+  return (next_state.has_value() ? kHasNext : 0) |
+         (next_state.has_value() && duration_until.has_value() ? kHasDurationUntil : 0);
+}
+
+// Reads the values of a record payload, validating that they lie within it.
+class PayloadReader {
+ public:
+  PayloadReader(const std::string& data, size_t offset, size_t size, const std::vector<std::string>& strings)
+      : data_(data), offset_(offset), end_(offset + size), strings_(strings) {}
+
+  template <typename T>
+  T Read() {
+    MALIPUT_VALIDATE(offset_ + sizeof(T) <= end_, "Truncated dynamic environment log record.");
+    T value{};
+    std::memcpy(&value, data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  const std::string& ReadString() {
+    const uint32_t index = Read<uint32_t>();
+    MALIPUT_VALIDATE(index < strings_.size(), "Undefined string in dynamic environment log record.");
+    return strings_[index];
+  }
+
+  // Reads the number of entries of a list whose entries take at least @p min_entry_size bytes each.
+  // @throws maliput::common::assertion_error When the entries can't fit in the rest of the payload.
+  uint32_t ReadCount(size_t min_entry_size) {
+    const uint32_t count = Read<uint32_t>();
+    MALIPUT_VALIDATE(count <= (end_ - offset_) / min_entry_size, "Truncated dynamic environment log record.");
+    return count;
+  }
+
+ private:
+  const std::string& data_;
+  size_t offset_{};
+  const size_t end_{};
+  const std::vector<std::string>& strings_;
+};
+
+}  // namespace
+
+DynamicEnvironmentLogWriter::DynamicEnvironmentLogWriter(std::ostream* out) : out_(out) {
+  MALIPUT_THROW_UNLESS(out_ != nullptr);
+  out_->write(kLogMagic, kLogMagicSize);
+  out_->write(reinterpret_cast<const char*>(&kDynamicEnvironmentLogVersion), sizeof(kDynamicEnvironmentLogVersion));
+  out_->write(reinterpret_cast<const char*>(&kDynamicEnvironmentLogByteOrder), sizeof(kDynamicEnvironmentLogByteOrder));
+  MALIPUT_VALIDATE(out_->good(), "Failed to write the dynamic environment log.");
+  bytes_written_ = kLogHeaderSize;
+}
+
+void DynamicEnvironmentLogWriter::AppendString(const std::string& value) {
+  const auto it = string_indices_.emplace(value, static_cast<uint32_t>(string_indices_.size()));
+  if (it.second) {
+    buffer_.push_back(static_cast<char>(kStringRecordType));
+    Append(static_cast<uint32_t>(value.size()), &buffer_);
+    buffer_.append(value);
+  }
+  Append(it.first->second, &payload_);
+}
+
+void DynamicEnvironmentLogWriter::Write(const DynamicEnvironmentRecord& record) {
+  buffer_.clear();
+  payload_.clear();
+  Append(record.time, &payload_);
+  Append(static_cast<uint32_t>(record.phases.size()), &payload_);
+  for (const auto& phase : record.phases) {
+    AppendString(phase.first.string());
+    AppendString(phase.second.state.string());
+    const auto& next = phase.second.next;
+    const uint8_t flags = (next.has_value() ? kHasNext : 0) |
+                          (next.has_value() && next->duration_until.has_value() ? kHasDurationUntil : 0);
+    Append(flags, &payload_);
+    if (next.has_value()) {
+      AppendString(next->state.string());
+      if (next->duration_until.has_value()) {
+        Append(*next->duration_until, &payload_);
+      }
+    }
+  }
+  Append(static_cast<uint32_t>(record.discrete_value_rule_states.size()), &payload_);
+  for (const auto& state : record.discrete_value_rule_states) {
+    AppendString(state.first.string());
+    AppendString(state.second.state);
+    Append(GetFlags(state.second.next_state, state.second.duration_until), &payload_);
+    if (state.second.next_state.has_value()) {
+      AppendString(*state.second.next_state);
+      if (state.second.duration_until.has_value()) {
+        Append(*state.second.duration_until, &payload_);
+      }
+    }
+  }
+  Append(static_cast<uint32_t>(record.range_value_rule_states.size()), &payload_);
+  for (const auto& state : record.range_value_rule_states) {
+    AppendString(state.first.string());
+    Append(state.second.state.first, &payload_);
+    Append(state.second.state.second, &payload_);
+    Append(GetFlags(state.second.next_state, state.second.duration_until), &payload_);
+    if (state.second.next_state.has_value()) {
+      Append(state.second.next_state->first, &payload_);
+      Append(state.second.next_state->second, &payload_);
+      if (state.second.duration_until.has_value()) {
+        Append(*state.second.duration_until, &payload_);
+      }
+    }
+  }
+  Append(static_cast<uint32_t>(record.bulb_states.size()), &payload_);
+  for (const auto& bulb_state : record.bulb_states) {
+    AppendString(bulb_state.first.traffic_light_id().string());
+    AppendString(bulb_state.first.bulb_group_id().string());
+    AppendString(bulb_state.first.bulb_id().string());
+    Append(static_cast<uint8_t>(bulb_state.second), &payload_);
+  }
+
+  // New strings are defined ahead of the record that uses them.
+  buffer_.push_back(static_cast<char>(record.type));
+  Append(static_cast<uint32_t>(payload_.size()), &buffer_);
+  buffer_.append(payload_);
+  out_->write(buffer_.data(), buffer_.size());
+  MALIPUT_VALIDATE(out_->good(), "Failed to write the dynamic environment log.");
+  bytes_written_ += static_cast<int64_t>(buffer_.size());
+}
+
+void DynamicEnvironmentLogWriter::Flush() {
+  out_->flush();
+  MALIPUT_VALIDATE(out_->good(), "Failed to write the dynamic environment log.");
+}
+
+DynamicEnvironmentLogReader::DynamicEnvironmentLogReader(std::istream* in) {
+  MALIPUT_THROW_UNLESS(in != nullptr);
+  data_.assign(std::istreambuf_iterator<char>(*in), std::istreambuf_iterator<char>());
+  MALIPUT_VALIDATE(data_.size() >= kLogHeaderSize && data_.compare(0, kLogMagicSize, kLogMagic) == 0,
+                   "Invalid dynamic environment log.");
+  uint32_t version{};
+  std::memcpy(&version, data_.data() + kLogMagicSize, sizeof(version));
+  uint32_t byte_order{};
+  std::memcpy(&byte_order, data_.data() + kLogMagicSize + sizeof(version), sizeof(byte_order));
+  MALIPUT_VALIDATE(byte_order == kDynamicEnvironmentLogByteOrder,
+                   "Dynamic environment log has a different byte order.");
+  MALIPUT_VALIDATE(version == kDynamicEnvironmentLogVersion, "Unsupported dynamic environment log version.");
+  size_t offset = kLogHeaderSize;
+  while (offset < data_.size()) {
+    MALIPUT_VALIDATE(offset + kRecordHeaderSize <= data_.size(), "Truncated dynamic environment log.");
+    const uint8_t type = static_cast<uint8_t>(data_[offset]);
+    uint32_t size{};
+    std::memcpy(&size, data_.data() + offset + sizeof(uint8_t), sizeof(uint32_t));
+    offset += kRecordHeaderSize;
+    MALIPUT_VALIDATE(offset + size <= data_.size(), "Truncated dynamic environment log.");
+    if (type == kStringRecordType) {
+      strings_.emplace_back(data_, offset, size);
+    } else {
+      MALIPUT_VALIDATE(type == static_cast<uint8_t>(DynamicEnvironmentRecord::Type::kKeyframe) ||
+                           type == static_cast<uint8_t>(DynamicEnvironmentRecord::Type::kDelta),
+                       "Unknown dynamic environment log record type.");
+      const double time = PayloadReader(data_, offset, size, strings_).Read<double>();
+      MALIPUT_VALIDATE(records_.empty() || records_.back().time <= time,
+                       "Dynamic environment log records must be sorted by time.");
+      if (type == static_cast<uint8_t>(DynamicEnvironmentRecord::Type::kKeyframe)) {
+        keyframes_.push_back(static_cast<int>(records_.size()));
+      }
+      records_.push_back(RecordEntry{static_cast<DynamicEnvironmentRecord::Type>(type), time, offset, size});
+    }
+    offset += size;
+  }
+}
+
+int DynamicEnvironmentLogReader::FindKeyframe(double time) const {
+  if (keyframes_.empty()) {
+    return -1;
+  }
+  const auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), time,
+                                   [this](double t, int keyframe) { return t < records_[keyframe].time; });
+  return it == keyframes_.begin() ? keyframes_.front() : *std::prev(it);
+}
+
+DynamicEnvironmentRecord DynamicEnvironmentLogReader::Read(int index) const {
+  MALIPUT_THROW_UNLESS(index >= 0 && index < num_records());
+  const RecordEntry& entry = records_[index];
+  PayloadReader reader(data_, entry.offset, entry.size, strings_);
+  DynamicEnvironmentRecord record;
+  record.type = entry.type;
+  record.time = reader.Read<double>();
+  // Counts are bounded by the size of the record before reserving, so corrupt logs can't make it allocate more than
+  // the log itself takes.
+  const uint32_t num_phases = reader.ReadCount(kMinPhaseSize);
+  record.phases.reserve(num_phases);
+  for (uint32_t i = 0; i < num_phases; ++i) {
+    const api::rules::PhaseRing::Id phase_ring_id(reader.ReadString());
+    api::rules::PhaseProvider::Result result{api::rules::Phase::Id(reader.ReadString()), std::nullopt};
+    const uint8_t flags = reader.Read<uint8_t>();
+    if (flags & kHasNext) {
+      const api::rules::Phase::Id next_phase_id(reader.ReadString());
+      std::optional<double> duration_until;
+      if (flags & kHasDurationUntil) {
+        duration_until = reader.Read<double>();
+      }
+      result.next = api::rules::PhaseProvider::Result::Next{next_phase_id, duration_until};
+    }
+    record.phases.emplace_back(phase_ring_id, std::move(result));
+  }
+  const uint32_t num_discrete_value_rule_states = reader.ReadCount(kMinDiscreteValueRuleStateSize);
+  record.discrete_value_rule_states.reserve(num_discrete_value_rule_states);
+  for (uint32_t i = 0; i < num_discrete_value_rule_states; ++i) {
+    const api::rules::Rule::Id rule_id(reader.ReadString());
+    DynamicEnvironmentRecord::RuleState<std::string> state{reader.ReadString(), std::nullopt, std::nullopt};
+    const uint8_t flags = reader.Read<uint8_t>();
+    if (flags & kHasNext) {
+      state.next_state = reader.ReadString();
+      if (flags & kHasDurationUntil) {
+        state.duration_until = reader.Read<double>();
+      }
+    }
+    record.discrete_value_rule_states.emplace_back(rule_id, std::move(state));
+  }
+  const uint32_t num_range_value_rule_states = reader.ReadCount(kMinRangeValueRuleStateSize);
+  record.range_value_rule_states.reserve(num_range_value_rule_states);
+  for (uint32_t i = 0; i < num_range_value_rule_states; ++i) {
+    const api::rules::Rule::Id rule_id(reader.ReadString());
+    const double min = reader.Read<double>();
+    const double max = reader.Read<double>();
+    DynamicEnvironmentRecord::RuleState<std::pair<double, double>> state{{min, max}, std::nullopt, std::nullopt};
+    const uint8_t flags = reader.Read<uint8_t>();
+    if (flags & kHasNext) {
+      const double next_min = reader.Read<double>();
+      const double next_max = reader.Read<double>();
+      state.next_state = std::make_pair(next_min, next_max);
+      if (flags & kHasDurationUntil) {
+        state.duration_until = reader.Read<double>();
+      }
+    }
+    record.range_value_rule_states.emplace_back(rule_id, std::move(state));
+  }
+  const uint32_t num_bulb_states = reader.ReadCount(kMinBulbStateSize);
+  record.bulb_states.reserve(num_bulb_states);
+  for (uint32_t i = 0; i < num_bulb_states; ++i) {
+    const api::rules::TrafficLight::Id traffic_light_id(reader.ReadString());
+    const api::rules::BulbGroup::Id bulb_group_id(reader.ReadString());
+    const api::rules::Bulb::Id bulb_id(reader.ReadString());
+    const uint8_t state = reader.Read<uint8_t>();
+    MALIPUT_VALIDATE(state <= static_cast<uint8_t>(api::rules::BulbState::kBlinking),
+                     "Invalid bulb state in dynamic environment log record.");
+    record.bulb_states.emplace_back(api::rules::UniqueBulbId(traffic_light_id, bulb_group_id, bulb_id),
+                                    static_cast<api::rules::BulbState>(state));
+  }
+  return record;
+}
+
+}  // namespace integration
+}  // namespace maliput
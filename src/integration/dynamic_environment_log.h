@@ -0,0 +1,191 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/rules/phase_provider.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/rule.h>
+#include <maliput/api/rules/traffic_lights.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Entry of a dynamic environment log: the states of a maliput::api::RoadNetwork at a given time.
+///
+/// Rule states are logged by their value, which identifies them among the states of their rule in the rulebook.
+struct DynamicEnvironmentRecord {
+  /// State of a rule along with its next state, as given by its state provider.
+  /// @tparam T Representation of the states: the value of a discrete value rule state, or the minimum and maximum of
+  ///           a range value rule state.
+  template <typename T>
+  struct RuleState {
+    bool operator==(const RuleState& other) const {
+      return state == other.state && next_state == other.next_state && duration_until == other.duration_until;
+    }
+
+    /// Current state.
+    T state{};
+    /// Next state, if known.
+    std::optional<T> next_state;
+    /// Time until the next state, in seconds, if known.
+    std::optional<double> duration_until;
+  };
+
+  /// Kinds of records.
+  enum class Type : uint8_t {
+    /// Every state of the road network.
+    kKeyframe = 1,
+    /// The states that changed since the previous record.
+    kDelta = 2,
+  };
+
+  /// Kind of record.
+  Type type{Type::kDelta};
+  /// Time of the timer, in seconds.
+  double time{};
+  /// Phase rings along with their phase and next phase.
+  std::vector<std::pair<api::rules::PhaseRing::Id, api::rules::PhaseProvider::Result>> phases;
+  /// Discrete value rules along with the value of their state and next state.
+  std::vector<std::pair<api::rules::Rule::Id, RuleState<std::string>>> discrete_value_rule_states;
+  /// Range value rules along with the minimum and maximum of their state and next state.
+  std::vector<std::pair<api::rules::Rule::Id, RuleState<std::pair<double, double>>>> range_value_rule_states;
+  /// Bulbs along with their state.
+  std::vector<std::pair<api::rules::UniqueBulbId, api::rules::BulbState>> bulb_states;
+};
+
+/// Version of the dynamic environment log format.
+constexpr uint32_t kDynamicEnvironmentLogVersion{1};
+/// Byte order mark of the dynamic environment log format.
+constexpr uint32_t kDynamicEnvironmentLogByteOrder{0x01020304};
+
+/// Appends DynamicEnvironmentRecords to a binary log.
+///
+/// The log starts with the "MDEL" magic number, kDynamicEnvironmentLogVersion and kDynamicEnvironmentLogByteOrder as
+/// four-byte values, followed by a sequence of records, each made of a one-byte type, a four-byte payload size and
+/// the payload. Values are stored in the byte order of the machine that wrote the log, which the byte order mark
+/// records. IDs and rule values are interned:
+/// the first time a string is logged, a string record defines it and every later occurrence refers to it by index,
+/// so records only take a few bytes per state.
+///
+/// Records are written to the stream as they come, so they reach the file at the pace of the stream buffer; Flush()
+/// pushes them through.
+class DynamicEnvironmentLogWriter {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentLogWriter)
+  DynamicEnvironmentLogWriter() = delete;
+
+  /// Constructs a DynamicEnvironmentLogWriter and writes the header of the log to @p out.
+  /// @param out Output stream. It must not be nullptr and must outlive this writer.
+  /// @throws maliput::common::assertion_error When @p out is nullptr or the stream fails.
+  explicit DynamicEnvironmentLogWriter(std::ostream* out);
+
+  /// Appends @p record to the log with a single write to the stream.
+  /// @throws maliput::common::assertion_error When the stream fails.
+  void Write(const DynamicEnvironmentRecord& record);
+
+  /// Flushes the stream.
+  /// @throws maliput::common::assertion_error When the stream fails.
+  void Flush();
+
+  /// @returns The number of bytes written so far.
+  int64_t bytes_written() const { return bytes_written_; }
+
+ private:
+  // Appends the index of @p value to `payload_`, defining it first in `buffer_` when it is new.
+  void AppendString(const std::string& value);
+
+  std::ostream* out_{};
+  int64_t bytes_written_{0};
+  std::unordered_map<std::string, uint32_t> string_indices_;
+  // Buffers are kept across records to avoid allocating on every write.
+  std::string buffer_;
+  std::string payload_;
+};
+
+/// Reads a log written by DynamicEnvironmentLogWriter.
+///
+/// The whole log is loaded in memory and indexed once, so that records can be decoded in any order and the keyframe
+/// before any time can be found with a binary search.
+class DynamicEnvironmentLogReader {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentLogReader)
+  DynamicEnvironmentLogReader() = delete;
+
+  /// Loads and indexes the log in @p in.
+  /// @throws maliput::common::assertion_error When @p in is nullptr or doesn't hold a valid log, including logs of
+  ///         another version or written with another byte order.
+  explicit DynamicEnvironmentLogReader(std::istream* in);
+
+  /// @returns The number of records.
+  int num_records() const { return static_cast<int>(records_.size()); }
+
+  /// @returns The type of the @p index -th record.
+  DynamicEnvironmentRecord::Type type(int index) const { return records_[index].type; }
+
+  /// @returns The time of the @p index -th record.
+  double time(int index) const { return records_[index].time; }
+
+  /// @returns The index of the last keyframe whose time is not greater than @p time, or of the first keyframe when
+  ///          there is none such. -1 when the log has no keyframes.
+  int FindKeyframe(double time) const;
+
+  /// Decodes the @p index -th record.
+  /// @throws maliput::common::assertion_error When @p index is out of range or the record is malformed.
+  DynamicEnvironmentRecord Read(int index) const;
+
+ private:
+  // Location of a record within `data_`.
+  struct RecordEntry {
+    DynamicEnvironmentRecord::Type type{};
+    double time{};
+    // Offset of the payload, which starts with the time.
+    size_t offset{};
+    size_t size{};
+  };
+
+  std::string data_;
+  std::vector<std::string> strings_;
+  std::vector<RecordEntry> records_;
+  // Indices in `records_` of the keyframes.
+  std::vector<int> keyframes_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,194 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_recorder.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The logged form of @p result.
+DynamicEnvironmentRecord::RuleState<std::string> ToRuleState(
+    const api::rules::DiscreteValueRuleStateProvider::StateResult& result) {
+  DynamicEnvironmentRecord::RuleState<std::string> state{result.state.value, std::nullopt, std::nullopt};
+  if (result.next.has_value()) {
+    state.next_state = result.next->state.value;
+    state.duration_until = result.next->duration_until;
+  }
+  return state;
+}
+
+// @returns The logged form of @p result.
+DynamicEnvironmentRecord::RuleState<std::pair<double, double>> ToRuleState(
+    const api::rules::RangeValueRuleStateProvider::StateResult& result) {
+  DynamicEnvironmentRecord::RuleState<std::pair<double, double>> state{
+      {result.state.min, result.state.max}, std::nullopt, std::nullopt};
+  if (result.next.has_value()) {
+    state.next_state = std::make_pair(result.next->state.min, result.next->state.max);
+    state.duration_until = result.next->duration_until;
+  }
+  return state;
+}
+
+}  // namespace
+
+DynamicEnvironmentRecorder::DynamicEnvironmentRecorder(const Timer* timer, api::RoadNetwork* road_network,
+                                                       DynamicEnvironmentHandler* handler, std::ostream* out,
+                                                       int keyframe_interval)
+    : road_network_(road_network),
+      handler_(handler),
+      keyframe_interval_(keyframe_interval),
+      out_(out),
+      writer_(out) {
+  MALIPUT_THROW_UNLESS(timer != nullptr);
+  MALIPUT_THROW_UNLESS(road_network_ != nullptr);
+  MALIPUT_THROW_UNLESS(handler_ != nullptr);
+  MALIPUT_THROW_UNLESS(keyframe_interval_ > 0);
+  if (const api::rules::PhaseRingBook* phase_ring_book = road_network_->phase_ring_book()) {
+    for (const api::rules::PhaseRing::Id& phase_ring_id : phase_ring_book->GetPhaseRings()) {
+      const std::optional<api::rules::PhaseRing> phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
+      if (phase_ring.has_value()) {
+        phase_rings_.push_back(*phase_ring);
+      }
+    }
+  }
+  if (const api::rules::RoadRulebook* rulebook = road_network_->rulebook()) {
+    const auto rules = rulebook->Rules();
+    for (const auto& rule : rules.discrete_value_rules) {
+      discrete_value_rule_ids_.push_back(rule.first);
+    }
+    for (const auto& rule : rules.range_value_rules) {
+      range_value_rule_ids_.push_back(rule.first);
+    }
+  }
+  RecordKeyframe(timer->Elapsed());
+  subscription_id_ =
+      handler_->Subscribe([this](const DynamicEnvironmentChanges& changes) { this->Record(changes); });
+}
+
+DynamicEnvironmentRecorder::~DynamicEnvironmentRecorder() {
+  handler_->Unsubscribe(subscription_id_);
+  // Write errors can't be reported from here; Flush() reports them.
+  out_->flush();
+}
+
+void DynamicEnvironmentRecorder::Record(const DynamicEnvironmentChanges& changes) {
+  record_.type = DynamicEnvironmentRecord::Type::kDelta;
+  record_.time = changes.time;
+  record_.phases.clear();
+  record_.discrete_value_rule_states.clear();
+  record_.range_value_rule_states.clear();
+  record_.bulb_states.clear();
+  // The changes don't carry the next phases nor the next rule states, so they are queried from the providers.
+  for (const auto& phase_change : changes.phases) {
+    const auto result = road_network_->phase_provider()->GetPhase(phase_change.phase_ring_id);
+    if (result.has_value()) {
+      record_.phases.emplace_back(phase_change.phase_ring_id, *result);
+    }
+  }
+  const auto* discrete_value_rule_state_provider = road_network_->discrete_value_rule_state_provider();
+  for (const auto& state : changes.discrete_value_rule_states) {
+    const auto result = discrete_value_rule_state_provider != nullptr
+                            ? discrete_value_rule_state_provider->GetState(state.first)
+                            : std::nullopt;
+    record_.discrete_value_rule_states.emplace_back(
+        state.first, result.has_value() ? ToRuleState(*result)
+                                        : DynamicEnvironmentRecord::RuleState<std::string>{state.second.value,
+                                                                                           std::nullopt, std::nullopt});
+  }
+  const auto* range_value_rule_state_provider = road_network_->range_value_rule_state_provider();
+  for (const auto& state : changes.range_value_rule_states) {
+    const auto result = range_value_rule_state_provider != nullptr
+                            ? range_value_rule_state_provider->GetState(state.first)
+                            : std::nullopt;
+    record_.range_value_rule_states.emplace_back(
+        state.first, result.has_value() ? ToRuleState(*result)
+                                        : DynamicEnvironmentRecord::RuleState<std::pair<double, double>>{
+                                              {state.second.min, state.second.max}, std::nullopt, std::nullopt});
+  }
+  record_.bulb_states.insert(record_.bulb_states.end(), changes.bulb_states.begin(), changes.bulb_states.end());
+  writer_.Write(record_);
+  ++num_deltas_;
+  if (++num_deltas_since_keyframe_ >= keyframe_interval_) {
+    RecordKeyframe(changes.time);
+  }
+}
+
+void DynamicEnvironmentRecorder::RecordKeyframe(double time) {
+  record_.type = DynamicEnvironmentRecord::Type::kKeyframe;
+  record_.time = time;
+  record_.phases.clear();
+  record_.discrete_value_rule_states.clear();
+  record_.range_value_rule_states.clear();
+  record_.bulb_states.clear();
+  if (const api::rules::PhaseProvider* provider = road_network_->phase_provider()) {
+    for (const api::rules::PhaseRing& phase_ring : phase_rings_) {
+      const auto result = provider->GetPhase(phase_ring.id());
+      if (!result.has_value()) {
+        continue;
+      }
+      record_.phases.emplace_back(phase_ring.id(), *result);
+      const std::optional<api::rules::Phase> phase = phase_ring.GetPhase(result->state);
+      if (phase.has_value() && phase->bulb_states().has_value()) {
+        record_.bulb_states.insert(record_.bulb_states.end(), phase->bulb_states()->begin(),
+                                   phase->bulb_states()->end());
+      }
+    }
+  }
+  if (const auto* provider = road_network_->discrete_value_rule_state_provider()) {
+    for (const api::rules::Rule::Id& rule_id : discrete_value_rule_ids_) {
+      const auto result = provider->GetState(rule_id);
+      if (result.has_value()) {
+        record_.discrete_value_rule_states.emplace_back(rule_id, ToRuleState(*result));
+      }
+    }
+  }
+  if (const auto* provider = road_network_->range_value_rule_state_provider()) {
+    for (const api::rules::Rule::Id& rule_id : range_value_rule_ids_) {
+      const auto result = provider->GetState(rule_id);
+      if (result.has_value()) {
+        record_.range_value_rule_states.emplace_back(rule_id, ToRuleState(*result));
+      }
+    }
+  }
+  writer_.Write(record_);
+  // Keyframes are the points a replay can seek to, so the log is flushed up to them.
+  writer_.Flush();
+  ++num_keyframes_;
+  num_deltas_since_keyframe_ = 0;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/rule.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_changes.h"
+#include "integration/dynamic_environment_handler.h"
+#include "integration/dynamic_environment_log.h"
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// Records the states of a maliput::api::RoadNetwork, as changed by a DynamicEnvironmentHandler, to a binary log.
+/// See DynamicEnvironmentLogWriter for the format and DynamicEnvironmentReplayHandler to play it back.
+///
+/// A keyframe with every state is logged when the recorder is constructed and after every `keyframe_interval` deltas,
+/// so that replays can seek without going through the whole log. In between, every Update() call that changes any
+/// state logs a delta with the phases and rule states that changed, along with their next phase or state, and the
+/// bulb states that changed. A delta costs a single write to the stream and is proportional to the number of changes.
+/// The stream is flushed after every keyframe and by Flush(), and write errors throw. The destructor flushes the stream
+/// too but can't report errors, so call Flush() once recording is done.
+class DynamicEnvironmentRecorder {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentRecorder)
+  DynamicEnvironmentRecorder() = delete;
+
+  /// Constructs a DynamicEnvironmentRecorder, logs the first keyframe and subscribes it to @p handler.
+  ///
+  /// @param timer The timer @p handler is driven by. It must not be nullptr.
+  /// @param road_network The road network whose states are recorded. It must not be nullptr.
+  /// @param handler The handler that changes the states of @p road_network. It must not be nullptr and must outlive
+  ///                this recorder.
+  /// @param out Output stream. It must not be nullptr and must outlive this recorder.
+  /// @param keyframe_interval Number of deltas between keyframes. It must be positive.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met.
+  DynamicEnvironmentRecorder(const Timer* timer, api::RoadNetwork* road_network, DynamicEnvironmentHandler* handler,
+                             std::ostream* out, int keyframe_interval);
+
+  ~DynamicEnvironmentRecorder();
+
+  /// Flushes the stream.
+  /// @throws maliput::common::assertion_error When the stream fails.
+  void Flush() { writer_.Flush(); }
+
+  /// @returns The number of keyframes logged so far.
+  int num_keyframes() const { return num_keyframes_; }
+
+  /// @returns The number of deltas logged so far.
+  int num_deltas() const { return num_deltas_; }
+
+  /// @returns The number of bytes logged so far.
+  int64_t bytes_written() const { return writer_.bytes_written(); }
+
+ private:
+  // Logs @p changes as a delta.
+  void Record(const DynamicEnvironmentChanges& changes);
+
+  // Logs every state at @p time as a keyframe.
+  void RecordKeyframe(double time);
+
+  api::RoadNetwork* road_network_{};
+  DynamicEnvironmentHandler* handler_{};
+  const int keyframe_interval_{};
+  int subscription_id_{};
+  std::ostream* out_{};
+  DynamicEnvironmentLogWriter writer_;
+  // Reused across records to avoid allocating on every update.
+  DynamicEnvironmentRecord record_;
+  // Phase rings and rules of `road_network_`, gathered once for the keyframes.
+  std::vector<api::rules::PhaseRing> phase_rings_;
+  std::vector<api::rules::Rule::Id> discrete_value_rule_ids_;
+  std::vector<api::rules::Rule::Id> range_value_rule_ids_;
+  int num_keyframes_{0};
+  int num_deltas_{0};
+  int num_deltas_since_keyframe_{0};
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,174 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_replay_handler.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The state of @p rule whose value is @p value.
+// @throws maliput::common::assertion_error When @p rule has no such state.
+const api::rules::DiscreteValueRule::DiscreteValue& FindState(const api::rules::DiscreteValueRule& rule,
+                                                              const std::string& value) {
+  const auto it = std::find_if(rule.states().begin(), rule.states().end(),
+                               [&value](const auto& rule_state) { return rule_state.value == value; });
+  MALIPUT_VALIDATE(it != rule.states().end(), "Rule " + rule.id().string() + " has no state with value " + value + ".");
+  return *it;
+}
+
+// @returns The state of @p rule whose minimum and maximum are @p range.
+// @throws maliput::common::assertion_error When @p rule has no such state.
+const api::rules::RangeValueRule::Range& FindState(const api::rules::RangeValueRule& rule,
+                                                   const std::pair<double, double>& range) {
+  const auto it = std::find_if(rule.states().begin(), rule.states().end(), [&range](const auto& rule_state) {
+    return rule_state.min == range.first && rule_state.max == range.second;
+  });
+  MALIPUT_VALIDATE(it != rule.states().end(), "Rule " + rule.id().string() + " has no such range.");
+  return *it;
+}
+
+}  // namespace
+
+DynamicEnvironmentReplayHandler::DynamicEnvironmentReplayHandler(const Timer* timer, api::RoadNetwork* road_network,
+                                                                 std::istream* log, Speed speed)
+    : DynamicEnvironmentHandler(timer, road_network),
+      speed_(speed),
+      phase_provider_(dynamic_cast<ManualPhaseProvider*>(road_network_->phase_provider())),
+      discrete_value_rule_state_provider_(
+          dynamic_cast<ManualDiscreteValueRuleStateProvider*>(road_network_->discrete_value_rule_state_provider())),
+      range_value_rule_state_provider_(
+          dynamic_cast<ManualRangeValueRuleStateProvider*>(road_network_->range_value_rule_state_provider())),
+      rules_(road_network_->rulebook() != nullptr ? road_network_->rulebook()->Rules()
+                                                  : api::rules::RoadRulebook::QueryResults{}),
+      reader_(log) {
+  MALIPUT_VALIDATE(reader_.FindKeyframe(0.) >= 0, "The dynamic environment log has no keyframe.");
+  Seek(reader_.time(0));
+}
+
+void DynamicEnvironmentReplayHandler::Update() {
+  DynamicEnvironmentChanges* changes = BeginChanges();
+  if (speed_ == Speed::kMaximum) {
+    if (!finished()) {
+      Apply(reader_.Read(next_record_), changes);
+      log_time_ = reader_.time(next_record_++);
+      SkipKeyframes();
+    }
+  } else {
+    const double now = timer_->Elapsed() + time_offset_;
+    while (!finished() && reader_.time(next_record_) <= now) {
+      Apply(reader_.Read(next_record_), changes);
+      log_time_ = reader_.time(next_record_++);
+      changes->deadlines.push_back(log_time_ - time_offset_);
+      SkipKeyframes();
+    }
+  }
+  changes->time = log_time_;
+  PublishChanges();
+}
+
+std::optional<double> DynamicEnvironmentReplayHandler::NextUpdateTime() const {
+  if (finished()) {
+    return std::nullopt;
+  }
+  return speed_ == Speed::kMaximum ? timer_->Elapsed() : reader_.time(next_record_) - time_offset_;
+}
+
+void DynamicEnvironmentReplayHandler::Seek(double time) {
+  const int keyframe = reader_.FindKeyframe(time);
+  time = std::max(time, reader_.time(keyframe));
+  DynamicEnvironmentChanges* changes = BeginChanges();
+  Apply(reader_.Read(keyframe), changes);
+  log_time_ = reader_.time(keyframe);
+  next_record_ = keyframe + 1;
+  SkipKeyframes();
+  while (!finished() && reader_.time(next_record_) <= time) {
+    Apply(reader_.Read(next_record_), changes);
+    log_time_ = reader_.time(next_record_++);
+    SkipKeyframes();
+  }
+  time_offset_ = time - timer_->Elapsed();
+  changes->time = log_time_;
+  PublishChanges();
+}
+
+void DynamicEnvironmentReplayHandler::SkipKeyframes() {
+  while (!finished() && reader_.type(next_record_) == DynamicEnvironmentRecord::Type::kKeyframe) {
+    ++next_record_;
+  }
+}
+
+void DynamicEnvironmentReplayHandler::Apply(const DynamicEnvironmentRecord& record,
+                                            DynamicEnvironmentChanges* changes) {
+  for (const auto& phase : record.phases) {
+    MALIPUT_VALIDATE(phase_provider_ != nullptr, "Replaying phases requires a ManualPhaseProvider.");
+    const auto& next = phase.second.next;
+    phase_provider_->SetPhase(phase.first, phase.second.state,
+                              next.has_value() ? std::make_optional(next->state) : std::nullopt,
+                              next.has_value() ? next->duration_until : std::nullopt);
+    changes->phases.push_back({phase.first, phase.second.state});
+  }
+  for (const auto& state : record.discrete_value_rule_states) {
+    MALIPUT_VALIDATE(discrete_value_rule_state_provider_ != nullptr,
+                     "Replaying discrete value rule states requires a ManualDiscreteValueRuleStateProvider.");
+    const auto rule = rules_.discrete_value_rules.find(state.first);
+    MALIPUT_VALIDATE(rule != rules_.discrete_value_rules.end(), "Unknown rule in log: " + state.first.string());
+    const api::rules::DiscreteValueRule::DiscreteValue& rule_state = FindState(rule->second, state.second.state);
+    discrete_value_rule_state_provider_->SetState(
+        state.first, rule_state,
+        state.second.next_state.has_value() ? std::make_optional(FindState(rule->second, *state.second.next_state))
+                                            : std::nullopt,
+        state.second.duration_until);
+    changes->discrete_value_rule_states.emplace_back(state.first, rule_state);
+  }
+  for (const auto& state : record.range_value_rule_states) {
+    MALIPUT_VALIDATE(range_value_rule_state_provider_ != nullptr,
+                     "Replaying range value rule states requires a ManualRangeValueRuleStateProvider.");
+    const auto rule = rules_.range_value_rules.find(state.first);
+    MALIPUT_VALIDATE(rule != rules_.range_value_rules.end(), "Unknown rule in log: " + state.first.string());
+    const api::rules::RangeValueRule::Range& rule_state = FindState(rule->second, state.second.state);
+    range_value_rule_state_provider_->SetState(
+        state.first, rule_state,
+        state.second.next_state.has_value() ? std::make_optional(FindState(rule->second, *state.second.next_state))
+                                            : std::nullopt,
+        state.second.duration_until);
+    changes->range_value_rule_states.emplace_back(state.first, rule_state);
+  }
+  changes->bulb_states.insert(changes->bulb_states.end(), record.bulb_states.begin(), record.bulb_states.end());
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,124 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <istream>
+#include <optional>
+
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/road_rulebook.h>
+#include <maliput/base/manual_discrete_value_rule_state_provider.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/base/manual_range_value_rule_state_provider.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_handler.h"
+#include "integration/dynamic_environment_log.h"
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// DynamicEnvironmentHandler class implementation.
+/// Plays back a log written by a DynamicEnvironmentRecorder, setting the recorded phases and rule states on the
+/// providers of the road network, which must be the one the log was recorded from. Bulb states follow from the phases
+/// and are only reported in the changes.
+///
+/// The changes it publishes are stamped with the time of the log. Logs can be played at their original pace or as fast
+/// as Update() is called, and Seek() jumps to any time by starting from the keyframe before it.
+class DynamicEnvironmentReplayHandler : public DynamicEnvironmentHandler {
+ public:
+  /// Pace of the replay.
+  enum class Speed {
+    /// Records are applied when the timer reaches their time, relative to the last Seek().
+    kRealTime,
+    /// Every Update() call applies the next record.
+    kMaximum,
+  };
+
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentReplayHandler)
+  DynamicEnvironmentReplayHandler() = delete;
+
+  /// Constructs a DynamicEnvironmentReplayHandler and seeks the start of the log.
+  ///
+  /// @param timer Timer implementation pointer.
+  /// @param road_network maliput::api::RoadNetwork pointer. Its providers must be a maliput::ManualPhaseProvider, a
+  ///        maliput::ManualDiscreteValueRuleStateProvider and a maliput::ManualRangeValueRuleStateProvider when the log
+  ///        has states of that kind.
+  /// @param log Input stream with the log. It must not be nullptr and is fully read by the constructor.
+  /// @param speed Pace of the replay.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met, the log has no keyframe or
+  ///         it holds states that the rulebook of @p road_network doesn't have.
+  DynamicEnvironmentReplayHandler(const Timer* timer, api::RoadNetwork* road_network, std::istream* log, Speed speed);
+
+  ~DynamicEnvironmentReplayHandler() override = default;
+
+  void Update() override;
+
+  /// @returns The time of the timer at which the next record is due, or std::nullopt at the end of the log.
+  std::optional<double> NextUpdateTime() const override;
+
+  /// Sets the states recorded at @p time, as of the last record that is not later than it, and publishes all of them
+  /// as a single change. Replay continues from there.
+  /// @param time Time of the log, in seconds. Times before the start of the log seek its start.
+  void Seek(double time);
+
+  /// @returns The time of the log that has been replayed so far, in seconds.
+  double log_time() const { return log_time_; }
+
+  /// @returns Whether every record has been replayed.
+  bool finished() const { return next_record_ >= reader_.num_records(); }
+
+ private:
+  // Sets the states of @p record and appends them to @p changes.
+  void Apply(const DynamicEnvironmentRecord& record, DynamicEnvironmentChanges* changes);
+
+  // Moves `next_record_` past the keyframes, which carry nothing new while replaying in order.
+  void SkipKeyframes();
+
+  const Speed speed_{};
+  // The providers of `road_network_`, nullptr when they are not manual ones.
+  ManualPhaseProvider* phase_provider_{};
+  ManualDiscreteValueRuleStateProvider* discrete_value_rule_state_provider_{};
+  ManualRangeValueRuleStateProvider* range_value_rule_state_provider_{};
+  // Rules of `road_network_`, to resolve the logged states.
+  api::rules::RoadRulebook::QueryResults rules_;
+  DynamicEnvironmentLogReader reader_;
+  // Index of the next record to apply.
+  int next_record_{0};
+  // Time of the log minus time of the timer.
+  double time_offset_{0.};
+  double log_time_{0.};
+};
+
+}  // namespace integration
+}  // namespace maliput
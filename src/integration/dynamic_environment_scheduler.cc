@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+DynamicEnvironmentScheduler::DynamicEnvironmentScheduler(const Timer* timer, DynamicEnvironmentHandler* handler,
+                                                         double poll_period, double deadline_miss_tolerance)
+    : timer_(timer), handler_(handler), poll_period_(poll_period), stats_(deadline_miss_tolerance) {
+  MALIPUT_THROW_UNLESS(timer_ != nullptr);
+  MALIPUT_THROW_UNLESS(handler_ != nullptr);
+  MALIPUT_THROW_UNLESS(poll_period_ > 0.);
+}
+
+bool DynamicEnvironmentScheduler::WaitAndUpdate(double end_time) {
+  const double start_time = timer_->Elapsed();
+  const std::optional<double> next_update_time = handler_->NextUpdateTime();
+  const double deadline = next_update_time.value_or(start_time + poll_period_);
+  const double wake_up_time = std::min(deadline, end_time);
+  double wait_duration{0.};
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Spurious and early wake-ups go back to sleep for the remaining time.
+    for (double now = timer_->Elapsed(); !stopped_ && now < wake_up_time;) {
+      condition_.wait_for(lock, std::chrono::duration<double>(wake_up_time - now));
+      const double wake_up = timer_->Elapsed();
+      wait_duration += wake_up - now;
+      now = wake_up;
+    }
+    if (stopped_ || deadline > end_time) {
+      return false;
+    }
+  }
+  const double update_start_time = timer_->Elapsed();
+  last_update_delay_ = update_start_time - deadline;
+  handler_->Update();
+  const double update_end_time = timer_->Elapsed();
+  // The time spent by the caller between two calls is part of the loop as well.
+  const double loop_start_time = last_update_end_time_.value_or(start_time);
+  stats_.AddUpdate(update_end_time - update_start_time, update_start_time - loop_start_time - wait_duration);
+  stats_.AddTransitions(handler_->last_changes(), next_update_time, update_start_time);
+  last_update_end_time_ = update_end_time;
+  return true;
+}
+
+void DynamicEnvironmentScheduler::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_all();
+}
+
+}  // namespace integration
+}  // namespace maliput
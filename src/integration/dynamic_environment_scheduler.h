@@ -0,0 +1,103 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_handler.h"
+#include "integration/timer.h"
+#include "integration/update_latency_stats.h"
+
+namespace maliput {
+namespace integration {
+
+/// Drives a DynamicEnvironmentHandler from the deadlines it reports.
+///
+/// Instead of polling the handler at a fixed rate, WaitAndUpdate() sleeps until the
+/// DynamicEnvironmentHandler::NextUpdateTime() of the handler and only then calls DynamicEnvironmentHandler::Update().
+/// Handlers that report no deadline are updated every `poll_period` seconds instead.
+///
+/// Every update is recorded in an UpdateLatencyStats: how late every transition it applied is with respect to its
+/// deadline, as reported in DynamicEnvironmentChanges::deadlines, how long the update took and the loop overhead, i.e.
+/// the time since the previous update that was spent neither waiting nor updating.
+class DynamicEnvironmentScheduler {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentScheduler)
+  DynamicEnvironmentScheduler() = delete;
+
+  /// Constructs a DynamicEnvironmentScheduler.
+  /// @param timer The timer @p handler is driven by. It must not be nullptr.
+  /// @param handler The DynamicEnvironmentHandler to update. It must not be nullptr.
+  /// @param poll_period Update period of handlers that report no deadline, in seconds. It must be positive.
+  /// @param deadline_miss_tolerance Lateness, in seconds, above which a transition counts as a missed deadline. It must
+  ///                                be non-negative. By default, every late transition does.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met.
+  DynamicEnvironmentScheduler(const Timer* timer, DynamicEnvironmentHandler* handler, double poll_period,
+                              double deadline_miss_tolerance = 0.);
+
+  /// Sleeps until the next deadline of the handler and updates it.
+  ///
+  /// @param end_time Time of the timer, in seconds, after which no update is done.
+  /// @returns True when the handler was updated. False when @p end_time came before the next deadline, in which case
+  ///          the call returns at @p end_time, or Stop() was called.
+  bool WaitAndUpdate(double end_time);
+
+  /// Wakes up a blocked WaitAndUpdate() call and makes every following one return false right away.
+  /// It can be called from any thread.
+  void Stop();
+
+  /// @returns The time between the deadline of the last update and the actual update, in seconds.
+  double last_update_delay() const { return last_update_delay_; }
+
+  /// @returns The statistics of the updates since construction or the last ResetStats() call.
+  const UpdateLatencyStats& stats() const { return stats_; }
+
+  /// Clears stats(), e.g. to report them periodically.
+  void ResetStats() { stats_.Clear(); }
+
+ private:
+  const Timer* timer_{};
+  DynamicEnvironmentHandler* handler_{};
+  const double poll_period_{};
+  double last_update_delay_{};
+  UpdateLatencyStats stats_;
+  // Time at which the last update returned, from which the loop overhead of the next one is measured.
+  std::optional<double> last_update_end_time_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopped_{false};
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,207 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_snapshot.h"
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring_book.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The value of @p key in @p map, if any.
+template <typename Map>
+std::optional<typename Map::mapped_type> Find(const Map& map, const typename Map::key_type& key) {
+  const auto it = map.find(key);
+  if (it == map.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+// @returns The phase @p phase_id of @p phase_ring_id in @p phase_ring_book, if any.
+std::optional<api::rules::Phase> FindPhase(const api::rules::PhaseRingBook* phase_ring_book,
+                                           const api::rules::PhaseRing::Id& phase_ring_id,
+                                           const api::rules::Phase::Id& phase_id) {
+  if (phase_ring_book == nullptr) {
+    return std::nullopt;
+  }
+  const std::optional<api::rules::PhaseRing> phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
+  return phase_ring.has_value() ? phase_ring->GetPhase(phase_id) : std::nullopt;
+}
+
+// @returns The current states of @p road_network. The bulbs set by the current phase of every phase ring are stored in
+//          @p phase_bulbs.
+DynamicEnvironmentSnapshot MakeSnapshot(
+    api::RoadNetwork* road_network, double time,
+    std::unordered_map<api::rules::PhaseRing::Id, std::vector<api::rules::UniqueBulbId>>* phase_bulbs) {
+  DynamicEnvironmentSnapshot snapshot;
+  snapshot.time = time;
+  const api::rules::RoadRulebook::QueryResults rules = road_network->rulebook()->Rules();
+  if (const auto* provider = road_network->discrete_value_rule_state_provider()) {
+    for (const auto& rule : rules.discrete_value_rules) {
+      const auto result = provider->GetState(rule.first);
+      if (result.has_value()) {
+        snapshot.discrete_value_rule_states.emplace(rule.first, result->state);
+      }
+    }
+  }
+  if (const auto* provider = road_network->range_value_rule_state_provider()) {
+    for (const auto& rule : rules.range_value_rules) {
+      const auto result = provider->GetState(rule.first);
+      if (result.has_value()) {
+        snapshot.range_value_rule_states.emplace(rule.first, result->state);
+      }
+    }
+  }
+  const auto* phase_ring_book = road_network->phase_ring_book();
+  const auto* phase_provider = road_network->phase_provider();
+  if (phase_ring_book != nullptr && phase_provider != nullptr) {
+    for (const auto& phase_ring_id : phase_ring_book->GetPhaseRings()) {
+      const auto result = phase_provider->GetPhase(phase_ring_id);
+      if (!result.has_value()) {
+        continue;
+      }
+      snapshot.phases.emplace(phase_ring_id, *result);
+      const auto phase = FindPhase(phase_ring_book, phase_ring_id, result->state);
+      if (phase.has_value() && phase->bulb_states().has_value()) {
+        std::vector<api::rules::UniqueBulbId>& bulbs = (*phase_bulbs)[phase_ring_id];
+        for (const auto& bulb_state : *phase->bulb_states()) {
+          snapshot.bulb_states.insert(bulb_state);
+          bulbs.push_back(bulb_state.first);
+        }
+      }
+    }
+  }
+  return snapshot;
+}
+
+}  // namespace
+
+DynamicEnvironmentSnapshotPublisher::DynamicEnvironmentSnapshotPublisher(api::RoadNetwork* road_network,
+                                                                         DynamicEnvironmentHandler* handler)
+    : road_network_(road_network), handler_(handler) {
+  MALIPUT_THROW_UNLESS(road_network_ != nullptr);
+  MALIPUT_THROW_UNLESS(handler_ != nullptr);
+  snapshot_ = std::make_unique<LeftRight<DynamicEnvironmentSnapshot>>(
+      MakeSnapshot(road_network_, handler_->last_changes().time, &phase_bulbs_));
+  subscription_id_ = handler_->Subscribe([this](const DynamicEnvironmentChanges& changes) { Publish(changes); });
+}
+
+DynamicEnvironmentSnapshotPublisher::~DynamicEnvironmentSnapshotPublisher() { handler_->Unsubscribe(subscription_id_); }
+
+std::optional<api::rules::PhaseProvider::Result> DynamicEnvironmentSnapshotPublisher::GetPhase(
+    const api::rules::PhaseRing::Id& phase_ring_id) const {
+  return Read([&phase_ring_id](const DynamicEnvironmentSnapshot& snapshot) {
+    return Find(snapshot.phases, phase_ring_id);
+  });
+}
+
+std::optional<api::rules::DiscreteValueRule::DiscreteValue>
+DynamicEnvironmentSnapshotPublisher::GetDiscreteValueRuleState(const api::rules::Rule::Id& rule_id) const {
+  return Read([&rule_id](const DynamicEnvironmentSnapshot& snapshot) {
+    return Find(snapshot.discrete_value_rule_states, rule_id);
+  });
+}
+
+std::optional<api::rules::RangeValueRule::Range> DynamicEnvironmentSnapshotPublisher::GetRangeValueRuleState(
+    const api::rules::Rule::Id& rule_id) const {
+  return Read([&rule_id](const DynamicEnvironmentSnapshot& snapshot) {
+    return Find(snapshot.range_value_rule_states, rule_id);
+  });
+}
+
+std::optional<api::rules::BulbState> DynamicEnvironmentSnapshotPublisher::GetBulbState(
+    const api::rules::UniqueBulbId& bulb_id) const {
+  return Read([&bulb_id](const DynamicEnvironmentSnapshot& snapshot) { return Find(snapshot.bulb_states, bulb_id); });
+}
+
+void DynamicEnvironmentSnapshotPublisher::Publish(const DynamicEnvironmentChanges& changes) {
+  // The phase provider and the phase ring book are queried once, from the updating thread, so that both snapshots get
+  // the same results.
+  std::vector<std::pair<api::rules::PhaseRing::Id, api::rules::PhaseProvider::Result>> phases;
+  phases.reserve(changes.phases.size());
+  // Bulbs set by the previous phases that the new ones don't set, and states of the bulbs set by the new phases.
+  std::vector<api::rules::UniqueBulbId> unset_bulbs;
+  std::vector<std::pair<api::rules::UniqueBulbId, api::rules::BulbState>> phase_bulb_states;
+  for (const auto& phase_change : changes.phases) {
+    const auto result = road_network_->phase_provider()->GetPhase(phase_change.phase_ring_id);
+    if (result.has_value()) {
+      phases.emplace_back(phase_change.phase_ring_id, *result);
+    }
+    const auto phase = FindPhase(road_network_->phase_ring_book(), phase_change.phase_ring_id, phase_change.phase_id);
+    const std::optional<api::rules::BulbStates> bulb_states =
+        phase.has_value() ? phase->bulb_states() : std::optional<api::rules::BulbStates>{};
+    std::vector<api::rules::UniqueBulbId>& bulbs = phase_bulbs_[phase_change.phase_ring_id];
+    for (const auto& bulb_id : bulbs) {
+      if (!bulb_states.has_value() || bulb_states->count(bulb_id) == 0) {
+        unset_bulbs.push_back(bulb_id);
+      }
+    }
+    bulbs.clear();
+    if (bulb_states.has_value()) {
+      for (const auto& bulb_state : *bulb_states) {
+        bulbs.push_back(bulb_state.first);
+        phase_bulb_states.push_back(bulb_state);
+      }
+    }
+  }
+  snapshot_->Modify([&changes, &phases, &unset_bulbs, &phase_bulb_states](DynamicEnvironmentSnapshot* snapshot) {
+    snapshot->time = changes.time;
+    for (const auto& phase : phases) {
+      snapshot->phases.insert_or_assign(phase.first, phase.second);
+    }
+    for (const auto& state : changes.discrete_value_rule_states) {
+      snapshot->discrete_value_rule_states.insert_or_assign(state.first, state.second);
+    }
+    for (const auto& state : changes.range_value_rule_states) {
+      snapshot->range_value_rule_states.insert_or_assign(state.first, state.second);
+    }
+    // Bulbs are unset before setting the new ones, so that a bulb moved from a phase ring to another one is kept.
+    for (const auto& bulb_id : unset_bulbs) {
+      snapshot->bulb_states.erase(bulb_id);
+    }
+    for (const auto& bulb_state : phase_bulb_states) {
+      snapshot->bulb_states.insert_or_assign(bulb_state.first, bulb_state.second);
+    }
+    for (const auto& bulb_state : changes.bulb_states) {
+      snapshot->bulb_states.insert_or_assign(bulb_state.first, bulb_state.second);
+    }
+  });
+}
+
+}  // namespace integration
+}  // namespace maliput
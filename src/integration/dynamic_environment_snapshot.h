@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase_provider.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/traffic_lights.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_changes.h"
+#include "integration/dynamic_environment_handler.h"
+#include "integration/left_right.h"
+
+namespace maliput {
+namespace integration {
+
+/// States of the rules, phases and bulbs of a maliput::api::RoadNetwork at a given time.
+struct DynamicEnvironmentSnapshot {
+  /// Time of the timer at which the states were last changed, in seconds.
+  double time{};
+  /// Phase of every phase ring.
+  std::unordered_map<api::rules::PhaseRing::Id, api::rules::PhaseProvider::Result> phases;
+  /// State of every discrete value rule.
+  std::unordered_map<api::rules::Rule::Id, api::rules::DiscreteValueRule::DiscreteValue> discrete_value_rule_states;
+  /// State of every range value rule.
+  std::unordered_map<api::rules::Rule::Id, api::rules::RangeValueRule::Range> range_value_rule_states;
+  /// State of every bulb set by the current phases.
+  std::unordered_map<api::rules::UniqueBulbId, api::rules::BulbState> bulb_states;
+};
+
+/// Keeps a DynamicEnvironmentSnapshot of a maliput::api::RoadNetwork up to date with the changes published by a
+/// DynamicEnvironmentHandler, so that any number of threads can query the states while another one calls
+/// DynamicEnvironmentHandler::Update().
+///
+/// The state providers of the road network offer no concurrency guarantees, so they are only queried from the thread
+/// that updates the handler. Snapshots are kept in a LeftRight: readers are wait-free and always see the states as
+/// they were after a whole Update() call, never halfway through one.
+class DynamicEnvironmentSnapshotPublisher {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicEnvironmentSnapshotPublisher)
+  DynamicEnvironmentSnapshotPublisher() = delete;
+
+  /// Constructs a DynamicEnvironmentSnapshotPublisher with the current states of @p road_network and subscribes it to
+  /// @p handler. It must be constructed from the thread that updates @p handler.
+  ///
+  /// @param road_network The road network whose states are published. It must not be nullptr.
+  /// @param handler The handler that changes the states of @p road_network. It must not be nullptr and must outlive
+  ///                this publisher.
+  /// @throws maliput::common::assertion_error When @p road_network or @p handler is nullptr.
+  DynamicEnvironmentSnapshotPublisher(api::RoadNetwork* road_network, DynamicEnvironmentHandler* handler);
+
+  ~DynamicEnvironmentSnapshotPublisher();
+
+  /// Calls @p function with the latest snapshot. It can be called from any thread.
+  ///
+  /// @p function must not keep references to the snapshot once it returns.
+  /// @returns The value returned by @p function.
+  template <typename Function>
+  auto Read(Function&& function) const {
+    return snapshot_->Read(std::forward<Function>(function));
+  }
+
+  /// @returns The phase of @p phase_ring_id, if known. It can be called from any thread.
+  std::optional<api::rules::PhaseProvider::Result> GetPhase(const api::rules::PhaseRing::Id& phase_ring_id) const;
+
+  /// @returns The state of @p rule_id, if known. It can be called from any thread.
+  std::optional<api::rules::DiscreteValueRule::DiscreteValue> GetDiscreteValueRuleState(
+      const api::rules::Rule::Id& rule_id) const;
+
+  /// @returns The state of @p rule_id, if known. It can be called from any thread.
+  std::optional<api::rules::RangeValueRule::Range> GetRangeValueRuleState(const api::rules::Rule::Id& rule_id) const;
+
+  /// @returns The state of @p bulb_id, if set by a current phase. It can be called from any thread.
+  std::optional<api::rules::BulbState> GetBulbState(const api::rules::UniqueBulbId& bulb_id) const;
+
+ private:
+  // Applies @p changes to the snapshots.
+  void Publish(const DynamicEnvironmentChanges& changes);
+
+  api::RoadNetwork* road_network_{};
+  DynamicEnvironmentHandler* handler_{};
+  int subscription_id_{};
+  std::unique_ptr<LeftRight<DynamicEnvironmentSnapshot>> snapshot_;
+  // Bulbs set by the current phase of every phase ring. It is only used from the thread that updates handler_.
+  std::unordered_map<api::rules::PhaseRing::Id, std::vector<api::rules::UniqueBulbId>> phase_bulbs_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -29,33 +29,39 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "integration/fixed_phase_iteration_handler.h"
 
-#include <maliput/base/manual_phase_provider.h>
+#include <maliput/common/maliput_throw.h>
 
 namespace maliput {
 namespace integration {
 
+FixedPhaseIterationHandler::FixedPhaseIterationHandler(const Timer* timer, api::RoadNetwork* road_network,
+                                                       double phase_duration)
+    : DynamicEnvironmentHandler(timer, road_network),
+      phase_duration_(phase_duration),
+      phase_provider_(dynamic_cast<ManualPhaseProvider*>(road_network_->phase_provider())),
+      phase_ring_table_(road_network_->phase_ring_book(), road_network_->phase_provider()) {
+  MALIPUT_THROW_UNLESS(phase_duration > 0.);
+}
+
 void FixedPhaseIterationHandler::Update() {
-  if (!(timer_->Elapsed() - last_elapsed_time_ > phase_duration_)) {
+  DynamicEnvironmentChanges* changes = BeginChanges();
+  const double elapsed_time = changes->time;
+  const double next_update_time = last_elapsed_time_ + phase_duration_;
+  if (elapsed_time < next_update_time) {
     return;
   }
-  last_elapsed_time_ = timer_->Elapsed();
+  // Keeps the phases aligned with their schedule, unless the updates fell behind by more than a phase.
+  last_elapsed_time_ = elapsed_time - next_update_time < phase_duration_ ? next_update_time : elapsed_time;
 
-  auto phase_provider = dynamic_cast<ManualPhaseProvider*>(road_network_->phase_provider());
-  const auto phase_ring_book = road_network_->phase_ring_book();
-  for (const auto& phase_ring_id : phase_ring_book->GetPhaseRings()) {
-    const auto phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
-    const auto phase_provider_result = phase_provider->GetPhase(phase_ring_id);
-    MALIPUT_THROW_UNLESS(phase_provider_result != std::nullopt);
-
-    if (!phase_provider_result->next.has_value()) {
-      continue;
+  MALIPUT_THROW_UNLESS(phase_provider_ != nullptr);
+  for (int i = 0; i < phase_ring_table_.num_phase_rings(); ++i) {
+    if (const PhaseStateChanges* state_changes = phase_ring_table_.Advance(i, phase_provider_)) {
+      changes->Append(phase_ring_table_.phase_ring_id(i), phase_ring_table_.phase_id(i), *state_changes);
+      changes->deadlines.push_back(next_update_time);
     }
-
-    const auto new_phase_id = phase_provider_result->next.value().state;
-    const auto next_phases = phase_ring->GetNextPhases(new_phase_id);
-    phase_provider->SetPhase(phase_ring_id, new_phase_id, next_phases.front().id, next_phases.front().duration_until);
   }
+  PublishChanges();
 }
 
 }  // namespace integration
-}  // namespace maliput
\ No newline at end of file
+}  // namespace maliput
@@ -30,9 +30,11 @@
 #pragma once
 
 #include <maliput/api/road_network.h>
+#include <maliput/base/manual_phase_provider.h>
 #include <maliput/common/maliput_copyable.h>
 
 #include "integration/dynamic_environment_handler.h"
+#include "integration/phase_ring_table.h"
 #include "integration/timer.h"
 
 namespace maliput {
@@ -49,18 +51,21 @@ class FixedPhaseIterationHandler : public DynamicEnvironmentHandler {
   /// @param timer Timer implementation pointer.
   /// @param road_network maliput::api::RoadNetwork pointer.
   /// @param phase_duration The duration of the rule's states in seconds.
-  FixedPhaseIterationHandler(const Timer* timer, api::RoadNetwork* road_network, double phase_duration)
-      : DynamicEnvironmentHandler(timer, road_network), phase_duration_(phase_duration) {
-    MALIPUT_THROW_UNLESS(phase_duration > 0.);
-  }
+  FixedPhaseIterationHandler(const Timer* timer, api::RoadNetwork* road_network, double phase_duration);
 
   ~FixedPhaseIterationHandler() override = default;
 
   void Update() override;
 
+  /// @returns The time at which the current phases expire.
+  std::optional<double> NextUpdateTime() const override { return last_elapsed_time_ + phase_duration_; }
+
  private:
   const double phase_duration_{};
   double last_elapsed_time_{};
+  // The phase provider of `road_network_`, nullptr when it is not a ManualPhaseProvider.
+  ManualPhaseProvider* phase_provider_{};
+  PhaseRingTable phase_ring_table_;
 };
 
 }  // namespace integration
@@ -0,0 +1,183 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/generate_mesh.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <maliput/common/filesystem.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/binary_mesh.h"
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+#include "integration/road_geometry_view.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The path of the file named @p file_name in @p dirpath.
+std::string JoinPath(const std::string& dirpath, const std::string& file_name) {
+  common::Path path(dirpath);
+  path.append(file_name);
+  return path.get_path();
+}
+
+// Holds the file extension of every MeshFormat.
+const std::map<MeshFormat, std::string> kMeshFormatExtension{
+    {MeshFormat::kObj, ".obj"},
+    {MeshFormat::kGlb, ".glb"},
+    {MeshFormat::kPly, ".ply"},
+};
+
+// Reads the scratch OBJ/MTL pair named @p scratch_fileroot in @p scratch_dirpath and removes it.
+RoadMesh ReadScratchMesh(const std::string& scratch_dirpath, const std::string& scratch_fileroot) {
+  const std::string obj_path = JoinPath(scratch_dirpath, scratch_fileroot + ".obj");
+  const std::string mtl_path = JoinPath(scratch_dirpath, scratch_fileroot + ".mtl");
+  RoadMesh road_mesh{ReadObjFile(obj_path), ReadMtlFile(mtl_path)};
+  common::Filesystem::remove_file(common::Path(obj_path));
+  common::Filesystem::remove_file(common::Path(mtl_path));
+  return road_mesh;
+}
+
+}  // namespace
+
+RoadMesh GenerateRoadMesh(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                          const MeshGenerationOptions& options, MeshGenerationReport* report) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(options.num_chunks > 0);
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+  const std::vector<std::unique_ptr<RoadGeometryView>> chunks = SplitRoadGeometry(road_geometry, options.num_chunks);
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<std::string> scratch_fileroots(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    scratch_fileroots[i] = "chunk_" + std::to_string(i) + "_" + road_geometry->id().string();
+  }
+
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  ParallelFor(num_chunks, num_threads, [&](int i) {
+    utility::GenerateObjFile(chunks[i].get(), options.scratch_dirpath, scratch_fileroots[i], features);
+  });
+  const double meshing_time = timer->Elapsed();
+
+  timer->Reset();
+  std::vector<RoadMesh> chunk_meshes(num_chunks);
+  ParallelFor(num_chunks, num_threads,
+              [&](int i) { chunk_meshes[i] = ReadScratchMesh(options.scratch_dirpath, scratch_fileroots[i]); });
+  const double parsing_time = timer->Elapsed();
+
+  timer->Reset();
+  RoadMesh result = MergeRoadMeshes(&chunk_meshes);
+  const double merging_time = timer->Elapsed();
+
+  if (report != nullptr) {
+    report->num_chunks = num_chunks;
+    report->num_threads = std::min(num_threads, num_chunks);
+    report->meshing_time = meshing_time;
+    report->parsing_time = parsing_time;
+    report->merging_time = merging_time;
+    report->num_triangles = CountTriangles(result.mesh);
+  }
+  return result;
+}
+
+RoadMesh MeshRoadGeometry(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                          const std::string& scratch_dirpath, const std::string& scratch_fileroot) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  utility::GenerateObjFile(road_geometry, scratch_dirpath, scratch_fileroot, features);
+  return ReadScratchMesh(scratch_dirpath, scratch_fileroot);
+}
+
+RoadMesh MergeRoadMeshes(std::vector<RoadMesh>* road_meshes) {
+  MALIPUT_THROW_UNLESS(road_meshes != nullptr);
+  RoadMesh result;
+  MeshMerger merger;
+  for (RoadMesh& road_mesh : *road_meshes) {
+    merger.Append(road_mesh.mesh);
+    AppendMaterials(road_mesh.materials, &result.materials);
+    // Releases the memory of every mesh as soon as it is merged.
+    road_mesh = RoadMesh{};
+  }
+  result.mesh = merger.Release();
+  return result;
+}
+
+MeshGenerationReport GenerateObjFileInParallel(const api::RoadGeometry* road_geometry, const std::string& dirpath,
+                                               const std::string& fileroot, const utility::ObjFeatures& features,
+                                               int num_threads) {
+  MeshGenerationOptions options;
+  options.num_threads = num_threads;
+  options.scratch_dirpath = dirpath;
+  MeshGenerationReport report;
+  const RoadMesh road_mesh = GenerateRoadMesh(road_geometry, features, options, &report);
+
+  report.writing_time = WriteRoadMesh(road_mesh, dirpath, fileroot, MeshFormat::kObj).write_time;
+  return report;
+}
+
+MeshWriteReport WriteRoadMesh(const RoadMesh& road_mesh, const std::string& dirpath, const std::string& fileroot,
+                              MeshFormat format) {
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  MeshWriteReport report;
+  report.file_path = JoinPath(dirpath, fileroot + kMeshFormatExtension.at(format));
+  std::ofstream file(report.file_path, std::ios::binary);
+  MALIPUT_VALIDATE(file.is_open(), "Could not open mesh file: " + report.file_path);
+  switch (format) {
+    case MeshFormat::kObj: {
+      WriteObj(road_mesh.mesh, fileroot + ".mtl", &file);
+      const std::string mtl_path = JoinPath(dirpath, fileroot + ".mtl");
+      std::ofstream mtl_file(mtl_path, std::ios::binary);
+      MALIPUT_VALIDATE(mtl_file.is_open(), "Could not open MTL file: " + mtl_path);
+      WriteMtl(road_mesh.materials, &mtl_file);
+      report.file_size += static_cast<int64_t>(mtl_file.tellp());
+      mtl_file.close();
+      MALIPUT_VALIDATE(!mtl_file.fail(), "Could not write MTL file: " + mtl_path);
+      break;
+    }
+    case MeshFormat::kGlb:
+      WriteGlb(road_mesh.mesh, road_mesh.materials, &file);
+      break;
+    case MeshFormat::kPly:
+      WritePly(road_mesh.mesh, road_mesh.materials, &file);
+      break;
+  }
+  report.file_size += static_cast<int64_t>(file.tellp());
+  file.close();
+  MALIPUT_VALIDATE(!file.fail(), "Could not write mesh file: " + report.file_path);
+  report.write_time = timer->Elapsed();
+  return report;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,171 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/utility/generate_obj.h>
+
+#include "integration/mesh.h"
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of GenerateRoadMesh().
+struct MeshGenerationOptions {
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Maximum number of pieces the road geometry is split into. The split doesn't depend on `num_threads`, so neither
+  /// does the merged mesh. More pieces balance the load better at the expense of more intermediate files. It must be
+  /// positive.
+  int num_chunks{64};
+  /// Directory where the intermediate meshes are written. It must exist.
+  std::string scratch_dirpath{"."};
+};
+
+/// Holds the measurements of a mesh generation.
+struct MeshGenerationReport {
+  /// @returns The throughput of the meshing stage, in triangles per second.
+  double triangles_per_second() const { return meshing_time > 0. ? num_triangles / meshing_time : 0.; }
+
+  /// Number of pieces the road geometry was split into.
+  int num_chunks{};
+  /// Number of worker threads used.
+  int num_threads{};
+  /// Time spent meshing the pieces into their intermediate files, in seconds.
+  double meshing_time{};
+  /// Time spent reading the intermediate files back, in seconds. See MeshRoadGeometry().
+  double parsing_time{};
+  /// Time spent merging the meshes of the pieces, in seconds.
+  double merging_time{};
+  /// Time spent writing the output files, in seconds.
+  double writing_time{};
+  /// Number of triangles of the merged mesh.
+  int64_t num_triangles{};
+};
+
+/// Mesh of a road geometry along with the materials it uses.
+struct RoadMesh {
+  Mesh mesh;
+  MaterialLibrary materials;
+};
+
+/// Mesh file formats.
+enum class MeshFormat {
+  kObj,  ///< Wavefront OBJ text along with an MTL material library.
+  kGlb,  ///< Binary glTF 2.0. See WriteGlb().
+  kPly,  ///< Binary PLY. See WritePly().
+};
+
+/// Holds the measurements of a mesh file write.
+struct MeshWriteReport {
+  /// Path of the written mesh file.
+  std::string file_path;
+  /// Size of the written files in bytes, including the MTL file of MeshFormat::kObj.
+  int64_t file_size{};
+  /// Time spent serializing and writing, in seconds.
+  double write_time{};
+};
+
+/// Meshes @p road_geometry with maliput::utility::GenerateObjFile() in the calling thread.
+///
+/// maliput::utility only meshes into files, so the mesh is written into a scratch OBJ/MTL pair, parsed back and the
+/// scratch files are removed. The text round trip is a limitation of that API rather than of the meshing.
+///
+/// @param road_geometry The api::RoadGeometry to mesh, usually a RoadGeometryView. It must not be nullptr.
+/// @param features Meshing configuration.
+/// @param scratch_dirpath Directory of the scratch files. It must exist.
+/// @param scratch_fileroot Base name of the scratch files. It must be unique among concurrent calls.
+/// @returns The RoadMesh.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or a scratch file cannot be read.
+RoadMesh MeshRoadGeometry(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                          const std::string& scratch_dirpath, const std::string& scratch_fileroot);
+
+/// Merges @p road_meshes in order with a MeshMerger. Every mesh is released as soon as it is merged.
+///
+/// @throws maliput::common::assertion_error When @p road_meshes is nullptr.
+RoadMesh MergeRoadMeshes(std::vector<RoadMesh>* road_meshes);
+
+/// Meshes @p road_geometry concurrently.
+///
+/// The junctions of @p road_geometry are split into up to `num_chunks` contiguous pieces with a similar number of lanes
+/// (see SplitRoadGeometry()), every piece is meshed with maliput::utility::GenerateObjFile() by a worker thread and
+/// the resulting meshes are merged in junction order. The split only depends on @p road_geometry and `num_chunks`,
+/// hence the result does not depend on the number of threads.
+///
+/// Pieces are meshed into scratch files, which are read back in a second parallel pass, so `meshing_time` excludes
+/// the text round trip, which is reported as `parsing_time`.
+///
+/// The backend of @p road_geometry must support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to mesh. It must not be nullptr.
+/// @param features Meshing configuration.
+/// @param options Concurrency configuration.
+/// @param report When not nullptr, it is filled with the number of pieces, threads and triangles as well as the time
+///               spent meshing, parsing and merging.
+/// @returns The merged RoadMesh.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr, `num_chunks` is not positive or an
+///         intermediate mesh cannot be read.
+RoadMesh GenerateRoadMesh(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                          const MeshGenerationOptions& options, MeshGenerationReport* report);
+
+/// Concurrent counterpart of maliput::utility::GenerateObjFile().
+///
+/// Meshes @p road_geometry with GenerateRoadMesh() and writes `<fileroot>.obj` and `<fileroot>.mtl` into
+/// @p dirpath. Intermediate meshes are written into @p dirpath as well and removed afterwards.
+///
+/// @param road_geometry The api::RoadGeometry to mesh. It must not be nullptr.
+/// @param dirpath Directory of the output files. It must exist.
+/// @param fileroot Base name of the output files.
+/// @param features Meshing configuration.
+/// @param num_threads Number of worker threads. See ResolveNumberOfThreads().
+/// @returns The measurements of the generation.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or a file cannot be read or written.
+MeshGenerationReport GenerateObjFileInParallel(const api::RoadGeometry* road_geometry, const std::string& dirpath,
+                                               const std::string& fileroot, const utility::ObjFeatures& features,
+                                               int num_threads);
+
+/// Writes @p road_mesh into @p dirpath as `<fileroot>.<extension>`, where the extension is given by @p format.
+/// MeshFormat::kObj writes `<fileroot>.mtl` as well.
+///
+/// @param road_mesh The mesh to write.
+/// @param dirpath Directory of the output files. It must exist.
+/// @param fileroot Base name of the output files.
+/// @param format Format of the mesh file.
+/// @returns The measurements of the write.
+/// @throws maliput::common::assertion_error When a file cannot be written.
+MeshWriteReport WriteRoadMesh(const RoadMesh& road_mesh, const std::string& dirpath, const std::string& fileroot,
+                              MeshFormat format);
+
+}  // namespace integration
+}  // namespace maliput
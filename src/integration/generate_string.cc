@@ -0,0 +1,94 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/generate_string.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+#include "integration/road_geometry_view.h"
+
+namespace maliput {
+namespace integration {
+
+StringGenerationReport GenerateStringToStream(const api::RoadGeometry* road_geometry,
+                                              const utility::GenerateStringOptions& string_options,
+                                              const StringGenerationOptions& options, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  MALIPUT_THROW_UNLESS(options.chunks_per_thread > 0);
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+  const int num_junctions = road_geometry->num_junctions();
+
+  StringGenerationReport report;
+  if (num_junctions == 0) {
+    const std::string description = utility::GenerateString(*road_geometry, string_options);
+    *out << description;
+    report.num_chunks = 1;
+    report.num_threads = 1;
+    report.num_characters = static_cast<int64_t>(description.size());
+    report.generation_time = timer->Elapsed();
+    return report;
+  }
+
+  const int max_pending_chunks = num_threads * options.chunks_per_thread;
+  std::vector<std::string> chunks(max_pending_chunks);
+  OrderedParallelFor(
+      num_junctions, num_threads, max_pending_chunks,
+      [&](int i) {
+        const RoadGeometryView view(road_geometry, std::vector<const api::Junction*>{road_geometry->junction(i)},
+                                    false);
+        utility::GenerateStringOptions junction_options = string_options;
+        junction_options.include_road_geometry_id = string_options.include_road_geometry_id && i == 0;
+        chunks[i % max_pending_chunks] = utility::GenerateString(view, junction_options);
+      },
+      [&](int i) {
+        std::string& chunk = chunks[i % max_pending_chunks];
+        out->write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        report.num_characters += static_cast<int64_t>(chunk.size());
+        // Releases the memory of the chunk as soon as it is written.
+        std::string().swap(chunk);
+        return static_cast<bool>(*out);
+      });
+  MALIPUT_VALIDATE(static_cast<bool>(*out), "Failed to write the road geometry description.");
+  report.num_chunks = num_junctions;
+  report.num_threads = std::min(num_threads, num_junctions);
+  report.generation_time = timer->Elapsed();
+  return report;
+}
+
+}  // namespace integration
+}  // namespace maliput
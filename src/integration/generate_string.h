@@ -0,0 +1,84 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/utility/generate_string.h>
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of GenerateStringToStream().
+struct StringGenerationOptions {
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Number of formatted junctions each worker thread may keep ahead of the output, on average. Memory in use is
+  /// proportional to `num_threads * chunks_per_thread` junction descriptions.
+  int chunks_per_thread{2};
+};
+
+/// Holds the measurements of a string generation.
+struct StringGenerationReport {
+  /// Number of chunks the description was written in, i.e. one per junction.
+  int num_chunks{};
+  /// Number of worker threads used.
+  int num_threads{};
+  /// Number of characters written.
+  int64_t num_characters{};
+  /// Time spent formatting and writing, in seconds.
+  double generation_time{};
+};
+
+/// Streaming counterpart of maliput::utility::GenerateString().
+///
+/// Every junction of @p road_geometry is described with maliput::utility::GenerateString() on a RoadGeometryView
+/// that only exposes that junction, and the descriptions are written to @p out in junction order as soon as they are
+/// ready. Junctions are formatted concurrently, but no more than `num_threads * chunks_per_thread` descriptions are
+/// held in memory at once, so the peak memory does not grow with the size of @p road_geometry. The road geometry ID,
+/// when requested, precedes the first junction.
+///
+/// The backend of @p road_geometry must support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to describe. It must not be nullptr.
+/// @param string_options Serialization configuration.
+/// @param options Concurrency configuration.
+/// @param out Output stream. It must not be nullptr.
+/// @returns The measurements of the generation.
+/// @throws maliput::common::assertion_error When @p road_geometry or @p out is nullptr,
+///         `options.chunks_per_thread` is not positive or @p out fails.
+StringGenerationReport GenerateStringToStream(const api::RoadGeometry* road_geometry,
+                                              const utility::GenerateStringOptions& string_options,
+                                              const StringGenerationOptions& options, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,265 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_rule_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/rules/discrete_value_rule_state_provider.h>
+#include <maliput/api/rules/range_value_rule_state_provider.h>
+#include <maliput/api/rules/road_rulebook.h>
+#include <maliput/api/segment.h>
+#include <maliput/base/rule_registry.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+LaneRuleIndex::LaneRuleIndex(api::RoadNetwork* road_network) : road_network_(road_network) {
+  MALIPUT_THROW_UNLESS(road_network_ != nullptr);
+  const api::RoadGeometry* road_geometry = road_network_->road_geometry();
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        lane_indices_.emplace(lane->id(), static_cast<int>(lanes_.size()));
+        lanes_.push_back(lane);
+      }
+    }
+  }
+
+  MALIPUT_THROW_UNLESS(road_network_->rulebook() != nullptr);
+  const api::rules::RoadRulebook::QueryResults rules = road_network_->rulebook()->Rules();
+  discrete_value_rules_.reserve(rules.discrete_value_rules.size());
+  for (const auto& id_rule : rules.discrete_value_rules) {
+    discrete_value_rule_indices_.emplace(id_rule.first, static_cast<int>(discrete_value_rules_.size()));
+    discrete_value_rules_.push_back(id_rule.second);
+  }
+  range_value_rules_.reserve(rules.range_value_rules.size());
+  for (const auto& id_rule : rules.range_value_rules) {
+    range_value_rule_indices_.emplace(id_rule.first, static_cast<int>(range_value_rules_.size()));
+    range_value_rules_.push_back(id_rule.second);
+  }
+  BuildIntervalTable(discrete_value_rules_, &discrete_value_rule_intervals_);
+  BuildIntervalTable(range_value_rules_, &range_value_rule_intervals_);
+
+  speed_limit_type_index_ = RuleTypeIndex(SpeedLimitRuleTypeId());
+  direction_usage_type_index_ = RuleTypeIndex(DirectionUsageRuleTypeId());
+  right_of_way_type_index_ = RuleTypeIndex(RightOfWayRuleTypeId());
+
+  discrete_value_rule_states_.resize(discrete_value_rules_.size());
+  range_value_rule_states_.resize(range_value_rules_.size());
+  UpdateStates();
+}
+
+std::optional<int> LaneRuleIndex::LaneIndex(const api::LaneId& lane_id) const {
+  const auto it = lane_indices_.find(lane_id);
+  if (it == lane_indices_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+std::optional<int> LaneRuleIndex::RuleTypeIndex(const api::rules::Rule::TypeId& type_id) const {
+  const auto it = rule_type_indices_.find(type_id);
+  if (it == rule_type_indices_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+int LaneRuleIndex::AddRuleType(const api::rules::Rule::TypeId& type_id) {
+  const auto result = rule_type_indices_.emplace(type_id, static_cast<int>(rule_types_.size()));
+  if (result.second) {
+    rule_types_.push_back(type_id);
+  }
+  return result.first->second;
+}
+
+template <typename RuleT>
+void LaneRuleIndex::BuildIntervalTable(const std::vector<RuleT>& rules, IntervalTable* table) {
+  // Buckets the intervals by lane first, then lays them out contiguously.
+  std::vector<std::vector<Interval>> lane_intervals(lanes_.size());
+  for (int rule_index = 0; rule_index < static_cast<int>(rules.size()); ++rule_index) {
+    const RuleT& rule = rules[rule_index];
+    const int type_index = AddRuleType(rule.type_id());
+    for (const api::LaneSRange& range : rule.zone().ranges()) {
+      const auto lane_it = lane_indices_.find(range.lane_id());
+      if (lane_it == lane_indices_.end()) {
+        continue;
+      }
+      const double s0 = range.s_range().s0();
+      const double s1 = range.s_range().s1();
+      lane_intervals[lane_it->second].push_back(
+          Interval{std::min(s0, s1), std::max(s0, s1), std::max(s0, s1), rule_index, type_index});
+    }
+  }
+
+  table->lane_offsets.assign(1, 0);
+  table->lane_offsets.reserve(lanes_.size() + 1);
+  table->intervals.clear();
+  for (std::vector<Interval>& intervals : lane_intervals) {
+    std::sort(intervals.begin(), intervals.end(), [](const Interval& lhs, const Interval& rhs) {
+      return lhs.s0 < rhs.s0 || (lhs.s0 == rhs.s0 && lhs.rule_index < rhs.rule_index);
+    });
+    for (size_t i = 1; i < intervals.size(); ++i) {
+      intervals[i].max_s1 = std::max(intervals[i].s1, intervals[i - 1].max_s1);
+    }
+    table->intervals.insert(table->intervals.end(), intervals.begin(), intervals.end());
+    table->lane_offsets.push_back(static_cast<int>(table->intervals.size()));
+  }
+}
+
+template <typename VisitorT>
+void LaneRuleIndex::VisitOverlapping(const IntervalTable& table, int lane_index, double s0, double s1,
+                                     double tolerance, int type_index, VisitorT visit) const {
+  MALIPUT_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  const double query_s0 = std::min(s0, s1) - tolerance;
+  const double query_s1 = std::max(s0, s1) + tolerance;
+  const auto lane_begin = table.intervals.begin() + table.lane_offsets[lane_index];
+  const auto lane_end = table.intervals.begin() + table.lane_offsets[lane_index + 1];
+  // `max_s1` is non decreasing, so the intervals before `first` end before the query starts. `s0` is sorted, so the
+  // intervals from `last` on start after the query ends.
+  const auto first = std::partition_point(lane_begin, lane_end,
+                                          [query_s0](const Interval& interval) { return interval.max_s1 < query_s0; });
+  const auto last = std::partition_point(first, lane_end,
+                                         [query_s1](const Interval& interval) { return interval.s0 <= query_s1; });
+  for (auto it = first; it != last; ++it) {
+    if (it->s1 >= query_s0 && (type_index == kAnyType || it->type_index == type_index)) {
+      visit(it->rule_index);
+    }
+  }
+}
+
+void LaneRuleIndex::FindRules(const IntervalTable& table, int lane_index, double s0, double s1, double tolerance,
+                              int type_index, std::vector<int>* rule_indices) const {
+  MALIPUT_THROW_UNLESS(rule_indices != nullptr);
+  const size_t first_new = rule_indices->size();
+  VisitOverlapping(table, lane_index, s0, s1, tolerance, type_index,
+                   [rule_indices](int rule_index) { rule_indices->push_back(rule_index); });
+  // A rule may have several ranges on the same lane.
+  std::sort(rule_indices->begin() + first_new, rule_indices->end());
+  rule_indices->erase(std::unique(rule_indices->begin() + first_new, rule_indices->end()), rule_indices->end());
+}
+
+void LaneRuleIndex::FindDiscreteValueRules(int lane_index, double s0, double s1, double tolerance, int type_index,
+                                           std::vector<int>* rule_indices) const {
+  FindRules(discrete_value_rule_intervals_, lane_index, s0, s1, tolerance, type_index, rule_indices);
+}
+
+void LaneRuleIndex::FindRangeValueRules(int lane_index, double s0, double s1, double tolerance, int type_index,
+                                        std::vector<int>* rule_indices) const {
+  FindRules(range_value_rule_intervals_, lane_index, s0, s1, tolerance, type_index, rule_indices);
+}
+
+std::optional<int> LaneRuleIndex::FindMaxSpeedLimit(int lane_index, double s0, double s1, double tolerance) const {
+  MALIPUT_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  if (!speed_limit_type_index_.has_value()) {
+    return std::nullopt;
+  }
+  std::optional<int> result;
+  VisitOverlapping(range_value_rule_intervals_, lane_index, s0, s1, tolerance, *speed_limit_type_index_,
+                   [this, &result](int rule_index) {
+                     const std::optional<api::rules::RangeValueRule::Range>& state =
+                         range_value_rule_states_[rule_index];
+                     if (state.has_value() &&
+                         (!result.has_value() || state->max < range_value_rule_states_[*result]->max)) {
+                       result = rule_index;
+                     }
+                   });
+  return result;
+}
+
+void LaneRuleIndex::FindDirectionUsages(int lane_index, double s0, double s1, double tolerance,
+                                        std::vector<int>* rule_indices) const {
+  MALIPUT_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  MALIPUT_THROW_UNLESS(rule_indices != nullptr);
+  if (direction_usage_type_index_.has_value()) {
+    FindDiscreteValueRules(lane_index, s0, s1, tolerance, *direction_usage_type_index_, rule_indices);
+  }
+}
+
+void LaneRuleIndex::FindRightOfWays(int lane_index, double s0, double s1, double tolerance,
+                                    std::vector<int>* rule_indices) const {
+  MALIPUT_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  MALIPUT_THROW_UNLESS(rule_indices != nullptr);
+  if (right_of_way_type_index_.has_value()) {
+    FindDiscreteValueRules(lane_index, s0, s1, tolerance, *right_of_way_type_index_, rule_indices);
+  }
+}
+
+void LaneRuleIndex::UpdateStates() {
+  const api::rules::DiscreteValueRuleStateProvider* discrete_value_provider =
+      road_network_->discrete_value_rule_state_provider();
+  const api::rules::RangeValueRuleStateProvider* range_value_provider =
+      road_network_->range_value_rule_state_provider();
+  MALIPUT_THROW_UNLESS(discrete_value_provider != nullptr);
+  MALIPUT_THROW_UNLESS(range_value_provider != nullptr);
+  for (size_t i = 0; i < discrete_value_rules_.size(); ++i) {
+    const auto result = discrete_value_provider->GetState(discrete_value_rules_[i].id());
+    if (result.has_value()) {
+      discrete_value_rule_states_[i] = result->state;
+    } else {
+      discrete_value_rule_states_[i].reset();
+    }
+  }
+  for (size_t i = 0; i < range_value_rules_.size(); ++i) {
+    const auto result = range_value_provider->GetState(range_value_rules_[i].id());
+    if (result.has_value()) {
+      range_value_rule_states_[i] = result->state;
+    } else {
+      range_value_rule_states_[i].reset();
+    }
+  }
+}
+
+void LaneRuleIndex::UpdateStates(const DynamicEnvironmentChanges& changes) {
+  for (const auto& rule_state : changes.discrete_value_rule_states) {
+    const auto it = discrete_value_rule_indices_.find(rule_state.first);
+    if (it != discrete_value_rule_indices_.end()) {
+      discrete_value_rule_states_[it->second] = rule_state.second;
+    }
+  }
+  for (const auto& rule_state : changes.range_value_rule_states) {
+    const auto it = range_value_rule_indices_.find(rule_state.first);
+    if (it != range_value_rule_indices_.end()) {
+      range_value_rule_states_[it->second] = rule_state.second;
+    }
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
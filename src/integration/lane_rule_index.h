@@ -0,0 +1,223 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/rule.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_changes.h"
+
+namespace maliput {
+namespace integration {
+
+/// Index of the discrete and range value rules of a maliput::api::RoadNetwork by lane and s coordinate.
+///
+/// RoadRulebook::FindRules() goes through every rule of the rulebook, or through maps keyed by strings, on each call.
+/// This index is built once, right after loading the road network, and answers the same queries with a binary search
+/// over contiguous memory:
+/// - Lanes are given dense indices, following the junction, segment and lane order of the api::RoadGeometry. The
+///   index of a lane is obtained once with LaneIndex() and then reused for every query.
+/// - Rules of each kind are given dense indices as well. For every lane, the s ranges of the rules' zones are stored
+///   in a single array, sorted by their start and along with the running maximum of their end, so the ranges that
+///   overlap a query are found with two binary searches.
+/// - The current state of every rule is cached next to the rule. It is refreshed with UpdateStates(), either from the
+///   state providers or from the changes reported by a DynamicEnvironmentHandler.
+///
+/// Speed limit, direction usage and right-of-way rules are looked up through their rule type, see
+/// maliput/base/rule_registry.h.
+///
+/// Queries are const and don't allocate beyond the output vector, so they may be run concurrently as long as
+/// UpdateStates() is not called at the same time.
+class LaneRuleIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneRuleIndex)
+  LaneRuleIndex() = delete;
+
+  /// Type index that matches rules of any type.
+  static constexpr int kAnyType{-1};
+
+  /// Builds the index and reads the current rule states.
+  ///
+  /// Zone ranges on lanes that are not part of the api::RoadGeometry are not indexed.
+  ///
+  /// @param road_network The road network. It must not be nullptr and must outlive this index.
+  /// @throws maliput::common::assertion_error When @p road_network is nullptr, or when its road geometry, rulebook,
+  ///         discrete value rule state provider or range value rule state provider is nullptr.
+  explicit LaneRuleIndex(api::RoadNetwork* road_network);
+
+  /// @returns The number of indexed lanes.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+  /// @returns The dense index of the lane identified by @p lane_id or std::nullopt when there is no such lane.
+  std::optional<int> LaneIndex(const api::LaneId& lane_id) const;
+
+  /// @returns The lane at @p lane_index.
+  const api::Lane* lane(int lane_index) const { return lanes_.at(lane_index); }
+
+  /// @returns The dense index of @p type_id, to be passed to the queries, or std::nullopt when no rule is of that
+  ///          type.
+  std::optional<int> RuleTypeIndex(const api::rules::Rule::TypeId& type_id) const;
+
+  /// @returns The number of discrete value rules.
+  int num_discrete_value_rules() const { return static_cast<int>(discrete_value_rules_.size()); }
+
+  /// @returns The discrete value rule at @p rule_index.
+  const api::rules::DiscreteValueRule& discrete_value_rule(int rule_index) const {
+    return discrete_value_rules_.at(rule_index);
+  }
+
+  /// @returns The cached state of the discrete value rule at @p rule_index, std::nullopt when the state provider
+  ///          doesn't know it.
+  const std::optional<api::rules::DiscreteValueRule::DiscreteValue>& discrete_value_rule_state(int rule_index) const {
+    return discrete_value_rule_states_.at(rule_index);
+  }
+
+  /// @returns The number of range value rules.
+  int num_range_value_rules() const { return static_cast<int>(range_value_rules_.size()); }
+
+  /// @returns The range value rule at @p rule_index.
+  const api::rules::RangeValueRule& range_value_rule(int rule_index) const { return range_value_rules_.at(rule_index); }
+
+  /// @returns The cached state of the range value rule at @p rule_index, std::nullopt when the state provider doesn't
+  ///          know it.
+  const std::optional<api::rules::RangeValueRule::Range>& range_value_rule_state(int rule_index) const {
+    return range_value_rule_states_.at(rule_index);
+  }
+
+  /// Appends to @p rule_indices, in increasing order and without repetitions, the indices of the discrete value rules
+  /// whose zone overlaps the [@p s0, @p s1] range of the lane at @p lane_index.
+  ///
+  /// @param lane_index Index of the lane.
+  /// @param s0 Start of the s range. It may be greater than @p s1.
+  /// @param s1 End of the s range.
+  /// @param tolerance Distance by which the zone ranges may miss the s range and still overlap. See
+  ///                  RoadRulebook::FindRules().
+  /// @param type_index Index of the rule type to match, see RuleTypeIndex(), or kAnyType.
+  /// @param rule_indices Output vector. It must not be nullptr.
+  /// @throws maliput::common::assertion_error When @p lane_index is out of range, @p tolerance is negative or
+  ///         @p rule_indices is nullptr.
+  void FindDiscreteValueRules(int lane_index, double s0, double s1, double tolerance, int type_index,
+                              std::vector<int>* rule_indices) const;
+
+  /// Same as FindDiscreteValueRules() for range value rules.
+  void FindRangeValueRules(int lane_index, double s0, double s1, double tolerance, int type_index,
+                           std::vector<int>* rule_indices) const;
+
+  /// Finds the most restrictive speed limit over the [@p s0, @p s1] range of the lane at @p lane_index, i.e. the
+  /// speed limit rule whose current state has the lowest maximum speed.
+  ///
+  /// @returns The index of the range value rule or std::nullopt when no speed limit with a known state applies.
+  /// @throws maliput::common::assertion_error When @p lane_index is out of range or @p tolerance is negative.
+  std::optional<int> FindMaxSpeedLimit(int lane_index, double s0, double s1, double tolerance) const;
+
+  /// Appends to @p rule_indices the direction usage rules over the [@p s0, @p s1] range of the lane at
+  /// @p lane_index. See FindDiscreteValueRules().
+  void FindDirectionUsages(int lane_index, double s0, double s1, double tolerance,
+                           std::vector<int>* rule_indices) const;
+
+  /// Appends to @p rule_indices the right-of-way rules over the [@p s0, @p s1] range of the lane at @p lane_index.
+  /// See FindDiscreteValueRules().
+  void FindRightOfWays(int lane_index, double s0, double s1, double tolerance, std::vector<int>* rule_indices) const;
+
+  /// Reads the current state of every rule from the state providers of the road network.
+  /// @throws maliput::common::assertion_error When any of the state providers is nullptr.
+  void UpdateStates();
+
+  /// Applies the new rule states listed in @p changes. States of rules that are not indexed are ignored.
+  void UpdateStates(const DynamicEnvironmentChanges& changes);
+
+ private:
+  // S range of a rule's zone on a lane.
+  struct Interval {
+    // Start of the range, never greater than `s1`.
+    double s0{};
+    // End of the range.
+    double s1{};
+    // Maximum `s1` of this interval and of every interval before it on the same lane.
+    double max_s1{};
+    // Index of the rule.
+    int rule_index{};
+    // Index of the rule type.
+    int type_index{};
+  };
+
+  // Intervals of every lane, in a compressed layout: the intervals of the i-th lane are the entries of `intervals` in
+  // the [lane_offsets[i], lane_offsets[i + 1]) range, sorted by `s0`.
+  struct IntervalTable {
+    std::vector<int> lane_offsets;
+    std::vector<Interval> intervals;
+  };
+
+  // @returns The dense index of @p type_id, adding it when it's new.
+  int AddRuleType(const api::rules::Rule::TypeId& type_id);
+
+  // Fills @p table with the zones of @p rules.
+  template <typename RuleT>
+  void BuildIntervalTable(const std::vector<RuleT>& rules, IntervalTable* table);
+
+  // Calls @p visit with the index of every rule in @p table of @p type_index whose zone overlaps the
+  // [@p s0, @p s1] range of the lane at @p lane_index. A rule is visited once per overlapping zone range.
+  template <typename VisitorT>
+  void VisitOverlapping(const IntervalTable& table, int lane_index, double s0, double s1, double tolerance,
+                        int type_index, VisitorT visit) const;
+
+  // Appends the overlapping rules to @p rule_indices, sorted and without repetitions. See VisitOverlapping().
+  void FindRules(const IntervalTable& table, int lane_index, double s0, double s1, double tolerance, int type_index,
+                 std::vector<int>* rule_indices) const;
+
+  api::RoadNetwork* road_network_{};
+  std::vector<const api::Lane*> lanes_;
+  std::unordered_map<api::LaneId, int> lane_indices_;
+  std::vector<api::rules::Rule::TypeId> rule_types_;
+  std::unordered_map<api::rules::Rule::TypeId, int> rule_type_indices_;
+  std::vector<api::rules::DiscreteValueRule> discrete_value_rules_;
+  std::vector<std::optional<api::rules::DiscreteValueRule::DiscreteValue>> discrete_value_rule_states_;
+  std::unordered_map<api::rules::Rule::Id, int> discrete_value_rule_indices_;
+  IntervalTable discrete_value_rule_intervals_;
+  std::vector<api::rules::RangeValueRule> range_value_rules_;
+  std::vector<std::optional<api::rules::RangeValueRule::Range>> range_value_rule_states_;
+  std::unordered_map<api::rules::Rule::Id, int> range_value_rule_indices_;
+  IntervalTable range_value_rule_intervals_;
+  std::optional<int> speed_limit_type_index_;
+  std::optional<int> direction_usage_type_index_;
+  std::optional<int> right_of_way_type_index_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,188 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_s_route_writer.h"
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <string>
+
+#include <maliput/api/lane.h>
+#include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
+#include <yaml-cpp/yaml.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Distances that differ by less than this (in meters) are considered equal.
+constexpr double kDistanceTolerance = 0.01;
+
+// @returns True when @p range covers the whole lane it refers to, within kDistanceTolerance.
+bool CoversFullLane(const api::LaneSRange& range, const api::RoadGeometry* road_geometry) {
+  const api::Lane* lane = road_geometry->ById().GetLane(range.lane_id());
+  if (lane == nullptr) {
+    return false;
+  }
+  const double s0 = range.s_range().s0();
+  const double s1 = range.s_range().s1();
+  const double lane_length_delta = std::abs(std::abs(s1 - s0) - lane->length());
+  maliput::log()->trace("Lane ", range.lane_id().string(), ", |s1 - s0| = ", std::abs(s1 - s0),
+                        ", lane length = ", lane->length(), ", delta = ", lane_length_delta);
+  return lane_length_delta <= kDistanceTolerance;
+}
+
+// Writes @p str into @p out as a quoted and escaped JSON string.
+void WriteJsonString(const std::string& str, std::ostream* out) {
+  (*out) << '"';
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        (*out) << "\\\"";
+        break;
+      case '\\':
+        (*out) << "\\\\";
+        break;
+      case '\n':
+        (*out) << "\\n";
+        break;
+      case '\t':
+        (*out) << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          (*out) << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                 << std::setfill(' ');
+        } else {
+          (*out) << c;
+        }
+        break;
+    }
+  }
+  (*out) << '"';
+}
+
+// Writes the in-memory representation of @p value into @p out.
+template <typename T>
+void WriteBinary(const T& value, std::ostream* out) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Writes the @p index -th route out of @p num_routes as a YAML document.
+void WriteYamlRoute(const api::LaneSRoute& route, size_t index, size_t num_routes,
+                    const api::RoadGeometry* road_geometry, std::ostream* out) {
+  YAML::Node route_node;
+  for (const auto& range : route.ranges()) {
+    YAML::Node range_node;
+    range_node["Lane"] = range.lane_id().string();
+    if (!CoversFullLane(range, road_geometry)) {
+      YAML::Node s_range_node;
+      s_range_node.SetStyle(YAML::EmitterStyle::Flow);
+      s_range_node.push_back(range.s_range().s0());
+      s_range_node.push_back(range.s_range().s1());
+      range_node["SRange"] = s_range_node;
+    }
+    route_node.push_back(range_node);
+  }
+  YAML::Emitter emitter;
+  emitter << route_node;
+  (*out) << "Route " << (index + 1) << " of " << num_routes << ":\n";
+  (*out) << emitter.c_str();
+  if (index < num_routes - 1) {
+    (*out) << "\n";
+  }
+}
+
+// Writes the @p index -th route as a single line JSON object.
+void WriteJsonLinesRoute(const api::LaneSRoute& route, size_t index, const api::RoadGeometry* road_geometry,
+                         std::ostream* out) {
+  (*out) << "{\"route\":" << (index + 1) << ",\"ranges\":[";
+  for (size_t i = 0; i < route.ranges().size(); ++i) {
+    const auto& range = route.ranges()[i];
+    (*out) << (i == 0 ? "" : ",") << "{\"lane\":";
+    WriteJsonString(range.lane_id().string(), out);
+    if (!CoversFullLane(range, road_geometry)) {
+      (*out) << ",\"s_range\":[" << range.s_range().s0() << "," << range.s_range().s1() << "]";
+    }
+    (*out) << "}";
+  }
+  (*out) << "]}\n";
+}
+
+// Writes @p route as a binary record. See WriteLaneSRoutes().
+void WriteBinaryRoute(const api::LaneSRoute& route, std::ostream* out) {
+  WriteBinary(static_cast<uint32_t>(route.ranges().size()), out);
+  for (const auto& range : route.ranges()) {
+    const std::string& lane_id = range.lane_id().string();
+    WriteBinary(static_cast<uint32_t>(lane_id.size()), out);
+    out->write(lane_id.data(), lane_id.size());
+    WriteBinary(range.s_range().s0(), out);
+    WriteBinary(range.s_range().s1(), out);
+  }
+}
+
+}  // namespace
+
+void WriteLaneSRoutes(const std::vector<api::LaneSRoute>& routes, const api::RoadGeometry* road_geometry,
+                      LaneSRouteFormat format, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  const std::streamsize precision = out->precision();
+  if (format == LaneSRouteFormat::kBinary) {
+    out->write(kLaneSRoutesMagic, sizeof(kLaneSRoutesMagic));
+    WriteBinary(kLaneSRoutesByteOrder, out);
+    WriteBinary(static_cast<uint32_t>(routes.size()), out);
+  } else if (format == LaneSRouteFormat::kJsonLines) {
+    out->precision(std::numeric_limits<double>::max_digits10);
+  }
+  for (size_t i = 0; i < routes.size() && *out; ++i) {
+    switch (format) {
+      case LaneSRouteFormat::kYaml:
+        WriteYamlRoute(routes[i], i, routes.size(), road_geometry, out);
+        break;
+      case LaneSRouteFormat::kJsonLines:
+        WriteJsonLinesRoute(routes[i], i, road_geometry, out);
+        break;
+      case LaneSRouteFormat::kBinary:
+        WriteBinaryRoute(routes[i], out);
+        break;
+    }
+  }
+  if (format == LaneSRouteFormat::kYaml) {
+    (*out) << '\n';
+  }
+  out->flush();
+  out->precision(precision);
+  MALIPUT_VALIDATE(static_cast<bool>(*out), "Failed to write the routes.");
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include <maliput/api/regions.h>
+#include <maliput/api/road_geometry.h>
+
+namespace maliput {
+namespace integration {
+
+/// Serialization formats of WriteLaneSRoutes().
+enum class LaneSRouteFormat {
+  /// Human readable YAML documents, one per route.
+  kYaml,
+  /// One JSON object per line, one line per route.
+  kJsonLines,
+  /// Compact binary records. See WriteLaneSRoutes().
+  kBinary,
+};
+
+/// Identifies binary LaneSRoute streams: "LSR" followed by the format version.
+constexpr char kLaneSRoutesMagic[4] = {'L', 'S', 'R', '1'};
+/// Byte order mark of binary LaneSRoute streams.
+constexpr uint32_t kLaneSRoutesByteOrder{0x01020304};
+
+/// Writes @p routes to @p out, one route at a time, so the whole serialization is never held in memory.
+///
+/// The text formats omit the s range of the ranges that cover their whole lane, within 1cm.
+///
+/// The binary format is headed by kLaneSRoutesMagic, kLaneSRoutesByteOrder (uint32) and the number of routes (uint32).
+/// Then, every route holds its number of ranges (uint32) and, per range, the lane ID length (uint32), the lane ID
+/// characters and the s0 and s1 coordinates (double). Unlike the text formats, the s range is always present. All the
+/// values use the byte order of the machine that wrote them, which readers can tell from kLaneSRoutesByteOrder.
+///
+/// @param routes Routes to write.
+/// @param road_geometry The api::RoadGeometry the routes refer to. It must not be nullptr. Lanes that it doesn't
+///                      hold are written with their s range.
+/// @param format Serialization format.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p road_geometry or @p out is nullptr, or when @p out fails,
+///         including while flushing.
+void WriteLaneSRoutes(const std::vector<api::LaneSRoute>& routes, const api::RoadGeometry* road_geometry,
+                      LaneSRouteFormat format, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
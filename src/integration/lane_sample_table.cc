@@ -0,0 +1,322 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_sample_table.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/quaternion.h>
+
+#include "integration/create_timer.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using Quaternion = std::array<double, 4>;
+
+// @returns The (w, x, y, z) components of @p rotation.
+Quaternion ToArray(const api::Rotation& rotation) {
+  const auto& q = rotation.quat();
+  return {q.w(), q.x(), q.y(), q.z()};
+}
+
+// @returns The dot product of @p a and @p b.
+double Dot(const Quaternion& a, const Quaternion& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]; }
+
+// Adds @p weight times @p q to @p sum, flipping @p q when it lies on the opposite hemisphere of @p reference, as both
+// represent the same rotation.
+void Accumulate(const Quaternion& q, double weight, const Quaternion& reference, Quaternion* sum) {
+  const double signed_weight = Dot(q, reference) < 0. ? -weight : weight;
+  for (int k = 0; k < 4; ++k) {
+    (*sum)[k] += signed_weight * q[k];
+  }
+}
+
+// @returns @p q with unit norm.
+Quaternion Normalize(const Quaternion& q) {
+  const double norm = std::sqrt(Dot(q, q));
+  return {q[0] / norm, q[1] / norm, q[2] / norm, q[3] / norm};
+}
+
+// @returns The angle between the rotations @p a and @p b, which have unit norm.
+double Angle(const Quaternion& a, const Quaternion& b) { return 2. * std::acos(std::min(1., std::abs(Dot(a, b)))); }
+
+// @returns The h axis of the frame rotated by @p q, i.e. its third column.
+maliput::math::Vector3 HAxis(const Quaternion& q) {
+  const double w = q[0];
+  const double x = q[1];
+  const double y = q[2];
+  const double z = q[3];
+  return {2. * (x * z + w * y), 2. * (y * z - w * x), 1. - 2. * (x * x + y * y)};
+}
+
+// @returns A uniformly random number in [@p min, @p max].
+double Uniform(double min, double max, std::mt19937* generator) {
+  return std::uniform_real_distribution<double>(min, std::nextafter(max, max + 1.))(*generator);
+}
+
+}  // namespace
+
+LaneSampleTable::LaneSampleTable(const api::Lane* lane, const LaneSampleTableOptions& options)
+    : lane_(lane), num_lateral_samples_(options.num_lateral_samples) {
+  MALIPUT_THROW_UNLESS(lane_ != nullptr);
+  MALIPUT_THROW_UNLESS(options.max_position_error > 0.);
+  MALIPUT_THROW_UNLESS(options.max_orientation_error > 0.);
+  MALIPUT_THROW_UNLESS(options.num_lateral_samples >= 2);
+  MALIPUT_THROW_UNLESS(options.max_h >= 0.);
+  MALIPUT_THROW_UNLESS(options.min_s_step > 0.);
+  MALIPUT_THROW_UNLESS(options.max_s_step >= options.min_s_step);
+
+  const double length = lane_->length();
+  const int num_intervals = std::max(1, static_cast<int>(std::ceil(length / options.max_s_step)));
+  std::vector<Knot> knots{SampleKnot(0.)};
+  for (int i = 1; i <= num_intervals; ++i) {
+    const Knot a = knots.back();
+    Refine(a, SampleKnot(length * i / num_intervals), options, &knots);
+  }
+
+  const int num_knots = static_cast<int>(knots.size());
+  s_.reserve(num_knots);
+  r_min_.reserve(num_knots);
+  r_max_.reserve(num_knots);
+  positions_.reserve(num_knots * num_lateral_samples_);
+  orientations_.reserve(num_knots * num_lateral_samples_);
+  for (const Knot& knot : knots) {
+    s_.push_back(knot.s);
+    r_min_.push_back(knot.r_min);
+    r_max_.push_back(knot.r_max);
+    positions_.insert(positions_.end(), knot.positions.begin(), knot.positions.end());
+    orientations_.insert(orientations_.end(), knot.orientations.begin(), knot.orientations.end());
+  }
+}
+
+size_t LaneSampleTable::num_bytes() const {
+  return sizeof(double) * (s_.size() + r_min_.size() + r_max_.size()) +
+         sizeof(maliput::math::Vector3) * positions_.size() + sizeof(Quaternion) * orientations_.size();
+}
+
+LaneSampleTable::Knot LaneSampleTable::SampleKnot(double s) const {
+  Knot knot;
+  knot.s = s;
+  const api::RBounds segment_bounds = lane_->segment_bounds(s);
+  knot.r_min = segment_bounds.min();
+  knot.r_max = segment_bounds.max();
+  knot.positions.reserve(num_lateral_samples_);
+  knot.orientations.reserve(num_lateral_samples_);
+  for (int j = 0; j < num_lateral_samples_; ++j) {
+    const double r = knot.r_min + (knot.r_max - knot.r_min) * j / (num_lateral_samples_ - 1);
+    const api::LanePosition lane_position(s, r, 0.);
+    knot.positions.push_back(lane_->ToInertialPosition(lane_position).xyz());
+    knot.orientations.push_back(ToArray(lane_->GetOrientation(lane_position)));
+  }
+  return knot;
+}
+
+void LaneSampleTable::Refine(const Knot& a, Knot b, const LaneSampleTableOptions& options, std::vector<Knot>* knots) {
+  // Checks the interval at a quarter, half and three quarters of its length, across the segment bounds at twice the
+  // lateral resolution and at both ends of the h range.
+  const Row row_a = MakeRow(a);
+  const Row row_b = MakeRow(b);
+  const int num_lateral_checks = 2 * (num_lateral_samples_ - 1) + 1;
+  double position_error{0.};
+  double orientation_error{0.};
+  for (const double t : {0.25, 0.5, 0.75}) {
+    const double s = a.s + t * (b.s - a.s);
+    const api::RBounds segment_bounds = lane_->segment_bounds(s);
+    for (int k = 0; k < num_lateral_checks; ++k) {
+      const double r =
+          segment_bounds.min() + (segment_bounds.max() - segment_bounds.min()) * k / (num_lateral_checks - 1);
+      for (const double h : {0., options.max_h}) {
+        const api::LanePosition lane_position(s, r, h);
+        maliput::math::Vector3 position;
+        Quaternion orientation;
+        Interpolate(row_a, row_b, num_lateral_samples_, lane_position, &position, &orientation);
+        position_error = std::max(position_error, (position - lane_->ToInertialPosition(lane_position).xyz()).norm());
+        orientation_error =
+            std::max(orientation_error, Angle(orientation, ToArray(lane_->GetOrientation(lane_position))));
+        if (options.max_h == 0.) {
+          break;
+        }
+      }
+    }
+  }
+
+  const bool within_bounds =
+      position_error <= options.max_position_error && orientation_error <= options.max_orientation_error;
+  if (!within_bounds && (b.s - a.s) / 2. >= options.min_s_step) {
+    const Knot middle = SampleKnot((a.s + b.s) / 2.);
+    Refine(a, middle, options, knots);
+    Refine(middle, std::move(b), options, knots);
+    return;
+  }
+  max_position_error_ = std::max(max_position_error_, position_error);
+  max_orientation_error_ = std::max(max_orientation_error_, orientation_error);
+  meets_tolerance_ = meets_tolerance_ && within_bounds;
+  knots->push_back(std::move(b));
+}
+
+LaneSampleTable::Row LaneSampleTable::MakeRow(const Knot& knot) {
+  return Row{knot.s, knot.r_min, knot.r_max, knot.positions.data(), knot.orientations.data()};
+}
+
+LaneSampleTable::Row LaneSampleTable::MakeRow(int i) const {
+  return Row{s_[i], r_min_[i], r_max_[i], positions_.data() + i * num_lateral_samples_,
+             orientations_.data() + i * num_lateral_samples_};
+}
+
+int LaneSampleTable::FindRow(double s) const {
+  const int i = static_cast<int>(std::upper_bound(s_.begin(), s_.end(), s) - s_.begin()) - 1;
+  return std::clamp(i, 0, static_cast<int>(s_.size()) - 2);
+}
+
+void LaneSampleTable::Interpolate(const Row& a, const Row& b, int num_lateral_samples,
+                                  const api::LanePosition& lane_position, maliput::math::Vector3* position,
+                                  Quaternion* orientation) {
+  const double t = b.s > a.s ? std::clamp((lane_position.s() - a.s) / (b.s - a.s), 0., 1.) : 0.;
+  const double r_min = a.r_min + t * (b.r_min - a.r_min);
+  const double r_max = a.r_max + t * (b.r_max - a.r_max);
+  const double u = r_max > r_min ? (lane_position.r() - r_min) / (r_max - r_min) * (num_lateral_samples - 1) : 0.;
+  // r coordinates out of the segment bounds extrapolate the outermost lateral samples.
+  const int j = std::clamp(static_cast<int>(std::floor(u)), 0, num_lateral_samples - 2);
+  const double v = u - j;
+  const double w00 = (1. - t) * (1. - v);
+  const double w01 = (1. - t) * v;
+  const double w10 = t * (1. - v);
+  const double w11 = t * v;
+
+  Quaternion q{0., 0., 0., 0.};
+  const Quaternion& reference = a.orientations[j];
+  Accumulate(a.orientations[j], w00, reference, &q);
+  Accumulate(a.orientations[j + 1], w01, reference, &q);
+  Accumulate(b.orientations[j], w10, reference, &q);
+  Accumulate(b.orientations[j + 1], w11, reference, &q);
+  q = Normalize(q);
+  if (orientation != nullptr) {
+    *orientation = q;
+  }
+  if (position != nullptr) {
+    *position = w00 * a.positions[j] + w01 * a.positions[j + 1] + w10 * b.positions[j] + w11 * b.positions[j + 1] +
+                lane_position.h() * HAxis(q);
+  }
+}
+
+api::InertialPosition LaneSampleTable::ToInertialPosition(const api::LanePosition& lane_position) const {
+  const int i = FindRow(lane_position.s());
+  maliput::math::Vector3 position;
+  Interpolate(MakeRow(i), MakeRow(i + 1), num_lateral_samples_, lane_position, &position, nullptr);
+  return api::InertialPosition::FromXyz(position);
+}
+
+api::Rotation LaneSampleTable::GetOrientation(const api::LanePosition& lane_position) const {
+  const int i = FindRow(lane_position.s());
+  Quaternion q;
+  Interpolate(MakeRow(i), MakeRow(i + 1), num_lateral_samples_, lane_position, nullptr, &q);
+  return api::Rotation::FromQuat(maliput::math::Quaternion<double>(q[0], q[1], q[2], q[3]));
+}
+
+LaneSampleTableReport MeasureLaneSampleTables(const api::RoadGeometry* road_geometry,
+                                              const LaneSampleTableOptions& options, int num_queries_per_lane,
+                                              uint32_t seed) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(num_queries_per_lane >= 0);
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kSteadyTimer);
+
+  std::vector<const api::Lane*> lanes;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lanes.push_back(segment->lane(k));
+      }
+    }
+  }
+
+  LaneSampleTableReport report;
+  report.num_lanes = static_cast<int>(lanes.size());
+  std::vector<std::unique_ptr<LaneSampleTable>> tables;
+  tables.reserve(lanes.size());
+  timer->Reset();
+  for (const api::Lane* lane : lanes) {
+    tables.push_back(std::make_unique<LaneSampleTable>(lane, options));
+  }
+  report.build_time = timer->Elapsed();
+
+  std::mt19937 generator(seed);
+  std::vector<api::LanePosition> queries(num_queries_per_lane, api::LanePosition(0., 0., 0.));
+  std::vector<maliput::math::Vector3> exact_positions(num_queries_per_lane);
+  std::vector<Quaternion> exact_orientations(num_queries_per_lane);
+  for (const std::unique_ptr<LaneSampleTable>& table : tables) {
+    const api::Lane* lane = table->lane();
+    report.num_lanes_over_tolerance += table->meets_tolerance() ? 0 : 1;
+    report.num_s_samples += table->num_s_samples();
+    report.num_bytes += table->num_bytes();
+    for (api::LanePosition& query : queries) {
+      const double s = Uniform(0., lane->length(), &generator);
+      const api::RBounds segment_bounds = lane->segment_bounds(s);
+      query = api::LanePosition(s, Uniform(segment_bounds.min(), segment_bounds.max(), &generator),
+                                Uniform(0., options.max_h, &generator));
+    }
+
+    timer->Reset();
+    for (int i = 0; i < num_queries_per_lane; ++i) {
+      exact_positions[i] = lane->ToInertialPosition(queries[i]).xyz();
+      exact_orientations[i] = ToArray(lane->GetOrientation(queries[i]));
+    }
+    report.exact_query_time += timer->Elapsed();
+
+    std::vector<std::pair<api::InertialPosition, api::Rotation>> results;
+    results.reserve(num_queries_per_lane);
+    timer->Reset();
+    for (const api::LanePosition& query : queries) {
+      results.emplace_back(table->ToInertialPosition(query), table->GetOrientation(query));
+    }
+    report.table_query_time += timer->Elapsed();
+
+    for (int i = 0; i < num_queries_per_lane; ++i) {
+      report.max_position_error =
+          std::max(report.max_position_error, (results[i].first.xyz() - exact_positions[i]).norm());
+      report.max_orientation_error =
+          std::max(report.max_orientation_error, Angle(ToArray(results[i].second), exact_orientations[i]));
+    }
+    report.num_queries += num_queries_per_lane;
+  }
+  return report;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,228 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of a LaneSampleTable.
+struct LaneSampleTableOptions {
+  /// Maximum distance between the interpolated and the exact inertial positions, in meters.
+  double max_position_error{1e-2};
+  /// Maximum angle between the interpolated and the exact orientations, in radians.
+  double max_orientation_error{1e-3};
+  /// Number of samples across the segment bounds at every sampled s coordinate. It must be at least 2.
+  int num_lateral_samples{3};
+  /// Largest h coordinate the error bounds are checked at, in meters. It must not be negative.
+  double max_h{0.};
+  /// Smallest longitudinal distance between samples, in meters. Refinement stops there, even if the error bounds are
+  /// not met yet. It must be positive.
+  double min_s_step{1e-2};
+  /// Largest longitudinal distance between samples, in meters. It must not be smaller than `min_s_step`.
+  double max_s_step{5.};
+};
+
+/// Precomputed samples of a maliput::api::Lane frame that approximate Lane::ToInertialPosition() and
+/// Lane::GetOrientation() by interpolation.
+///
+/// Backends like maliput_malidrive evaluate the road reference line, its elevation and superelevation and the lane
+/// offsets on each query. Renderers and samplers that query many points per frame can trade accuracy for speed with
+/// this table, which answers each query with a binary search over the sampled s coordinates and a bilinear
+/// interpolation.
+///
+/// The lane is sampled at a sequence of s coordinates. At each of them, `num_lateral_samples` evenly spaced r
+/// coordinates span the segment bounds and the inertial position and orientation at h = 0 are stored. A query at
+/// (s, r, h) interpolates the segment bounds and then, bilinearly, the positions and the orientations (as normalized
+/// quaternions) of the four surrounding samples. The h coordinate is applied along the interpolated h axis.
+///
+/// Samples are refined adaptively: every interval between consecutive s samples is checked against the exact lane
+/// queries at a quarter, half and three quarters of its length, at every lateral sample and midway between them, and
+/// at h = 0 and h = `max_h`. Intervals whose error exceeds the bounds of LaneSampleTableOptions are bisected, until
+/// they are shorter than `min_s_step`. The largest errors found at the check points of the final intervals are
+/// reported by max_position_error() and max_orientation_error(). Because the interpolation error of smooth geometry
+/// peaks within an interval rather than at its ends, these errors bound the error of any query within the segment
+/// bounds and within [0, `max_h`], up to the variation of the geometry between check points.
+///
+/// Queries are const, so they may be run concurrently.
+class LaneSampleTable {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneSampleTable)
+  LaneSampleTable() = delete;
+
+  /// Samples @p lane.
+  ///
+  /// @param lane The lane to sample. It must not be nullptr and must outlive this table.
+  /// @param options Sampling configuration.
+  /// @throws maliput::common::assertion_error When @p lane is nullptr or @p options is invalid.
+  LaneSampleTable(const api::Lane* lane, const LaneSampleTableOptions& options);
+
+  /// @returns The sampled lane.
+  const api::Lane* lane() const { return lane_; }
+
+  /// @returns The number of sampled s coordinates.
+  int num_s_samples() const { return static_cast<int>(s_.size()); }
+
+  /// @returns The number of samples across the segment bounds at every sampled s coordinate.
+  int num_lateral_samples() const { return num_lateral_samples_; }
+
+  /// @returns The size of the samples, in bytes.
+  size_t num_bytes() const;
+
+  /// @returns The largest distance between the interpolated and the exact inertial positions found at the check
+  ///          points, in meters.
+  double max_position_error() const { return max_position_error_; }
+
+  /// @returns The largest angle between the interpolated and the exact orientations found at the check points, in
+  ///          radians.
+  double max_orientation_error() const { return max_orientation_error_; }
+
+  /// @returns Whether the errors found at the check points are within the bounds of the LaneSampleTableOptions. It is
+  ///          false when `min_s_step` stopped the refinement first.
+  bool meets_tolerance() const { return meets_tolerance_; }
+
+  /// Approximates Lane::ToInertialPosition().
+  ///
+  /// s coordinates out of [0, Lane::length()] are clamped. r and h coordinates out of the segment bounds and of
+  /// [0, `max_h`] are extrapolated, so the error bounds don't apply to them.
+  api::InertialPosition ToInertialPosition(const api::LanePosition& lane_position) const;
+
+  /// Approximates Lane::GetOrientation(). See ToInertialPosition().
+  api::Rotation GetOrientation(const api::LanePosition& lane_position) const;
+
+ private:
+  // Quaternion as (w, x, y, z).
+  using Quaternion = std::array<double, 4>;
+
+  // Samples at an s coordinate, as used while building the table.
+  struct Knot {
+    double s{};
+    double r_min{};
+    double r_max{};
+    std::vector<maliput::math::Vector3> positions;
+    std::vector<Quaternion> orientations;
+  };
+
+  // Samples at an s coordinate, pointing into either a Knot or the table.
+  struct Row {
+    double s{};
+    double r_min{};
+    double r_max{};
+    const maliput::math::Vector3* positions{};
+    const Quaternion* orientations{};
+  };
+
+  // @returns The samples of the lane at @p s.
+  Knot SampleKnot(double s) const;
+
+  // Appends @p b to @p knots after bisecting the [@p a, @p b] interval as long as it exceeds the error bounds.
+  void Refine(const Knot& a, Knot b, const LaneSampleTableOptions& options, std::vector<Knot>* knots);
+
+  // @returns The Row of @p knot.
+  static Row MakeRow(const Knot& knot);
+
+  // @returns The Row of the @p i -th sampled s coordinate.
+  Row MakeRow(int i) const;
+
+  // @returns The index of the sampled s coordinate at or before @p s, such that there is another one after it.
+  int FindRow(double s) const;
+
+  // Interpolates the samples of @p a and @p b, which are consecutive, at @p lane_position. The s coordinate must be
+  // within [a.s, b.s]. Either output may be nullptr.
+  static void Interpolate(const Row& a, const Row& b, int num_lateral_samples, const api::LanePosition& lane_position,
+                          maliput::math::Vector3* position, Quaternion* orientation);
+
+  const api::Lane* lane_{};
+  int num_lateral_samples_{};
+  // Sampled s coordinates, in increasing order.
+  std::vector<double> s_;
+  // Segment bounds at every sampled s coordinate.
+  std::vector<double> r_min_;
+  std::vector<double> r_max_;
+  // Positions and orientations, `num_lateral_samples_` consecutive entries per sampled s coordinate.
+  std::vector<maliput::math::Vector3> positions_;
+  std::vector<Quaternion> orientations_;
+  double max_position_error_{};
+  double max_orientation_error_{};
+  bool meets_tolerance_{true};
+};
+
+/// Holds the accuracy and speed measurements of the LaneSampleTables of a road geometry.
+struct LaneSampleTableReport {
+  /// Number of sampled lanes.
+  int num_lanes{};
+  /// Number of lanes whose table doesn't meet the error bounds. See LaneSampleTable::meets_tolerance().
+  int num_lanes_over_tolerance{};
+  /// Total number of sampled s coordinates.
+  int64_t num_s_samples{};
+  /// Total size of the samples, in bytes.
+  size_t num_bytes{};
+  /// Time spent building the tables, in seconds.
+  double build_time{};
+  /// Number of random queries compared against the exact lane queries.
+  int64_t num_queries{};
+  /// Largest position error of the random queries, in meters.
+  double max_position_error{};
+  /// Largest orientation error of the random queries, in radians.
+  double max_orientation_error{};
+  /// Time spent by the exact ToInertialPosition() and GetOrientation() lane queries, in seconds.
+  double exact_query_time{};
+  /// Time spent by the same queries on the tables, in seconds.
+  double table_query_time{};
+};
+
+/// Builds a LaneSampleTable for every lane of @p road_geometry and compares it against the exact lane queries.
+///
+/// Every table answers @p num_queries_per_lane ToInertialPosition() and GetOrientation() queries at uniformly random
+/// points within its lane's segment bounds and [0, `max_h`]. The same queries are timed on the lane and on the table,
+/// in the calling thread.
+///
+/// @param road_geometry The api::RoadGeometry to sample. It must not be nullptr.
+/// @param options Sampling configuration of the tables.
+/// @param num_queries_per_lane Number of random queries per lane. It must not be negative.
+/// @param seed Seed of the random queries.
+/// @returns The measurements.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or any parameter is invalid.
+LaneSampleTableReport MeasureLaneSampleTables(const api::RoadGeometry* road_geometry,
+                                              const LaneSampleTableOptions& options, int num_queries_per_lane,
+                                              uint32_t seed);
+
+}  // namespace integration
+}  // namespace maliput
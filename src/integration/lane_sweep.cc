@@ -0,0 +1,228 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_sweep.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Fraction of `s_step` that a lane length may exceed a multiple of it by and still be sampled as that multiple, so that
+// rounding in `length / s_step` doesn't add a second sample at the end of the lane.
+constexpr double kSampleCountTolerance{1e-9};
+
+constexpr std::array<const char*, kNumLaneSweepColumns> kColumnNames{
+    "s",
+    "x",
+    "y",
+    "z",
+    "roll",
+    "pitch",
+    "yaw",
+    "lane_bounds_min",
+    "lane_bounds_max",
+    "segment_bounds_min",
+    "segment_bounds_max",
+    "elevation_bounds_min",
+    "elevation_bounds_max",
+};
+
+// Range of samples of a lane taken by a task.
+struct SweepTask {
+  const api::Lane* lane{};
+  // Index of the first sample of the lane.
+  int64_t lane_offset{};
+  // Number of samples of the lane.
+  int64_t num_lane_samples{};
+  // Range of samples, relative to the first sample of the lane.
+  int64_t first{};
+  int64_t last{};
+};
+
+// Writes the raw bytes of @p values.
+template <typename T>
+void WriteArray(const std::vector<T>& values, std::ostream* out) {
+  out->write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+}  // namespace
+
+const char* LaneSweepColumnName(LaneSweepColumn column) { return kColumnNames[static_cast<int>(column)]; }
+
+LaneSweep SweepLanes(const api::RoadGeometry* road_geometry, const LaneSweepOptions& options,
+                     LaneSweepReport* report) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(options.s_step > 0.);
+  MALIPUT_THROW_UNLESS(options.samples_per_task > 0);
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kSteadyTimer);
+
+  // Counts the samples of every lane and splits them into tasks.
+  LaneSweep sweep;
+  sweep.s_step = options.s_step;
+  sweep.lane_offsets.push_back(0);
+  std::vector<SweepTask> tasks;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        const int64_t num_lane_samples =
+            static_cast<int64_t>(std::ceil(lane->length() / options.s_step - kSampleCountTolerance)) + 1;
+        for (int64_t first = 0; first < num_lane_samples; first += options.samples_per_task) {
+          tasks.push_back({lane, sweep.lane_offsets.back(), num_lane_samples, first,
+                           std::min(first + options.samples_per_task, num_lane_samples)});
+        }
+        sweep.lane_ids.push_back(lane->id().string());
+        sweep.lane_offsets.push_back(sweep.lane_offsets.back() + num_lane_samples);
+      }
+    }
+  }
+  for (std::vector<double>& column : sweep.columns) {
+    column.resize(sweep.num_samples());
+  }
+
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+  ParallelFor(static_cast<int>(tasks.size()), num_threads, [&](int i) {
+    const SweepTask& task = tasks[i];
+    const double length = task.lane->length();
+    for (int64_t j = task.first; j < task.last; ++j) {
+      // The last sample is placed at the end of the lane regardless of rounding.
+      const double s =
+          j + 1 == task.num_lane_samples ? length : std::min(static_cast<double>(j) * options.s_step, length);
+      const api::LanePosition lane_position(s, 0., 0.);
+      const api::InertialPosition position = task.lane->ToInertialPosition(lane_position);
+      const api::Rotation rotation = task.lane->GetOrientation(lane_position);
+      const api::RBounds lane_bounds = task.lane->lane_bounds(s);
+      const api::RBounds segment_bounds = task.lane->segment_bounds(s);
+      const api::HBounds elevation_bounds = task.lane->elevation_bounds(s, 0.);
+      const double values[kNumLaneSweepColumns]{s,
+                                                position.x(),
+                                                position.y(),
+                                                position.z(),
+                                                rotation.roll(),
+                                                rotation.pitch(),
+                                                rotation.yaw(),
+                                                lane_bounds.min(),
+                                                lane_bounds.max(),
+                                                segment_bounds.min(),
+                                                segment_bounds.max(),
+                                                elevation_bounds.min(),
+                                                elevation_bounds.max()};
+      const int64_t index = task.lane_offset + j;
+      for (int k = 0; k < kNumLaneSweepColumns; ++k) {
+        sweep.columns[k][index] = values[k];
+      }
+    }
+  });
+
+  if (report != nullptr) {
+    report->num_lanes = static_cast<int>(sweep.lane_ids.size());
+    report->num_samples = sweep.num_samples();
+    report->num_tasks = static_cast<int>(tasks.size());
+    report->num_threads = std::max(1, std::min(num_threads, report->num_tasks));
+    report->sampling_time = timer->Elapsed();
+  }
+  return sweep;
+}
+
+void WriteLaneSweepCsv(const LaneSweep& sweep, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  const std::streamsize precision = out->precision(std::numeric_limits<double>::max_digits10);
+  *out << "lane_id";
+  for (const char* name : kColumnNames) {
+    *out << ',' << name;
+  }
+  *out << '\n';
+  for (int i = 0; i < static_cast<int>(sweep.lane_ids.size()); ++i) {
+    for (int64_t j = sweep.lane_offsets[i]; j < sweep.lane_offsets[i + 1]; ++j) {
+      *out << sweep.lane_ids[i];
+      for (const std::vector<double>& column : sweep.columns) {
+        *out << ',' << column[j];
+      }
+      *out << '\n';
+    }
+  }
+  out->precision(precision);
+}
+
+void WriteLaneSweepBinary(const LaneSweep& sweep, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  const uint64_t num_samples = static_cast<uint64_t>(sweep.num_samples());
+  std::vector<uint64_t> lane_offsets(sweep.lane_offsets.begin(), sweep.lane_offsets.end());
+  if (lane_offsets.empty()) {
+    lane_offsets.push_back(0);
+  }
+  std::vector<char> lane_ids;
+  for (const std::string& lane_id : sweep.lane_ids) {
+    lane_ids.insert(lane_ids.end(), lane_id.begin(), lane_id.end());
+    lane_ids.push_back('\0');
+  }
+
+  LaneSweepHeader header{};
+  std::memcpy(header.magic, kLaneSweepMagic, sizeof(kLaneSweepMagic));
+  header.version = kLaneSweepVersion;
+  header.byte_order = kLaneSweepByteOrder;
+  header.num_lanes = static_cast<uint32_t>(sweep.lane_ids.size());
+  header.num_samples = num_samples;
+  header.num_columns = kNumLaneSweepColumns;
+  header.s_step = sweep.s_step;
+  // Every array holds 8 byte values, so they all start at multiples of 8 without padding.
+  header.lane_offsets_offset = sizeof(LaneSweepHeader);
+  header.columns_offset = header.lane_offsets_offset + lane_offsets.size() * sizeof(uint64_t);
+  header.lane_ids_offset = header.columns_offset + kNumLaneSweepColumns * num_samples * sizeof(double);
+  header.lane_ids_size = lane_ids.size();
+  static_assert(sizeof(LaneSweepHeader) % 8 == 0, "Lane sweep arrays must start at multiples of 8.");
+
+  out->write(reinterpret_cast<const char*>(&header), sizeof(header));
+  WriteArray(lane_offsets, out);
+  for (const std::vector<double>& column : sweep.columns) {
+    MALIPUT_THROW_UNLESS(column.size() == num_samples);
+    WriteArray(column, out);
+  }
+  WriteArray(lane_ids, out);
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,212 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+
+namespace maliput {
+namespace integration {
+
+/// Columns of a LaneSweep, in the order they are written.
+enum class LaneSweepColumn {
+  /// s coordinate of the sample, in meters.
+  kS = 0,
+  /// Inertial position of the lane centerline, in meters.
+  kX,
+  kY,
+  kZ,
+  /// Orientation of the lane frame at the centerline, in radians.
+  kRoll,
+  kPitch,
+  kYaw,
+  /// Lane bounds, in meters.
+  kLaneBoundsMin,
+  kLaneBoundsMax,
+  /// Segment bounds, in meters.
+  kSegmentBoundsMin,
+  kSegmentBoundsMax,
+  /// Elevation bounds at the centerline, in meters.
+  kElevationBoundsMin,
+  kElevationBoundsMax,
+};
+
+/// Number of LaneSweepColumn values.
+constexpr int kNumLaneSweepColumns{13};
+
+/// @returns The name of @p column, as written in the header of WriteLaneSweepCsv().
+const char* LaneSweepColumnName(LaneSweepColumn column);
+
+/// Samples of every lane of a road geometry at a fixed s step, stored by column.
+struct LaneSweep {
+  /// @returns The values of @p column.
+  const std::vector<double>& column(LaneSweepColumn column) const { return columns[static_cast<int>(column)]; }
+
+  /// @returns The number of samples.
+  int64_t num_samples() const { return lane_offsets.empty() ? 0 : lane_offsets.back(); }
+
+  /// Longitudinal distance between samples, in meters.
+  double s_step{};
+  /// ID of every lane, in road geometry order.
+  std::vector<std::string> lane_ids;
+  /// Index of the first sample of every lane, followed by the number of samples. The samples of the `i`-th lane
+  /// are [lane_offsets[i], lane_offsets[i + 1]).
+  std::vector<int64_t> lane_offsets;
+  /// Values of every LaneSweepColumn, indexed by the column.
+  std::array<std::vector<double>, kNumLaneSweepColumns> columns;
+};
+
+/// Holds the configuration of SweepLanes().
+struct LaneSweepOptions {
+  /// Longitudinal distance between samples, in meters. It must be positive.
+  double s_step{1.};
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Number of consecutive samples of a lane taken by each task. It must be positive. Long lanes are split into
+  /// several tasks, so maps with few lanes still spread over every thread.
+  int samples_per_task{1024};
+};
+
+/// Holds the measurements of SweepLanes().
+struct LaneSweepReport {
+  /// Number of sampled lanes.
+  int num_lanes{};
+  /// Number of samples.
+  int64_t num_samples{};
+  /// Number of tasks the samples were split into.
+  int num_tasks{};
+  /// Number of worker threads used.
+  int num_threads{};
+  /// Time spent sampling the lanes, in seconds.
+  double sampling_time{};
+};
+
+/// Samples every lane of @p road_geometry at a fixed s step.
+///
+/// Every lane is sampled at s = 0, `s_step`, 2 * `s_step`, ... and at its length, at the centerline. Each sample
+/// holds the values of every LaneSweepColumn, from Lane::ToInertialPosition(), Lane::GetOrientation(),
+/// Lane::lane_bounds(), Lane::segment_bounds() and Lane::elevation_bounds(). Lanes are stored in junction, segment
+/// and lane order.
+///
+/// Sample counts are known upfront from the lane lengths, so the columns are allocated once and every task writes its
+/// own range of them; the result does not depend on the number of threads. The backend of @p road_geometry must
+/// support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to sample. It must not be nullptr.
+/// @param options Sampling configuration.
+/// @param report When not nullptr, it is filled with the measurements of the sweep.
+/// @returns The samples.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or @p options is invalid.
+LaneSweep SweepLanes(const api::RoadGeometry* road_geometry, const LaneSweepOptions& options,
+                     LaneSweepReport* report);
+
+/// Writes @p sweep as CSV.
+///
+/// The first line holds `lane_id` followed by the LaneSweepColumnName() of every column. Then, there is a line per
+/// sample with the ID of its lane and its values, printed with enough digits to be read back exactly.
+///
+/// @param sweep Samples to write.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteLaneSweepCsv(const LaneSweep& sweep, std::ostream* out);
+
+/// @defgroup lane_sweep_format Binary lane sweep format
+///
+/// Columnar layout of a LaneSweep, designed to be memory mapped or read with a single call per column.
+///
+/// A lane sweep buffer starts with a LaneSweepHeader, followed by LaneSweep::lane_offsets as `num_lanes + 1`
+/// uint64_t values, by every LaneSweepColumn in order as `num_samples` doubles each, and by the lane IDs as
+/// consecutive null terminated strings. Every array starts at an offset, relative to the start of the buffer, that is
+/// a multiple of 8. All the values use the byte order of the machine that wrote the buffer, which is recorded in
+/// LaneSweepHeader::byte_order.
+/// @{
+
+/// Heads a lane sweep buffer.
+struct LaneSweepHeader {
+  /// Holds kLaneSweepMagic.
+  char magic[4];
+  /// Holds kLaneSweepVersion.
+  uint32_t version;
+  /// Holds kLaneSweepByteOrder, written in the byte order of the buffer.
+  uint32_t byte_order;
+  uint32_t num_lanes;
+  uint64_t num_samples;
+  /// Holds kNumLaneSweepColumns.
+  uint32_t num_columns;
+  uint32_t reserved;
+  /// Longitudinal distance between samples, in meters.
+  double s_step;
+  uint64_t lane_offsets_offset;
+  /// Offset of the first column. The `i`-th column starts `8 * i * num_samples` bytes after it.
+  uint64_t columns_offset;
+  uint64_t lane_ids_offset;
+  uint64_t lane_ids_size;
+};
+
+static_assert(sizeof(LaneSweepHeader) == 72);
+static_assert(offsetof(LaneSweepHeader, magic) == 0);
+static_assert(offsetof(LaneSweepHeader, version) == 4);
+static_assert(offsetof(LaneSweepHeader, byte_order) == 8);
+static_assert(offsetof(LaneSweepHeader, num_lanes) == 12);
+static_assert(offsetof(LaneSweepHeader, num_samples) == 16);
+static_assert(offsetof(LaneSweepHeader, num_columns) == 24);
+static_assert(offsetof(LaneSweepHeader, reserved) == 28);
+static_assert(offsetof(LaneSweepHeader, s_step) == 32);
+static_assert(offsetof(LaneSweepHeader, lane_offsets_offset) == 40);
+static_assert(offsetof(LaneSweepHeader, columns_offset) == 48);
+static_assert(offsetof(LaneSweepHeader, lane_ids_offset) == 56);
+static_assert(offsetof(LaneSweepHeader, lane_ids_size) == 64);
+
+/// Identifies lane sweep buffers.
+constexpr char kLaneSweepMagic[4] = {'M', 'L', 'S', 'W'};
+/// Version of the lane sweep format.
+constexpr uint32_t kLaneSweepVersion{1};
+/// Byte order mark of the lane sweep format.
+constexpr uint32_t kLaneSweepByteOrder{0x01020304};
+
+/// @}
+
+/// Writes @p sweep in the @ref lane_sweep_format "binary lane sweep format".
+///
+/// Columns are written straight from @p sweep, without intermediate copies.
+///
+/// @param sweep Samples to write.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteLaneSweepBinary(const LaneSweep& sweep, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Holds two instances of @p T so that any number of threads can read it while a writer modifies it, following the
+/// Left-Right concurrency control technique.
+///
+/// Readers never block nor retry: they announce themselves in a read indicator, read the instance that is currently
+/// published and leave. The writer modifies the instance that no reader can reach, publishes it, waits for the
+/// readers that may still be on the other instance to leave and then repeats the modification on it. Hence, writes
+/// are serialized and run their modification twice, which suits data that is read far more often than written.
+///
+/// Read indicators are spread over cache-line aligned counters picked by thread, so readers of different threads
+/// rarely contend for the same cache line.
+///
+/// @tparam T The type of the data. It must be copy constructible.
+template <typename T>
+class LeftRight {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LeftRight)
+  LeftRight() = delete;
+
+  /// Constructs a LeftRight whose two instances are copies of @p initial_value.
+  explicit LeftRight(const T& initial_value) : instances_{initial_value, initial_value} {}
+
+  /// Calls @p function with the published instance. It is wait-free with respect to the writer.
+  ///
+  /// @p function must not keep references to the instance once it returns, nor call Modify().
+  /// @returns The value returned by @p function.
+  template <typename Function>
+  auto Read(Function&& function) const -> decltype(std::forward<Function>(function)(std::declval<const T&>())) {
+    const ReadGuard guard(this);
+    return std::forward<Function>(function)(instances_[published_.load()]);
+  }
+
+  /// Applies @p function to both instances in turn, publishing the first one modified before modifying the second.
+  ///
+  /// Modifications are serialized with each other. @p function must leave both instances equal, i.e. be
+  /// deterministic given the same input instance.
+  template <typename Function>
+  void Modify(Function&& function) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    const int published = published_.load();
+    function(&instances_[1 - published]);
+    published_.store(1 - published);
+    // New readers go to the other read indicator. Once the readers of both indicators that arrived before the
+    // publication have left, nobody reads the previously published instance anymore.
+    const int version = version_.load();
+    WaitForReaders(1 - version);
+    version_.store(1 - version);
+    WaitForReaders(version);
+    function(&instances_[published]);
+  }
+
+ private:
+  // Number of counters of every read indicator.
+  static constexpr int kNumStripes{16};
+
+  // Counter of a read indicator, alone in its cache line.
+  struct alignas(64) Counter {
+    std::atomic<int64_t> value{0};
+  };
+
+  // Registers a reader for its lifetime.
+  class ReadGuard {
+   public:
+    explicit ReadGuard(const LeftRight* left_right)
+        : counter_(&left_right->read_indicators_[left_right->version_.load()][Stripe()].value) {
+      counter_->fetch_add(1);
+    }
+    ~ReadGuard() { counter_->fetch_sub(1); }
+
+   private:
+    std::atomic<int64_t>* counter_{};
+  };
+
+  // @returns The counter of every read indicator used by the calling thread.
+  static int Stripe() {
+    thread_local const int stripe =
+        static_cast<int>(std::hash<std::thread::id>()(std::this_thread::get_id()) % kNumStripes);
+    return stripe;
+  }
+
+  // Waits until every counter of the @p version -th read indicator is zero.
+  void WaitForReaders(int version) const {
+    for (const Counter& counter : read_indicators_[version]) {
+      while (counter.value.load() != 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  std::array<T, 2> instances_;
+  // Index of the instance readers go to.
+  std::atomic<int> published_{0};
+  // Index of the read indicator new readers register in.
+  std::atomic<int> version_{0};
+  mutable std::array<std::array<Counter, kNumStripes>, 2> read_indicators_{};
+  std::mutex writer_mutex_;
+};
+
+}  // namespace integration
+}  // namespace maliput
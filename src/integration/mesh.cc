@@ -0,0 +1,367 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/mesh.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of significant digits used to serialize coordinates. It round-trips any decimal with up to 15 digits.
+constexpr int kPrecision{15};
+
+// @returns The characters in @p line after the first whitespace-separated token, with leading whitespace removed.
+std::string RestOfLine(const std::string& line, size_t token_end) {
+  const size_t start = line.find_first_not_of(" \t\r", token_end);
+  if (start == std::string::npos) {
+    return "";
+  }
+  const size_t end = line.find_last_not_of(" \t\r");
+  return line.substr(start, end - start + 1);
+}
+
+// Parses the three coordinates that follow the statement keyword in @p line.
+maliput::math::Vector3 ParseVector3(const char* line) {
+  char* end{nullptr};
+  const double x = std::strtod(line, &end);
+  const double y = std::strtod(end, &end);
+  const double z = std::strtod(end, &end);
+  return {x, y, z};
+}
+
+// Converts an OBJ index (1-based, or negative when relative to the end) into a zero-based index.
+int ResolveIndex(long index, int count) {
+  const long resolved = index < 0 ? count + index : index - 1;
+  MALIPUT_VALIDATE(resolved >= 0 && resolved < count, "OBJ face refers to a nonexistent element.");
+  return static_cast<int>(resolved);
+}
+
+// Parses the corners of a face statement, e.g. " 1//1 2//2 3//3", and appends them to @p mesh.
+void ParseFace(const char* corners, Mesh* mesh) {
+  const char* cursor = corners;
+  int num_corners{0};
+  while (true) {
+    while (*cursor == ' ' || *cursor == '\t') {
+      ++cursor;
+    }
+    if (*cursor == '\0' || *cursor == '\r' || *cursor == '\n') {
+      break;
+    }
+    char* end{nullptr};
+    const long vertex = std::strtol(cursor, &end, 10);
+    MALIPUT_VALIDATE(end != cursor, "Malformed OBJ face.");
+    cursor = end;
+    long normal{0};
+    if (*cursor == '/') {
+      ++cursor;
+      // Texture coordinates are skipped.
+      if (*cursor != '/') {
+        std::strtol(cursor, &end, 10);
+        cursor = end;
+      }
+      if (*cursor == '/') {
+        ++cursor;
+        normal = std::strtol(cursor, &end, 10);
+        MALIPUT_VALIDATE(end != cursor, "Malformed OBJ face.");
+        cursor = end;
+      }
+    }
+    mesh->vertex_indices.push_back(ResolveIndex(vertex, static_cast<int>(mesh->vertices.size())));
+    mesh->normal_indices.push_back(normal == 0 ? -1 : ResolveIndex(normal, static_cast<int>(mesh->normals.size())));
+    ++num_corners;
+  }
+  MALIPUT_VALIDATE(num_corners >= 3, "OBJ faces must have at least three corners.");
+  mesh->face_offsets.push_back(static_cast<int>(mesh->vertex_indices.size()));
+}
+
+// @returns The bit pattern of @p value.
+uint64_t ToBits(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+}  // namespace
+
+Mesh ReadObj(std::istream* in) {
+  MALIPUT_THROW_UNLESS(in != nullptr);
+  Mesh mesh;
+  std::unordered_map<std::string, int> material_index;
+  int current_material{-1};
+  std::string line;
+  while (std::getline(*in, line)) {
+    const size_t token_start = line.find_first_not_of(" \t");
+    if (token_start == std::string::npos || line[token_start] == '#') {
+      continue;
+    }
+    const size_t token_end = line.find_first_of(" \t\r", token_start);
+    const std::string token = line.substr(token_start, token_end - token_start);
+    const std::string rest = token_end == std::string::npos ? "" : RestOfLine(line, token_end);
+    if (token == "usemtl" && rest.empty()) {
+      // A `usemtl` without a name resets the material of the following faces.
+      current_material = -1;
+      continue;
+    }
+    if (token_end == std::string::npos) {
+      continue;
+    }
+    if (token == "v") {
+      mesh.vertices.push_back(ParseVector3(line.c_str() + token_end));
+    } else if (token == "vn") {
+      mesh.normals.push_back(ParseVector3(line.c_str() + token_end));
+    } else if (token == "usemtl") {
+      const std::string& name = rest;
+      const auto it = material_index.find(name);
+      if (it != material_index.end()) {
+        current_material = it->second;
+      } else {
+        current_material = static_cast<int>(mesh.materials.size());
+        material_index.emplace(name, current_material);
+        mesh.materials.push_back(name);
+      }
+    } else if (token == "f") {
+      ParseFace(line.c_str() + token_end, &mesh);
+      mesh.face_materials.push_back(current_material);
+    }
+  }
+  return mesh;
+}
+
+Mesh ReadObjFile(const std::string& file_path) {
+  std::ifstream file(file_path);
+  MALIPUT_VALIDATE(file.is_open(), "Could not open OBJ file: " + file_path);
+  return ReadObj(&file);
+}
+
+void WriteObj(const Mesh& mesh, const std::string& mtl_file_name, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  char buffer[128];
+  if (!mtl_file_name.empty()) {
+    (*out) << "mtllib " << mtl_file_name << "\n";
+  }
+  for (const maliput::math::Vector3& v : mesh.vertices) {
+    const int length = std::snprintf(buffer, sizeof(buffer), "v %.*g %.*g %.*g\n", kPrecision, v.x(), kPrecision,
+                                     v.y(), kPrecision, v.z());
+    out->write(buffer, length);
+  }
+  for (const maliput::math::Vector3& n : mesh.normals) {
+    const int length = std::snprintf(buffer, sizeof(buffer), "vn %.*g %.*g %.*g\n", kPrecision, n.x(), kPrecision,
+                                     n.y(), kPrecision, n.z());
+    out->write(buffer, length);
+  }
+  int current_material{-1};
+  for (int face = 0; face < mesh.num_faces(); ++face) {
+    if (mesh.face_materials[face] != current_material) {
+      current_material = mesh.face_materials[face];
+      if (current_material == -1) {
+        (*out) << "usemtl\n";
+      } else {
+        (*out) << "usemtl " << mesh.materials[current_material] << "\n";
+      }
+    }
+    out->put('f');
+    for (int corner = mesh.face_offsets[face]; corner < mesh.face_offsets[face + 1]; ++corner) {
+      const int length =
+          mesh.normal_indices[corner] == -1
+              ? std::snprintf(buffer, sizeof(buffer), " %d", mesh.vertex_indices[corner] + 1)
+              : std::snprintf(buffer, sizeof(buffer), " %d//%d", mesh.vertex_indices[corner] + 1,
+                              mesh.normal_indices[corner] + 1);
+      out->write(buffer, length);
+    }
+    out->put('\n');
+  }
+}
+
+MaterialLibrary ReadMtl(std::istream* in) {
+  MALIPUT_THROW_UNLESS(in != nullptr);
+  MaterialLibrary materials;
+  std::string line;
+  while (std::getline(*in, line)) {
+    const size_t token_start = line.find_first_not_of(" \t\r");
+    if (token_start == std::string::npos || line[token_start] == '#') {
+      continue;
+    }
+    const size_t token_end = line.find_first_of(" \t", token_start);
+    if (line.compare(token_start, token_end - token_start, "newmtl") == 0) {
+      materials.push_back(Material{RestOfLine(line, token_end), {}});
+    } else if (!materials.empty()) {
+      materials.back().statements.push_back(RestOfLine(line, token_start));
+    }
+  }
+  return materials;
+}
+
+MaterialLibrary ReadMtlFile(const std::string& file_path) {
+  std::ifstream file(file_path);
+  MALIPUT_VALIDATE(file.is_open(), "Could not open MTL file: " + file_path);
+  return ReadMtl(&file);
+}
+
+void WriteMtl(const MaterialLibrary& materials, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  for (const Material& material : materials) {
+    (*out) << "newmtl " << material.name << "\n";
+    for (const std::string& statement : material.statements) {
+      (*out) << statement << "\n";
+    }
+    (*out) << "\n";
+  }
+}
+
+size_t MeshMerger::Vector3Hash::operator()(const maliput::math::Vector3& v) const {
+  size_t seed{0};
+  for (const double coordinate : {v.x(), v.y(), v.z()}) {
+    seed ^= std::hash<uint64_t>()(ToBits(coordinate)) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  }
+  return seed;
+}
+
+bool MeshMerger::Vector3Equal::operator()(const maliput::math::Vector3& lhs,
+                                          const maliput::math::Vector3& rhs) const {
+  return ToBits(lhs.x()) == ToBits(rhs.x()) && ToBits(lhs.y()) == ToBits(rhs.y()) && ToBits(lhs.z()) == ToBits(rhs.z());
+}
+
+void MeshMerger::Append(const Mesh& source) {
+  std::vector<int> vertex_map(source.vertices.size());
+  for (size_t i = 0; i < source.vertices.size(); ++i) {
+    const auto it = vertex_index_.emplace(source.vertices[i], static_cast<int>(mesh_.vertices.size()));
+    if (it.second) {
+      mesh_.vertices.push_back(source.vertices[i]);
+    }
+    vertex_map[i] = it.first->second;
+  }
+  std::vector<int> normal_map(source.normals.size());
+  for (size_t i = 0; i < source.normals.size(); ++i) {
+    const auto it = normal_index_.emplace(source.normals[i], static_cast<int>(mesh_.normals.size()));
+    if (it.second) {
+      mesh_.normals.push_back(source.normals[i]);
+    }
+    normal_map[i] = it.first->second;
+  }
+  std::vector<int> material_map(source.materials.size());
+  for (size_t i = 0; i < source.materials.size(); ++i) {
+    const auto it = material_index_.emplace(source.materials[i], static_cast<int>(mesh_.materials.size()));
+    if (it.second) {
+      mesh_.materials.push_back(source.materials[i]);
+    }
+    material_map[i] = it.first->second;
+  }
+
+  mesh_.vertex_indices.reserve(mesh_.vertex_indices.size() + source.vertex_indices.size());
+  mesh_.normal_indices.reserve(mesh_.normal_indices.size() + source.normal_indices.size());
+  for (size_t corner = 0; corner < source.vertex_indices.size(); ++corner) {
+    mesh_.vertex_indices.push_back(vertex_map[source.vertex_indices[corner]]);
+    const int normal = source.normal_indices[corner];
+    mesh_.normal_indices.push_back(normal == -1 ? -1 : normal_map[normal]);
+  }
+  const int corner_offset = mesh_.face_offsets.back();
+  for (int face = 0; face < source.num_faces(); ++face) {
+    mesh_.face_offsets.push_back(corner_offset + source.face_offsets[face + 1]);
+    const int material = source.face_materials[face];
+    mesh_.face_materials.push_back(material == -1 ? -1 : material_map[material]);
+  }
+}
+
+Mesh MeshMerger::Release() {
+  Mesh result = std::move(mesh_);
+  mesh_ = Mesh{};
+  vertex_index_.clear();
+  normal_index_.clear();
+  material_index_.clear();
+  return result;
+}
+
+void AppendMaterials(const MaterialLibrary& source, MaterialLibrary* destination) {
+  MALIPUT_THROW_UNLESS(destination != nullptr);
+  for (const Material& material : source) {
+    bool found{false};
+    for (const Material& existing : *destination) {
+      if (existing.name == material.name) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      destination->push_back(material);
+    }
+  }
+}
+
+Mesh ExtractFaces(const Mesh& mesh, const std::vector<int>& faces) {
+  Mesh result;
+  // Maps the indices of `mesh` to the indices of `result`, -1 while unused.
+  std::vector<int> vertex_map(mesh.vertices.size(), -1);
+  std::vector<int> normal_map(mesh.normals.size(), -1);
+  std::vector<int> material_map(mesh.materials.size(), -1);
+  const auto remap = [](int index, const std::vector<maliput::math::Vector3>& source, std::vector<int>* map,
+                        std::vector<maliput::math::Vector3>* destination) {
+    if ((*map)[index] == -1) {
+      (*map)[index] = static_cast<int>(destination->size());
+      destination->push_back(source[index]);
+    }
+    return (*map)[index];
+  };
+  for (const int face : faces) {
+    MALIPUT_THROW_UNLESS(face >= 0 && face < mesh.num_faces());
+    for (int corner = mesh.face_offsets[face]; corner < mesh.face_offsets[face + 1]; ++corner) {
+      result.vertex_indices.push_back(remap(mesh.vertex_indices[corner], mesh.vertices, &vertex_map, &result.vertices));
+      const int normal = mesh.normal_indices[corner];
+      result.normal_indices.push_back(normal == -1 ? -1 : remap(normal, mesh.normals, &normal_map, &result.normals));
+    }
+    result.face_offsets.push_back(static_cast<int>(result.vertex_indices.size()));
+    const int material = mesh.face_materials[face];
+    if (material != -1 && material_map[material] == -1) {
+      material_map[material] = static_cast<int>(result.materials.size());
+      result.materials.push_back(mesh.materials[material]);
+    }
+    result.face_materials.push_back(material == -1 ? -1 : material_map[material]);
+  }
+  return result;
+}
+
+int64_t CountTriangles(const Mesh& mesh) {
+  int64_t triangles{0};
+  for (int face = 0; face < mesh.num_faces(); ++face) {
+    triangles += std::max(0, mesh.num_corners(face) - 2);
+  }
+  return triangles;
+}
+
+}  // namespace integration
+}  // namespace maliput
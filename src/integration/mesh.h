@@ -0,0 +1,177 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+/// Polygonal mesh as described by a Wavefront OBJ file.
+///
+/// Faces are stored in a compressed layout: the corners of the i-th face are the entries of `vertex_indices` and
+/// `normal_indices` in the [face_offsets[i], face_offsets[i + 1]) range. All the indices are zero-based.
+struct Mesh {
+  /// @returns The number of faces.
+  int num_faces() const { return static_cast<int>(face_materials.size()); }
+
+  /// @returns The number of corners of the @p face -th face.
+  int num_corners(int face) const { return face_offsets[face + 1] - face_offsets[face]; }
+
+  /// Vertex positions.
+  std::vector<maliput::math::Vector3> vertices;
+  /// Vertex normals.
+  std::vector<maliput::math::Vector3> normals;
+  /// Names of the materials used by the faces.
+  std::vector<std::string> materials;
+  /// Offsets of each face's first corner. It always holds `num_faces() + 1` entries.
+  std::vector<int> face_offsets{0};
+  /// Index into `vertices` of each corner.
+  std::vector<int> vertex_indices;
+  /// Index into `normals` of each corner, -1 when the corner has no normal.
+  std::vector<int> normal_indices;
+  /// Index into `materials` of each face, -1 when the face has no material.
+  std::vector<int> face_materials;
+};
+
+/// Material of a Wavefront MTL file.
+struct Material {
+  /// Name of the material, as referenced by `usemtl` statements.
+  std::string name;
+  /// Statements that follow `newmtl`, e.g. "Kd 0.1 0.1 0.1".
+  std::vector<std::string> statements;
+};
+
+/// Sequence of materials of a Wavefront MTL file.
+using MaterialLibrary = std::vector<Material>;
+
+/// Parses a Wavefront OBJ stream.
+///
+/// Only `v`, `vn`, `usemtl` and `f` statements are kept; texture coordinates, groups and any other statement are
+/// ignored. Negative (relative) indices are resolved. A `usemtl` statement without a name, as written by WriteObj(),
+/// leaves the following faces without material.
+///
+/// @param in Input stream. It must not be nullptr.
+/// @returns The parsed Mesh.
+/// @throws maliput::common::assertion_error When @p in is nullptr or a face is malformed.
+Mesh ReadObj(std::istream* in);
+
+/// Parses the Wavefront OBJ file at @p file_path. See ReadObj().
+///
+/// @throws maliput::common::assertion_error When the file can't be opened.
+Mesh ReadObjFile(const std::string& file_path);
+
+/// Writes @p mesh as a Wavefront OBJ stream.
+///
+/// A `usemtl` statement is written whenever the material changes between consecutive faces. Faces without material
+/// that follow faces with one are preceded by a `usemtl` statement without a name, so they don't inherit it.
+///
+/// @param mesh Mesh to serialize.
+/// @param mtl_file_name Name of the material library to reference with `mtllib`. When empty, no library is
+///                      referenced.
+/// @param out Output stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteObj(const Mesh& mesh, const std::string& mtl_file_name, std::ostream* out);
+
+/// Parses a Wavefront MTL stream.
+///
+/// @param in Input stream. It must not be nullptr.
+/// @throws maliput::common::assertion_error When @p in is nullptr.
+MaterialLibrary ReadMtl(std::istream* in);
+
+/// Parses the Wavefront MTL file at @p file_path. See ReadMtl().
+///
+/// @throws maliput::common::assertion_error When the file can't be opened.
+MaterialLibrary ReadMtlFile(const std::string& file_path);
+
+/// Writes @p materials as a Wavefront MTL stream.
+///
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteMtl(const MaterialLibrary& materials, std::ostream* out);
+
+/// Merges meshes into a single one.
+///
+/// Vertices and normals whose coordinates are bitwise equal to one already merged are reused and materials are
+/// matched by name, so merging the meshes of adjacent road pieces doesn't duplicate their shared borders. Appending
+/// the same sequence of meshes always yields the same result.
+class MeshMerger {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(MeshMerger)
+  MeshMerger() = default;
+
+  /// Appends the faces of @p source to the merged mesh.
+  void Append(const Mesh& source);
+
+  /// @returns The merged mesh.
+  const Mesh& mesh() const { return mesh_; }
+
+  /// @returns The merged mesh, leaving this merger empty.
+  Mesh Release();
+
+ private:
+  // Hashes the bit pattern of a Vector3.
+  struct Vector3Hash {
+    size_t operator()(const maliput::math::Vector3& v) const;
+  };
+  // Compares the bit pattern of two Vector3.
+  struct Vector3Equal {
+    bool operator()(const maliput::math::Vector3& lhs, const maliput::math::Vector3& rhs) const;
+  };
+
+  Mesh mesh_;
+  std::unordered_map<maliput::math::Vector3, int, Vector3Hash, Vector3Equal> vertex_index_;
+  std::unordered_map<maliput::math::Vector3, int, Vector3Hash, Vector3Equal> normal_index_;
+  std::unordered_map<std::string, int> material_index_;
+};
+
+/// Appends the materials of @p source whose names are not yet in @p destination.
+///
+/// @throws maliput::common::assertion_error When @p destination is nullptr.
+void AppendMaterials(const MaterialLibrary& source, MaterialLibrary* destination);
+
+/// @returns A mesh made of the @p faces of @p mesh, in the given order. Only the vertices, normals and materials
+///          used by those faces are kept.
+/// @throws maliput::common::assertion_error When a face index is out of range.
+Mesh ExtractFaces(const Mesh& mesh, const std::vector<int>& faces);
+
+/// @returns The number of triangles @p mesh decomposes into, i.e. a face of n corners counts as n - 2 triangles.
+int64_t CountTriangles(const Mesh& mesh);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,449 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/mesh_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/create_timer.h"
+#include "integration/parallel_for.h"
+#include "integration/road_geometry_view.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Version of the cache file layout and of the hashed quantities. Bump it whenever any of them changes.
+constexpr uint64_t kCacheVersion{1};
+
+// Magic number that heads every cache file.
+constexpr char kCacheMagic[] = "MMC1";
+
+// 64-bit FNV-1a hash.
+class Hasher {
+ public:
+  void Add(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  }
+  void Add(uint64_t value) { Add(&value, sizeof(value)); }
+  void Add(double value) { Add(&value, sizeof(value)); }
+  void Add(bool value) { Add(static_cast<uint64_t>(value)); }
+  void Add(const std::string& value) {
+    Add(static_cast<uint64_t>(value.size()));
+    Add(value.data(), value.size());
+  }
+  void Add(const maliput::math::Vector3& value) {
+    Add(value.x());
+    Add(value.y());
+    Add(value.z());
+  }
+
+  uint64_t hash() const { return hash_; }
+
+ private:
+  uint64_t hash_{0xcbf29ce484222325ULL};
+};
+
+// @returns @p key as a 16-digit hexadecimal number.
+std::string ToHex(uint64_t key) {
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(key));
+  return buffer;
+}
+
+// @returns The path of the file named @p file_name in @p dirpath.
+std::string JoinPath(const std::string& dirpath, const std::string& file_name) {
+  return (std::filesystem::path(dirpath) / file_name).string();
+}
+
+template <typename T>
+void WriteValue(const T& value, std::ostream* out) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void WriteVector(const std::vector<T>& values, std::ostream* out) {
+  WriteValue(static_cast<uint64_t>(values.size()), out);
+  out->write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+void WriteString(const std::string& value, std::ostream* out) {
+  WriteValue(static_cast<uint64_t>(value.size()), out);
+  out->write(value.data(), value.size());
+}
+
+void WriteVector3s(const std::vector<maliput::math::Vector3>& values, std::ostream* out) {
+  WriteValue(static_cast<uint64_t>(values.size()), out);
+  for (const maliput::math::Vector3& v : values) {
+    WriteValue(v.x(), out);
+    WriteValue(v.y(), out);
+    WriteValue(v.z(), out);
+  }
+}
+
+template <typename T>
+T ReadValue(std::istream* in) {
+  T value{};
+  in->read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+// Reads the number of elements of a sequence that takes at least @p min_element_size bytes per element. The count is
+// checked against the @p file_size bytes of the file before any allocation, so corrupt files can't request huge
+// ones.
+size_t ReadCount(size_t min_element_size, uint64_t file_size, std::istream* in) {
+  const uint64_t count = ReadValue<uint64_t>(in);
+  MALIPUT_VALIDATE(in->good(), "Truncated mesh cache file.");
+  const uint64_t remaining = file_size - static_cast<uint64_t>(in->tellg());
+  MALIPUT_VALIDATE(count <= remaining / min_element_size, "Truncated mesh cache file.");
+  return static_cast<size_t>(count);
+}
+
+template <typename T>
+std::vector<T> ReadVector(uint64_t file_size, std::istream* in) {
+  std::vector<T> values(ReadCount(sizeof(T), file_size, in));
+  in->read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  return values;
+}
+
+std::string ReadString(uint64_t file_size, std::istream* in) {
+  std::string value(ReadCount(1, file_size, in), '\0');
+  in->read(&value[0], value.size());
+  return value;
+}
+
+std::vector<maliput::math::Vector3> ReadVector3s(uint64_t file_size, std::istream* in) {
+  std::vector<maliput::math::Vector3> values(ReadCount(3 * sizeof(double), file_size, in));
+  for (maliput::math::Vector3& v : values) {
+    const double x = ReadValue<double>(in);
+    const double y = ReadValue<double>(in);
+    const double z = ReadValue<double>(in);
+    v = {x, y, z};
+  }
+  return values;
+}
+
+// Extension of the cache files.
+constexpr char kCacheExtension[] = ".mesh";
+
+// Deletes the least recently used cache files of @p cache_dirpath until at most @p max_entries remain. The files in
+// @p used_paths are considered the most recently used ones, regardless of the resolution of file times.
+// @returns The number of deleted files.
+int EvictCacheFiles(const std::string& cache_dirpath, const std::vector<std::string>& used_paths, int max_entries) {
+  std::vector<std::filesystem::path> used;
+  for (const std::string& path : used_paths) {
+    used.push_back(std::filesystem::path(path).filename());
+  }
+  std::sort(used.begin(), used.end());
+  std::vector<std::tuple<bool, std::filesystem::file_time_type, std::filesystem::path>> entries;
+  for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cache_dirpath)) {
+    std::error_code error;
+    if (entry.is_regular_file(error) && entry.path().extension() == kCacheExtension) {
+      const std::filesystem::file_time_type last_use = entry.last_write_time(error);
+      if (!error) {
+        const bool is_used = std::binary_search(used.begin(), used.end(), entry.path().filename());
+        entries.emplace_back(is_used, last_use, entry.path());
+      }
+    }
+  }
+  if (static_cast<int>(entries.size()) <= max_entries) {
+    return 0;
+  }
+  std::sort(entries.begin(), entries.end());
+  int num_evictions{0};
+  for (size_t i = 0; i + max_entries < entries.size(); ++i) {
+    // Files deleted meanwhile by another process are not counted.
+    std::error_code error;
+    num_evictions += std::filesystem::remove(std::get<2>(entries[i]), error) ? 1 : 0;
+  }
+  return num_evictions;
+}
+
+// Stores @p road_mesh at @p file_path. The file is written aside and renamed, so concurrent readers never see a
+// partial file.
+void WriteCacheFile(const RoadMesh& road_mesh, const std::string& file_path) {
+  const std::string partial_path = file_path + ".partial";
+  {
+    std::ofstream out(partial_path, std::ios::binary);
+    MALIPUT_VALIDATE(out.is_open(), "Could not open mesh cache file: " + partial_path);
+    out.write(kCacheMagic, 4);
+    WriteVector3s(road_mesh.mesh.vertices, &out);
+    WriteVector3s(road_mesh.mesh.normals, &out);
+    WriteValue(static_cast<uint64_t>(road_mesh.mesh.materials.size()), &out);
+    for (const std::string& material : road_mesh.mesh.materials) {
+      WriteString(material, &out);
+    }
+    WriteVector(road_mesh.mesh.face_offsets, &out);
+    WriteVector(road_mesh.mesh.vertex_indices, &out);
+    WriteVector(road_mesh.mesh.normal_indices, &out);
+    WriteVector(road_mesh.mesh.face_materials, &out);
+    WriteValue(static_cast<uint64_t>(road_mesh.materials.size()), &out);
+    for (const Material& material : road_mesh.materials) {
+      WriteString(material.name, &out);
+      WriteValue(static_cast<uint64_t>(material.statements.size()), &out);
+      for (const std::string& statement : material.statements) {
+        WriteString(statement, &out);
+      }
+    }
+    out.close();
+    MALIPUT_VALIDATE(!out.fail(), "Could not write mesh cache file: " + partial_path);
+  }
+  std::error_code error;
+  std::filesystem::rename(partial_path, file_path, error);
+  MALIPUT_VALIDATE(!error, "Could not rename mesh cache file: " + partial_path);
+}
+
+// @returns The RoadMesh stored at @p file_path, or std::nullopt when there is no such file, e.g. because it was never
+//          written or because another process evicted it.
+// @throws maliput::common::assertion_error When the file is not a valid cache file.
+std::optional<RoadMesh> ReadCacheFile(const std::string& file_path) {
+  std::error_code error;
+  const uint64_t file_size = std::filesystem::file_size(file_path, error);
+  if (error) {
+    return std::nullopt;
+  }
+  std::ifstream in(file_path, std::ios::binary);
+  if (!in.is_open()) {
+    // The file was evicted after its size was read.
+    return std::nullopt;
+  }
+  char magic[4];
+  in.read(magic, 4);
+  MALIPUT_VALIDATE(in.good() && std::memcmp(magic, kCacheMagic, 4) == 0, "Invalid mesh cache file: " + file_path);
+  RoadMesh road_mesh;
+  road_mesh.mesh.vertices = ReadVector3s(file_size, &in);
+  road_mesh.mesh.normals = ReadVector3s(file_size, &in);
+  // Every string takes at least the 8 bytes of its size.
+  road_mesh.mesh.materials.resize(ReadCount(sizeof(uint64_t), file_size, &in));
+  for (std::string& material : road_mesh.mesh.materials) {
+    material = ReadString(file_size, &in);
+  }
+  road_mesh.mesh.face_offsets = ReadVector<int>(file_size, &in);
+  road_mesh.mesh.vertex_indices = ReadVector<int>(file_size, &in);
+  road_mesh.mesh.normal_indices = ReadVector<int>(file_size, &in);
+  road_mesh.mesh.face_materials = ReadVector<int>(file_size, &in);
+  // Every material takes at least the sizes of its name and of its statements.
+  road_mesh.materials.resize(ReadCount(2 * sizeof(uint64_t), file_size, &in));
+  for (Material& material : road_mesh.materials) {
+    material.name = ReadString(file_size, &in);
+    material.statements.resize(ReadCount(sizeof(uint64_t), file_size, &in));
+    for (std::string& statement : material.statements) {
+      statement = ReadString(file_size, &in);
+    }
+  }
+  MALIPUT_VALIDATE(!in.fail(), "Truncated mesh cache file: " + file_path);
+  return road_mesh;
+}
+
+}  // namespace
+
+uint64_t HashObjFeatures(const utility::ObjFeatures& features) {
+  Hasher hasher;
+  hasher.Add(kCacheVersion);
+  hasher.Add(features.max_grid_unit);
+  hasher.Add(features.min_grid_resolution);
+  hasher.Add(features.draw_stripes);
+  hasher.Add(features.draw_arrows);
+  hasher.Add(features.draw_lane_haze);
+  hasher.Add(features.draw_branch_points);
+  hasher.Add(features.draw_elevation_bounds);
+  hasher.Add(features.off_grid_mesh_generation);
+  hasher.Add(features.simplify_mesh_threshold);
+  hasher.Add(features.stripe_width);
+  hasher.Add(features.stripe_elevation);
+  hasher.Add(features.arrow_elevation);
+  hasher.Add(features.lane_haze_elevation);
+  hasher.Add(features.branch_point_elevation);
+  hasher.Add(features.branch_point_height);
+  hasher.Add(features.origin);
+  hasher.Add(static_cast<uint64_t>(features.highlighted_segments.size()));
+  for (const api::SegmentId& segment_id : features.highlighted_segments) {
+    hasher.Add(segment_id.string());
+  }
+  return hasher.hash();
+}
+
+uint64_t HashSegment(const api::Segment* segment, double sampling_step) {
+  MALIPUT_THROW_UNLESS(segment != nullptr);
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  Hasher hasher;
+  hasher.Add(segment->id().string());
+  hasher.Add(static_cast<uint64_t>(segment->num_lanes()));
+  for (int i = 0; i < segment->num_lanes(); ++i) {
+    const api::Lane* lane = segment->lane(i);
+    const double length = lane->length();
+    hasher.Add(lane->id().string());
+    hasher.Add(length);
+    const int num_samples = static_cast<int>(std::ceil(length / sampling_step)) + 1;
+    for (int j = 0; j < num_samples; ++j) {
+      const double s = std::min(j * sampling_step, length);
+      const api::RBounds lane_bounds = lane->lane_bounds(s);
+      const api::RBounds segment_bounds = lane->segment_bounds(s);
+      hasher.Add(lane_bounds.min());
+      hasher.Add(lane_bounds.max());
+      hasher.Add(segment_bounds.min());
+      hasher.Add(segment_bounds.max());
+      for (const double r : {segment_bounds.min(), lane_bounds.min(), 0., lane_bounds.max(), segment_bounds.max()}) {
+        const api::HBounds elevation_bounds = lane->elevation_bounds(s, r);
+        hasher.Add(elevation_bounds.min());
+        hasher.Add(elevation_bounds.max());
+        hasher.Add(lane->ToInertialPosition({s, r, 0.}).xyz());
+      }
+    }
+  }
+  return hasher.hash();
+}
+
+RoadMesh GenerateRoadMeshIncrementally(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                                       const IncrementalMeshOptions& options, IncrementalMeshReport* report) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  const int num_threads = ResolveNumberOfThreads(options.num_threads);
+  const double sampling_step = options.sampling_step > 0. ? options.sampling_step : features.max_grid_unit / 2.;
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+
+  std::vector<const api::Segment*> segments;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      segments.push_back(junction->segment(j));
+    }
+  }
+  const bool draw_branch_points = features.draw_branch_points && road_geometry->num_branch_points() > 0;
+  const int num_segments = static_cast<int>(segments.size());
+  const int num_units = num_segments + (draw_branch_points ? 1 : 0);
+
+  // Hashing.
+  const uint64_t features_hash = HashObjFeatures(features);
+  std::vector<uint64_t> keys(num_units);
+  ParallelFor(num_segments, num_threads, [&](int i) {
+    Hasher hasher;
+    hasher.Add(features_hash);
+    if (options.segment_fingerprint) {
+      hasher.Add(segments[i]->id().string());
+      hasher.Add(options.segment_fingerprint(segments[i]));
+    } else {
+      hasher.Add(HashSegment(segments[i], sampling_step));
+    }
+    keys[i] = hasher.hash();
+  });
+  if (draw_branch_points) {
+    // Branch points are drawn from the lanes that meet at them, so they depend on every segment.
+    Hasher hasher;
+    hasher.Add(features_hash);
+    hasher.Add(std::string("branch_points"));
+    for (int i = 0; i < num_segments; ++i) {
+      hasher.Add(keys[i]);
+    }
+    keys[num_segments] = hasher.hash();
+  }
+  std::vector<std::string> cache_paths(num_units);
+  for (int i = 0; i < num_units; ++i) {
+    cache_paths[i] = JoinPath(options.cache_dirpath, ToHex(keys[i]) + kCacheExtension);
+  }
+  const double hashing_time = timer->Elapsed();
+
+  // Loading of the cached units. Reading the files straight away, instead of checking whether they exist first,
+  // turns files evicted meanwhile by another process into misses.
+  timer->Reset();
+  std::vector<RoadMesh> unit_meshes(num_units);
+  std::vector<char> is_cached(num_units, false);
+  ParallelFor(num_units, num_threads, [&](int unit) {
+    std::optional<RoadMesh> cached = ReadCacheFile(cache_paths[unit]);
+    if (cached.has_value()) {
+      unit_meshes[unit] = std::move(*cached);
+      is_cached[unit] = true;
+      // Marks the mesh as recently used. Failing to do so only affects the eviction order.
+      std::error_code error;
+      std::filesystem::last_write_time(cache_paths[unit], std::filesystem::file_time_type::clock::now(), error);
+    }
+  });
+  const double loading_time = timer->Elapsed();
+  std::vector<int> misses;
+  for (int unit = 0; unit < num_units; ++unit) {
+    if (!is_cached[unit]) {
+      misses.push_back(unit);
+    }
+  }
+
+  // Meshing of the units that are not cached.
+  timer->Reset();
+  ParallelFor(static_cast<int>(misses.size()), num_threads, [&](int i) {
+    const int unit = misses[i];
+    const std::unique_ptr<RoadGeometryView> view =
+        unit < num_segments ? MakeSegmentView(road_geometry, segments[unit])
+                            : std::make_unique<RoadGeometryView>(road_geometry, std::vector<const api::Junction*>{},
+                                                                 true);
+    unit_meshes[unit] =
+        MeshRoadGeometry(view.get(), features, options.scratch_dirpath, "scratch_" + ToHex(keys[unit]));
+    WriteCacheFile(unit_meshes[unit], cache_paths[unit]);
+  });
+  const double meshing_time = timer->Elapsed();
+
+  // Merging.
+  timer->Reset();
+  RoadMesh result = MergeRoadMeshes(&unit_meshes);
+  const double merging_time = loading_time + timer->Elapsed();
+
+  int num_evictions{0};
+  if (options.max_cache_entries > 0) {
+    num_evictions = EvictCacheFiles(options.cache_dirpath, cache_paths, options.max_cache_entries);
+  }
+
+  if (report != nullptr) {
+    report->num_units = num_units;
+    report->num_cache_hits = num_units - static_cast<int>(misses.size());
+    report->hashing_time = hashing_time;
+    report->meshing_time = meshing_time;
+    report->merging_time = merging_time;
+    report->num_triangles = CountTriangles(result.mesh);
+    report->num_evictions = num_evictions;
+  }
+  return result;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,128 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/segment.h>
+#include <maliput/utility/generate_obj.h>
+
+#include "integration/generate_mesh.h"
+
+namespace maliput {
+namespace integration {
+
+/// Holds the configuration of GenerateRoadMeshIncrementally().
+struct IncrementalMeshOptions {
+  /// Directory that holds the cached segment meshes. It must exist. Any file in it may be deleted at any time.
+  std::string cache_dirpath{"."};
+  /// Directory where the scratch OBJ and MTL files of the meshed segments are written. It must exist. The files are
+  /// deleted once parsed.
+  std::string scratch_dirpath{"."};
+  /// Number of worker threads. See ResolveNumberOfThreads().
+  int num_threads{0};
+  /// Longitudinal distance between the samples used to hash the segments, in meters. When non-positive, half of
+  /// maliput::utility::ObjFeatures::max_grid_unit is used. Ignored when `segment_fingerprint` is set.
+  double sampling_step{0.};
+  /// When set, identifies the geometry of a segment instead of HashSegment(). It must return a different value
+  /// whenever the geometry of the segment changes, e.g. a version number or a hash of the road description the
+  /// segment is built from. It may be called concurrently.
+  std::function<std::string(const api::Segment*)> segment_fingerprint{};
+  /// Maximum number of meshes kept in the cache directory. When positive, the least recently used meshes are deleted
+  /// once the cache holds more. Otherwise, every mesh is kept.
+  int max_cache_entries{0};
+};
+
+/// Holds the measurements of an incremental mesh generation.
+struct IncrementalMeshReport {
+  /// Number of meshed units, i.e. segments plus the branch points when they are drawn.
+  int num_units{};
+  /// Number of units whose mesh was found in the cache.
+  int num_cache_hits{};
+  /// Time spent hashing the units, in seconds.
+  double hashing_time{};
+  /// Time spent meshing the units that were not cached, in seconds.
+  double meshing_time{};
+  /// Time spent loading the cached units and merging every mesh, in seconds.
+  double merging_time{};
+  /// Number of triangles of the merged mesh.
+  int64_t num_triangles{};
+  /// Number of meshes deleted from the cache to honor IncrementalMeshOptions::max_cache_entries.
+  int num_evictions{};
+};
+
+/// @returns A hash of every field of @p features.
+uint64_t HashObjFeatures(const utility::ObjFeatures& features);
+
+/// @returns A hash of the geometry of @p segment.
+///
+/// The identifiers, lengths and, every @p sampling_step meters along every lane, the lane bounds, the elevation bounds
+/// and the inertial positions of the lane centerline and bounds are hashed. Hence, edits that move, reshape or
+/// re-elevate a segment change its hash, while edits elsewhere in the road geometry don't.
+///
+/// The hash is approximate: edits that only change the geometry between samples keep the same hash, and so would
+/// reuse a stale mesh. Smaller steps narrow that gap at the cost of more lane queries. Callers that can tell when a
+/// segment changed should use IncrementalMeshOptions::segment_fingerprint instead.
+///
+/// @param segment Segment to hash. It must not be nullptr.
+/// @param sampling_step Longitudinal distance between samples, in meters. It must be positive.
+/// @throws maliput::common::assertion_error When @p segment is nullptr or @p sampling_step is not positive.
+uint64_t HashSegment(const api::Segment* segment, double sampling_step);
+
+/// Meshes @p road_geometry segment by segment, reusing the meshes cached by previous calls.
+///
+/// Every segment is keyed by the hash of its geometry and of @p features. The geometry is identified by
+/// IncrementalMeshOptions::segment_fingerprint when set, and by the approximate HashSegment() otherwise. Segments
+/// whose key is found in the cache are loaded from it; the remaining ones are meshed concurrently with
+/// maliput::utility::GenerateObjFile() and stored in the cache. Branch points, when drawn, are meshed as an extra unit
+/// keyed by every segment key. Meshes are merged in road geometry order, so the result only depends on
+/// @p road_geometry and @p features.
+///
+/// Loading a mesh marks it as used. When IncrementalMeshOptions::max_cache_entries is positive, the least recently
+/// used meshes beyond that number are deleted at the end of the call; the meshes of this call are deleted last.
+/// Cache files that are missing when they are loaded, e.g. because another process evicted them, are meshed again.
+///
+/// The backend of @p road_geometry must support concurrent const queries.
+///
+/// @param road_geometry The api::RoadGeometry to mesh. It must not be nullptr.
+/// @param features Meshing configuration.
+/// @param options Cache and concurrency configuration.
+/// @param report When not nullptr, it is filled with the measurements of the generation.
+/// @returns The merged RoadMesh.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr, a cache file is corrupt or a cache file
+///         cannot be written.
+RoadMesh GenerateRoadMeshIncrementally(const api::RoadGeometry* road_geometry, const utility::ObjFeatures& features,
+                                       const IncrementalMeshOptions& options, IncrementalMeshReport* report);
+
+}  // namespace integration
+}  // namespace maliput
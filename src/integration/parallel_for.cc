@@ -0,0 +1,206 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+int ResolveNumberOfThreads(int num_threads) {
+  if (num_threads > 0) {
+    return num_threads;
+  }
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+void ParallelFor(int num_tasks, int num_threads, const std::function<void(int)>& task) {
+  if (num_tasks <= 0) {
+    return;
+  }
+  const int num_workers = std::min(ResolveNumberOfThreads(num_threads), num_tasks);
+  if (num_workers == 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  std::atomic<int> next_task{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr first_exception;
+  std::mutex exception_mutex;
+  const auto worker = [&]() {
+    for (int i = next_task++; i < num_tasks && !failed; i = next_task++) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!failed) {
+          first_exception = std::current_exception();
+          failed = true;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (int i = 0; i < num_workers - 1; ++i) {
+    workers.emplace_back(worker);
+  }
+  // The calling thread takes part in the work as well.
+  worker();
+  for (std::thread& t : workers) {
+    t.join();
+  }
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+void OrderedParallelFor(int num_tasks, int num_threads, int max_pending_tasks, const std::function<void(int)>& task,
+                        const std::function<bool(int)>& consume) {
+  MALIPUT_THROW_UNLESS(max_pending_tasks > 0);
+  if (num_tasks <= 0) {
+    return;
+  }
+  const int num_workers = std::min(ResolveNumberOfThreads(num_threads), num_tasks);
+  if (num_workers == 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+      if (!consume(i)) {
+        return;
+      }
+    }
+    return;
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  int next_task{0};
+  int num_consumed{0};
+  bool stopped{false};
+  std::exception_ptr first_exception;
+  // Whether the task that owns each slot of the ring has finished.
+  std::vector<char> finished(max_pending_tasks, false);
+  // Records the first exception and stops every worker. `mutex` must be held.
+  const auto fail = [&]() {
+    if (!first_exception) {
+      first_exception = std::current_exception();
+    }
+    stopped = true;
+  };
+
+  const auto worker = [&]() {
+    while (true) {
+      int i{};
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() {
+          return stopped || next_task >= num_tasks || next_task < num_consumed + max_pending_tasks;
+        });
+        if (stopped || next_task >= num_tasks) {
+          return;
+        }
+        i = next_task++;
+      }
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        fail();
+        condition.notify_all();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished[i % max_pending_tasks] = true;
+      }
+      condition.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers.emplace_back(worker);
+  }
+  // The calling thread consumes the results in order while the workers run the next tasks.
+  for (int i = 0; i < num_tasks; ++i) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&]() { return stopped || finished[i % max_pending_tasks]; });
+      if (stopped) {
+        break;
+      }
+      finished[i % max_pending_tasks] = false;
+    }
+    bool keep_going{false};
+    try {
+      keep_going = consume(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      fail();
+      break;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++num_consumed;
+      stopped = !keep_going;
+    }
+    condition.notify_all();
+    if (!keep_going) {
+      break;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+  }
+  condition.notify_all();
+  for (std::thread& t : workers) {
+    t.join();
+  }
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+
+namespace maliput {
+namespace integration {
+
+/// @returns @p num_threads when it is positive, otherwise the number of concurrent threads supported by the
+/// hardware (at least one).
+int ResolveNumberOfThreads(int num_threads);
+
+/// Runs @p task for every index in [0, @p num_tasks) using up to @p num_threads worker threads.
+///
+/// Indices are handed out to the workers in increasing order, so tasks that are cheap to start first should be
+/// placed at the front. The call blocks until every task has finished.
+///
+/// @param num_tasks Number of tasks to run. When non-positive, nothing is done.
+/// @param num_threads Number of worker threads. See ResolveNumberOfThreads(). When it resolves to one, tasks are
+///                    run sequentially in the calling thread.
+/// @param task Callable that receives the task index. It must be safe to call concurrently with different indices.
+///
+/// @throws The first exception thrown by @p task, once every worker has finished. The remaining tasks are not
+///         started after a failure.
+void ParallelFor(int num_tasks, int num_threads, const std::function<void(int)>& task);
+
+/// Runs @p task for every index in [0, @p num_tasks) using up to @p num_threads worker threads and hands the results
+/// over to @p consume in increasing index order, in the calling thread.
+///
+/// At most @p max_pending_tasks tasks are started but not yet consumed at any time: task `i` does not start before
+/// `consume(i - max_pending_tasks)` has returned. Hence, tasks can store their results in a ring of
+/// @p max_pending_tasks slots indexed by `i % max_pending_tasks`, which bounds the memory in use regardless of
+/// @p num_tasks.
+///
+/// @param num_tasks Number of tasks to run. When non-positive, nothing is done.
+/// @param num_threads Number of worker threads, in addition to the calling thread. See ResolveNumberOfThreads().
+///                    When it resolves to one, every task is run and consumed sequentially in the calling thread.
+/// @param max_pending_tasks Maximum number of started tasks that are not yet consumed. It must be positive.
+/// @param task Callable that receives the task index. It must be safe to call concurrently with different indices.
+/// @param consume Callable that receives the index of a finished task. When it returns false, no further task is
+///                started nor consumed.
+///
+/// @throws maliput::common::assertion_error When @p max_pending_tasks is not positive.
+/// @throws The first exception thrown by @p task or @p consume, once every worker has finished.
+void OrderedParallelFor(int num_tasks, int num_threads, int max_pending_tasks, const std::function<void(int)>& task,
+                        const std::function<bool(int)>& consume);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,94 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_duration_iteration_handler.h"
+
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+PhaseDurationIterationHandler::PhaseDurationIterationHandler(const Timer* timer, api::RoadNetwork* road_network,
+                                                             double default_phase_duration)
+    : DynamicEnvironmentHandler(timer, road_network),
+      default_phase_duration_(default_phase_duration),
+      phase_provider_(dynamic_cast<ManualPhaseProvider*>(road_network_->phase_provider())),
+      phase_ring_table_(road_network_->phase_ring_book(), road_network_->phase_provider()) {
+  MALIPUT_THROW_UNLESS(default_phase_duration_ > 0.);
+  const double elapsed_time = timer_->Elapsed();
+  // Every phase ring holds at most one deadline, so reserving them upfront keeps Update() from allocating.
+  std::vector<Deadline> deadlines;
+  deadlines.reserve(phase_ring_table_.num_phase_rings());
+  for (int i = 0; i < phase_ring_table_.num_phase_rings(); ++i) {
+    deadlines.emplace_back(elapsed_time + PhaseDuration(phase_ring_table_.duration_until(i)), i);
+  }
+  deadlines_ = std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>>(std::greater<Deadline>(),
+                                                                                             std::move(deadlines));
+}
+
+void PhaseDurationIterationHandler::Update() {
+  DynamicEnvironmentChanges* changes = BeginChanges();
+  const double elapsed_time = changes->time;
+  if (deadlines_.empty() || elapsed_time < deadlines_.top().first) {
+    return;
+  }
+
+  MALIPUT_THROW_UNLESS(phase_provider_ != nullptr);
+  while (!deadlines_.empty() && deadlines_.top().first <= elapsed_time) {
+    const auto [deadline, index] = deadlines_.top();
+    deadlines_.pop();
+    if (const PhaseStateChanges* state_changes = phase_ring_table_.Advance(index, phase_provider_)) {
+      changes->Append(phase_ring_table_.phase_ring_id(index), phase_ring_table_.phase_id(index), *state_changes);
+      changes->deadlines.push_back(deadline);
+    }
+    // Phase rings without a next phase never change again.
+    if (!phase_ring_table_.has_next_phase(index)) {
+      continue;
+    }
+    // Keeps the phases aligned with their schedule, unless the updates fell behind by more than a phase.
+    const double duration = PhaseDuration(phase_ring_table_.duration_until(index));
+    deadlines_.emplace(elapsed_time - deadline < duration ? deadline + duration : elapsed_time + duration, index);
+  }
+  PublishChanges();
+}
+
+std::optional<double> PhaseDurationIterationHandler::NextUpdateTime() const {
+  if (deadlines_.empty()) {
+    return std::nullopt;
+  }
+  return deadlines_.top().first;
+}
+
+double PhaseDurationIterationHandler::PhaseDuration(const std::optional<double>& duration_until) const {
+  return duration_until.has_value() && *duration_until > 0. ? *duration_until : default_phase_duration_;
+}
+
+}  // namespace integration
+}  // namespace maliput
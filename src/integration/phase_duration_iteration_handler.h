@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_handler.h"
+#include "integration/phase_ring_table.h"
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// DynamicEnvironmentHandler class implementation.
+/// Every phase ring advances on its own, once the `duration_until` of its current phase elapses. Phases without a
+/// duration last `default_phase_duration` seconds.
+///
+/// The deadline of every phase ring is kept in a min-heap, so Update() only visits the phase rings whose deadline has
+/// passed and its cost scales with the number of transitions rather than with the number of phase rings.
+class PhaseDurationIterationHandler : public DynamicEnvironmentHandler {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(PhaseDurationIterationHandler)
+  PhaseDurationIterationHandler() = delete;
+
+  /// Constructs a PhaseDurationIterationHandler. The current phase of every phase ring is deemed to start at the
+  /// current time of @p timer.
+  /// @param timer Timer implementation pointer.
+  /// @param road_network maliput::api::RoadNetwork pointer.
+  /// @param default_phase_duration The duration of the phases without `duration_until`, in seconds.
+  PhaseDurationIterationHandler(const Timer* timer, api::RoadNetwork* road_network, double default_phase_duration);
+
+  ~PhaseDurationIterationHandler() override = default;
+
+  void Update() override;
+
+  /// @returns The earliest deadline among the phase rings, or std::nullopt when no phase ring has a next phase.
+  std::optional<double> NextUpdateTime() const override;
+
+ private:
+  // Deadline of a phase ring, as the pair of the deadline and the index of the phase ring in `phase_ring_table_`.
+  using Deadline = std::pair<double, int>;
+
+  // @returns The duration of a phase whose `duration_until` is @p duration_until.
+  double PhaseDuration(const std::optional<double>& duration_until) const;
+
+  const double default_phase_duration_{};
+  // The phase provider of `road_network_`, nullptr when it is not a ManualPhaseProvider.
+  ManualPhaseProvider* phase_provider_{};
+  PhaseRingTable phase_ring_table_;
+  std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>> deadlines_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,99 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_ring_table.h"
+
+#include <unordered_map>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+PhaseRingTable::PhaseRingTable(const api::rules::PhaseRingBook* phase_ring_book,
+                               const api::rules::PhaseProvider* phase_provider) {
+  MALIPUT_THROW_UNLESS(phase_ring_book != nullptr);
+  MALIPUT_THROW_UNLESS(phase_provider != nullptr);
+  for (const auto& phase_ring_id : phase_ring_book->GetPhaseRings()) {
+    const auto phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
+    const auto phase_provider_result = phase_provider->GetPhase(phase_ring_id);
+    if (!phase_ring.has_value() || !phase_provider_result.has_value() || !phase_provider_result->next.has_value()) {
+      continue;
+    }
+
+    PhaseRingEntry entry{phase_ring_id, {}, 0, -1, phase_provider_result->next->duration_until, {}, true};
+    std::unordered_map<api::rules::Phase::Id, int> phase_indices;
+    for (const auto& phase : phase_ring->phases()) {
+      phase_indices.emplace(phase.first, static_cast<int>(entry.phases.size()));
+      entry.phases.push_back(PhaseEntry{phase.first, std::nullopt, -1, std::nullopt, {}});
+    }
+    for (PhaseEntry& phase : entry.phases) {
+      const auto next_phases = phase_ring->GetNextPhases(phase.id);
+      if (next_phases.empty()) {
+        continue;
+      }
+      const auto next_it = phase_indices.find(next_phases.front().id);
+      MALIPUT_THROW_UNLESS(next_it != phase_indices.end());
+      phase.next_id = next_phases.front().id;
+      phase.next = next_it->second;
+      phase.duration_until = next_phases.front().duration_until;
+      phase.changes = DiffPhases(phase_ring->phases().at(phase.id), phase_ring->phases().at(next_phases.front().id));
+    }
+    const auto current_it = phase_indices.find(phase_provider_result->state);
+    const auto next_it = phase_indices.find(phase_provider_result->next->state);
+    // Phases outside of the phase ring can't be followed.
+    if (current_it == phase_indices.end() || next_it == phase_indices.end()) {
+      continue;
+    }
+    entry.current = current_it->second;
+    entry.next = next_it->second;
+    entry.initial_changes = DiffPhases(phase_ring->phases().at(phase_provider_result->state),
+                                       phase_ring->phases().at(phase_provider_result->next->state));
+    phase_rings_.push_back(std::move(entry));
+  }
+}
+
+const PhaseStateChanges* PhaseRingTable::Advance(int index, ManualPhaseProvider* phase_provider) {
+  PhaseRingEntry& phase_ring = phase_rings_[index];
+  if (phase_ring.next < 0) {
+    return nullptr;
+  }
+  const PhaseStateChanges* changes =
+      phase_ring.initial ? &phase_ring.initial_changes : &phase_ring.phases[phase_ring.current].changes;
+  const PhaseEntry& phase = phase_ring.phases[phase_ring.next];
+  phase_provider->SetPhase(phase_ring.id, phase.id, phase.next_id, phase.duration_until);
+  phase_ring.initial = false;
+  phase_ring.current = phase_ring.next;
+  phase_ring.next = phase.next;
+  phase_ring.duration_until = phase.duration_until;
+  return changes;
+}
+
+}  // namespace integration
+}  // namespace maliput
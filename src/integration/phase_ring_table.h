@@ -0,0 +1,132 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_provider.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/phase_ring_book.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_changes.h"
+
+namespace maliput {
+namespace integration {
+
+/// Precomputed phase sequences of the phase rings of a api::rules::PhaseRingBook.
+///
+/// The phase rings, their phases, the first of the next phases of every phase and the states that change along the way
+/// are resolved once at construction, so advancing a phase ring neither looks anything up by ID nor allocates memory:
+/// it only hands precomputed values to ManualPhaseProvider::SetPhase().
+///
+/// The table tracks the phases it sets, so it expects to be the only one changing the phases of its phase rings.
+class PhaseRingTable {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(PhaseRingTable)
+  PhaseRingTable() = delete;
+
+  /// Constructs a PhaseRingTable.
+  ///
+  /// Only the phase rings whose current phase, as given by @p phase_provider, and its next phase are within the phase
+  /// ring are kept. The rest never change.
+  ///
+  /// @param phase_ring_book The phase rings. It must not be nullptr.
+  /// @param phase_provider The current phases. It must not be nullptr.
+  /// @throws maliput::common::assertion_error When @p phase_ring_book or @p phase_provider is nullptr.
+  PhaseRingTable(const api::rules::PhaseRingBook* phase_ring_book, const api::rules::PhaseProvider* phase_provider);
+
+  /// @returns The number of phase rings.
+  int num_phase_rings() const { return static_cast<int>(phase_rings_.size()); }
+
+  /// @returns The ID of the @p index -th phase ring.
+  const api::rules::PhaseRing::Id& phase_ring_id(int index) const { return phase_rings_[index].id; }
+
+  /// @returns The ID of the current phase of the @p index -th phase ring.
+  const api::rules::Phase::Id& phase_id(int index) const {
+    return phase_rings_[index].phases[phase_rings_[index].current].id;
+  }
+
+  /// @returns Whether the @p index -th phase ring has a next phase.
+  bool has_next_phase(int index) const { return phase_rings_[index].next >= 0; }
+
+  /// @returns The time until the next phase of the @p index -th phase ring, if known.
+  const std::optional<double>& duration_until(int index) const { return phase_rings_[index].duration_until; }
+
+  /// Sets the next phase of the @p index -th phase ring as its current phase in @p phase_provider.
+  ///
+  /// It does nothing when the phase ring has no next phase. Neither this method nor ManualPhaseProvider::SetPhase()
+  /// allocates memory beyond what storing the phase IDs into @p phase_provider requires.
+  ///
+  /// @param index Index of the phase ring. It must be in [0, num_phase_rings()).
+  /// @param phase_provider The provider to update. It must not be nullptr.
+  /// @returns The states that changed, or nullptr when the phase ring has no next phase. It remains valid as long as
+  ///          this table.
+  const PhaseStateChanges* Advance(int index, ManualPhaseProvider* phase_provider);
+
+ private:
+  // A phase along with the first of its next phases.
+  struct PhaseEntry {
+    api::rules::Phase::Id id;
+    // ID of the next phase, if any.
+    std::optional<api::rules::Phase::Id> next_id;
+    // Index of the next phase in the phase ring's `phases`, -1 when there is none.
+    int next{-1};
+    // Time until the next phase, if known.
+    std::optional<double> duration_until;
+    // States that change when moving to the next phase.
+    PhaseStateChanges changes;
+  };
+
+  // Sequence of phases of a phase ring along with its state.
+  struct PhaseRingEntry {
+    api::rules::PhaseRing::Id id;
+    std::vector<PhaseEntry> phases;
+    // Index of the current phase.
+    int current{};
+    // Index of the phase that comes next, -1 when there is none.
+    int next{-1};
+    // Time until the next phase, if known.
+    std::optional<double> duration_until;
+    // States that change when moving from the initial phase to the one that follows it according to the phase
+    // provider, which may differ from the phase ring's next phase.
+    PhaseStateChanges initial_changes;
+    // Whether the phase ring is still in its initial phase.
+    bool initial{true};
+  };
+
+  std::vector<PhaseRingEntry> phase_rings_;
+};
+
+}  // namespace integration
+}  // namespace maliput
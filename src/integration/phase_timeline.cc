@@ -0,0 +1,223 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_timeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of significant digits used to export times.
+constexpr int kPrecision{15};
+
+}  // namespace
+
+PhaseTimeline::PhaseTimeline(const api::rules::PhaseRingBook* phase_ring_book,
+                             const api::rules::PhaseProvider* phase_provider, double default_phase_duration) {
+  MALIPUT_THROW_UNLESS(phase_ring_book != nullptr);
+  MALIPUT_THROW_UNLESS(phase_provider != nullptr);
+  MALIPUT_THROW_UNLESS(default_phase_duration > 0.);
+  const auto phase_duration = [default_phase_duration](const std::optional<double>& duration_until) {
+    return duration_until.has_value() && *duration_until > 0. ? *duration_until : default_phase_duration;
+  };
+
+  for (const auto& phase_ring_id : phase_ring_book->GetPhaseRings()) {
+    const auto phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
+    const auto phase_provider_result = phase_provider->GetPhase(phase_ring_id);
+    if (!phase_ring.has_value() || !phase_provider_result.has_value()) {
+      continue;
+    }
+
+    RingTimeline timeline{phase_ring_id, {}, {}, {}, -1, std::numeric_limits<double>::infinity()};
+    std::unordered_map<api::rules::Phase::Id, int> phase_indices;
+    // @returns The index into `timeline.phases` of @p phase_id, adding it when missing.
+    const auto phase_index = [&](const api::rules::Phase::Id& phase_id) {
+      const auto it = phase_indices.find(phase_id);
+      if (it != phase_indices.end()) {
+        return it->second;
+      }
+      const auto phase = phase_ring->GetPhase(phase_id);
+      MALIPUT_VALIDATE(phase.has_value(), "Phase " + phase_id.string() + " is not in " + phase_ring_id.string());
+      timeline.phases.push_back(*phase);
+      phase_indices.emplace(phase_id, static_cast<int>(timeline.phases.size()) - 1);
+      return static_cast<int>(timeline.phases.size()) - 1;
+    };
+
+    // The first transition comes from the phase provider and the rest from the phase ring, so the timeline repeats
+    // once a phase reached through the phase ring shows up again.
+    std::unordered_map<int, int> first_entries;
+    int phase = phase_index(phase_provider_result->state);
+    std::optional<api::rules::Phase::Id> next_phase_id;
+    std::optional<double> duration_until;
+    if (phase_provider_result->next.has_value()) {
+      next_phase_id = phase_provider_result->next->state;
+      duration_until = phase_provider_result->next->duration_until;
+    }
+    double time{0.};
+    while (true) {
+      if (!timeline.start_times.empty()) {
+        const auto first_entry = first_entries.find(phase);
+        if (first_entry != first_entries.end()) {
+          timeline.cycle_start = first_entry->second;
+          timeline.end_time = time;
+          break;
+        }
+        first_entries.emplace(phase, static_cast<int>(timeline.start_times.size()));
+      }
+      timeline.start_times.push_back(time);
+      timeline.phase_indices.push_back(phase);
+      if (!next_phase_id.has_value()) {
+        break;
+      }
+      time += phase_duration(duration_until);
+      phase = phase_index(*next_phase_id);
+      const auto next_phases = phase_ring->GetNextPhases(*next_phase_id);
+      next_phase_id.reset();
+      duration_until.reset();
+      if (!next_phases.empty()) {
+        next_phase_id = next_phases.front().id;
+        duration_until = next_phases.front().duration_until;
+      }
+    }
+    timeline_indices_.emplace(phase_ring_id, static_cast<int>(timelines_.size()));
+    timelines_.push_back(std::move(timeline));
+  }
+}
+
+std::vector<api::rules::PhaseRing::Id> PhaseTimeline::GetPhaseRings() const {
+  std::vector<api::rules::PhaseRing::Id> phase_ring_ids;
+  phase_ring_ids.reserve(timelines_.size());
+  for (const RingTimeline& timeline : timelines_) {
+    phase_ring_ids.push_back(timeline.id);
+  }
+  return phase_ring_ids;
+}
+
+std::optional<double> PhaseTimeline::GetPeriod(const api::rules::PhaseRing::Id& phase_ring_id) const {
+  const RingTimeline& timeline = GetRingTimeline(phase_ring_id);
+  if (timeline.cycle_start < 0) {
+    return std::nullopt;
+  }
+  return timeline.end_time - timeline.start_times[timeline.cycle_start];
+}
+
+PhaseTimeline::Interval PhaseTimeline::GetInterval(const api::rules::PhaseRing::Id& phase_ring_id,
+                                                   double time) const {
+  MALIPUT_THROW_UNLESS(time >= 0.);
+  const RingTimeline& timeline = GetRingTimeline(phase_ring_id);
+  // Shifts `time` into the first period of a periodic timeline.
+  double offset{0.};
+  if (timeline.cycle_start >= 0 && time >= timeline.end_time) {
+    const double cycle_start_time = timeline.start_times[timeline.cycle_start];
+    const double period = timeline.end_time - cycle_start_time;
+    offset = std::floor((time - cycle_start_time) / period) * period;
+    // Rounding may leave the shifted time just outside of the period.
+    if (time - offset >= timeline.end_time) {
+      offset += period;
+    } else if (time - offset < cycle_start_time) {
+      offset -= period;
+    }
+  }
+  const auto it = std::upper_bound(timeline.start_times.begin(), timeline.start_times.end(), time - offset);
+  const int entry = static_cast<int>(it - timeline.start_times.begin()) - 1;
+  const double end_time = it != timeline.start_times.end() ? *it : timeline.end_time;
+  return {timeline.start_times[entry] + offset, end_time + offset, &timeline.phases[timeline.phase_indices[entry]]};
+}
+
+std::optional<api::rules::DiscreteValueRule::DiscreteValue> PhaseTimeline::GetDiscreteValueRuleState(
+    const api::rules::PhaseRing::Id& phase_ring_id, const api::rules::Rule::Id& rule_id, double time) const {
+  const api::rules::DiscreteValueRuleStates& states = GetPhase(phase_ring_id, time).discrete_value_rule_states();
+  const auto it = states.find(rule_id);
+  if (it == states.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+std::optional<api::rules::BulbState> PhaseTimeline::GetBulbState(const api::rules::PhaseRing::Id& phase_ring_id,
+                                                                 const api::rules::UniqueBulbId& bulb_id,
+                                                                 double time) const {
+  const std::optional<api::rules::BulbStates>& states = GetPhase(phase_ring_id, time).bulb_states();
+  if (!states.has_value()) {
+    return std::nullopt;
+  }
+  const auto it = states->find(bulb_id);
+  if (it == states->end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void PhaseTimeline::WriteCsv(double end_time, std::ostream* out) const {
+  MALIPUT_THROW_UNLESS(end_time >= 0.);
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  char buffer[64];
+  (*out) << "phase_ring_id,start_time,end_time,phase_id\n";
+  for (const RingTimeline& timeline : timelines_) {
+    const int num_entries = static_cast<int>(timeline.start_times.size());
+    double offset{0.};
+    int entry{0};
+    while (timeline.start_times[entry] + offset < end_time) {
+      const double start_time = timeline.start_times[entry] + offset;
+      const double entry_end_time =
+          (entry + 1 < num_entries ? timeline.start_times[entry + 1] : timeline.end_time) + offset;
+      const int length = std::snprintf(buffer, sizeof(buffer), ",%.*g,%.*g,", kPrecision, start_time, kPrecision,
+                                       std::min(entry_end_time, end_time));
+      (*out) << timeline.id.string();
+      out->write(buffer, length);
+      (*out) << timeline.phases[timeline.phase_indices[entry]].id().string() << "\n";
+      if (entry + 1 < num_entries) {
+        ++entry;
+      } else if (timeline.cycle_start >= 0) {
+        offset += timeline.end_time - timeline.start_times[timeline.cycle_start];
+        entry = timeline.cycle_start;
+      } else {
+        break;
+      }
+    }
+  }
+  MALIPUT_VALIDATE(static_cast<bool>(*out), "Could not write the phase timeline.");
+}
+
+const PhaseTimeline::RingTimeline& PhaseTimeline::GetRingTimeline(
+    const api::rules::PhaseRing::Id& phase_ring_id) const {
+  const auto it = timeline_indices_.find(phase_ring_id);
+  MALIPUT_VALIDATE(it != timeline_indices_.end(), "Unknown phase ring: " + phase_ring_id.string());
+  return timelines_[it->second];
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_provider.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/phase_ring_book.h>
+#include <maliput/api/rules/traffic_lights.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Timeline of the phases every phase ring goes through, as iterated by PhaseDurationIterationHandler.
+///
+/// Each phase ring starts at time zero in its current phase, as given by a api::rules::PhaseProvider, and then follows
+/// the first of the next phases of every phase. Phases last their `duration_until`, or a default duration when they
+/// have none. The sequence is unrolled once until it either reaches a phase without a next phase, which then lasts
+/// forever, or repeats, in which case it is deemed periodic. Hence, the state of any phase ring at any time is found
+/// by a binary search over its timeline.
+class PhaseTimeline {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(PhaseTimeline)
+  PhaseTimeline() = delete;
+
+  /// Interval of time during which a phase ring is in a phase.
+  struct Interval {
+    /// Time at which the phase starts, in seconds.
+    double start_time{};
+    /// Time at which the phase ends, in seconds. It is infinite when the phase never ends.
+    double end_time{};
+    /// The phase.
+    const api::rules::Phase* phase{};
+  };
+
+  /// Constructs a PhaseTimeline.
+  ///
+  /// Phase rings without a current phase in @p phase_provider are left out.
+  ///
+  /// @param phase_ring_book The phase rings. It must not be nullptr.
+  /// @param phase_provider The phases at time zero. It must not be nullptr.
+  /// @param default_phase_duration The duration of the phases without a positive `duration_until`, in seconds. It must
+  ///                               be positive.
+  /// @throws maliput::common::assertion_error When any of the preconditions isn't met.
+  PhaseTimeline(const api::rules::PhaseRingBook* phase_ring_book, const api::rules::PhaseProvider* phase_provider,
+                double default_phase_duration);
+
+  /// @returns The IDs of the phase rings in the timeline.
+  std::vector<api::rules::PhaseRing::Id> GetPhaseRings() const;
+
+  /// @returns The period of the timeline of @p phase_ring_id in seconds, or std::nullopt when it reaches a phase that
+  ///          never ends.
+  /// @throws maliput::common::assertion_error When @p phase_ring_id is not in the timeline.
+  std::optional<double> GetPeriod(const api::rules::PhaseRing::Id& phase_ring_id) const;
+
+  /// @returns The interval that contains @p time for @p phase_ring_id. The interval of a periodic timeline is shifted
+  ///          to the period that contains @p time.
+  /// @throws maliput::common::assertion_error When @p phase_ring_id is not in the timeline or @p time is negative.
+  Interval GetInterval(const api::rules::PhaseRing::Id& phase_ring_id, double time) const;
+
+  /// @returns The phase of @p phase_ring_id at @p time. See GetInterval().
+  const api::rules::Phase& GetPhase(const api::rules::PhaseRing::Id& phase_ring_id, double time) const {
+    return *GetInterval(phase_ring_id, time).phase;
+  }
+
+  /// @returns The state of @p rule_id, e.g. a right-of-way rule, set by the phase of @p phase_ring_id at @p time, or
+  ///          std::nullopt when the phase doesn't set it. See GetInterval().
+  std::optional<api::rules::DiscreteValueRule::DiscreteValue> GetDiscreteValueRuleState(
+      const api::rules::PhaseRing::Id& phase_ring_id, const api::rules::Rule::Id& rule_id, double time) const;
+
+  /// @returns The state of @p bulb_id set by the phase of @p phase_ring_id at @p time, or std::nullopt when the phase
+  ///          doesn't set it. See GetInterval().
+  std::optional<api::rules::BulbState> GetBulbState(const api::rules::PhaseRing::Id& phase_ring_id,
+                                                    const api::rules::UniqueBulbId& bulb_id, double time) const;
+
+  /// Writes the intervals of every phase ring that start before @p end_time as CSV, with a header and one
+  /// `phase_ring_id,start_time,end_time,phase_id` row per interval. Intervals are clipped to @p end_time.
+  ///
+  /// @param end_time Time at which the export ends, in seconds. It must be non-negative.
+  /// @param out Output stream. It must not be nullptr.
+  /// @throws maliput::common::assertion_error When any of the preconditions isn't met or @p out fails.
+  void WriteCsv(double end_time, std::ostream* out) const;
+
+ private:
+  // Unrolled sequence of phases of a phase ring.
+  struct RingTimeline {
+    api::rules::PhaseRing::Id id;
+    // Phases the phase ring goes through, each one once.
+    std::vector<api::rules::Phase> phases;
+    // Start time of every entry of the timeline.
+    std::vector<double> start_times;
+    // Index into `phases` of every entry of the timeline.
+    std::vector<int> phase_indices;
+    // Index of the entry the timeline goes back to after `end_time`, -1 when the last entry lasts forever.
+    int cycle_start{-1};
+    // End time of the last entry, infinite when it lasts forever.
+    double end_time{};
+  };
+
+  // @returns The timeline of @p phase_ring_id.
+  const RingTimeline& GetRingTimeline(const api::rules::PhaseRing::Id& phase_ring_id) const;
+
+  std::vector<RingTimeline> timelines_;
+  std::unordered_map<api::rules::PhaseRing::Id, int> timeline_indices_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,134 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_geometry_view.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The number of lanes of @p junction, used as an estimation of the cost of processing it.
+int CountLanes(const api::Junction* junction) {
+  int num_lanes{0};
+  for (int i = 0; i < junction->num_segments(); ++i) {
+    num_lanes += junction->segment(i)->num_lanes();
+  }
+  return num_lanes;
+}
+
+// @returns The raw pointers of @p junctions.
+std::vector<const api::Junction*> GetPointers(const std::vector<std::unique_ptr<JunctionView>>& junctions) {
+  std::vector<const api::Junction*> pointers;
+  for (const std::unique_ptr<JunctionView>& junction : junctions) {
+    pointers.push_back(junction.get());
+  }
+  return pointers;
+}
+
+}  // namespace
+
+JunctionView::JunctionView(const api::Junction* junction, std::vector<const api::Segment*> segments)
+    : junction_(junction), segments_(std::move(segments)) {
+  MALIPUT_THROW_UNLESS(junction_ != nullptr);
+  for (const api::Segment* segment : segments_) {
+    MALIPUT_THROW_UNLESS(segment != nullptr);
+  }
+}
+
+RoadGeometryView::RoadGeometryView(const api::RoadGeometry* road_geometry, std::vector<const api::Junction*> junctions,
+                                   bool include_branch_points)
+    : road_geometry_(road_geometry), junctions_(std::move(junctions)), include_branch_points_(include_branch_points) {
+  MALIPUT_THROW_UNLESS(road_geometry_ != nullptr);
+  for (const api::Junction* junction : junctions_) {
+    MALIPUT_THROW_UNLESS(junction != nullptr);
+  }
+}
+
+RoadGeometryView::RoadGeometryView(const api::RoadGeometry* road_geometry,
+                                   std::vector<std::unique_ptr<JunctionView>> junctions, bool include_branch_points)
+    : RoadGeometryView(road_geometry, GetPointers(junctions), include_branch_points) {
+  owned_junctions_ = std::move(junctions);
+}
+
+int RoadGeometryView::do_num_branch_points() const {
+  return include_branch_points_ ? road_geometry_->num_branch_points() : 0;
+}
+
+const api::BranchPoint* RoadGeometryView::do_branch_point(int index) const {
+  MALIPUT_THROW_UNLESS(include_branch_points_);
+  return road_geometry_->branch_point(index);
+}
+
+std::vector<std::unique_ptr<RoadGeometryView>> SplitRoadGeometry(const api::RoadGeometry* road_geometry,
+                                                                 int num_chunks) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(num_chunks > 0);
+  int total_lanes{0};
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    total_lanes += CountLanes(road_geometry->junction(i));
+  }
+  // Junctions are accumulated until the chunk reaches its share of lanes.
+  const int lanes_per_chunk = std::max(1, (total_lanes + num_chunks - 1) / num_chunks);
+  std::vector<std::unique_ptr<RoadGeometryView>> views;
+  std::vector<const api::Junction*> junctions;
+  int num_lanes{0};
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    junctions.push_back(junction);
+    num_lanes += CountLanes(junction);
+    if (num_lanes >= lanes_per_chunk && static_cast<int>(views.size()) < num_chunks - 1) {
+      views.push_back(std::make_unique<RoadGeometryView>(road_geometry, std::move(junctions), views.empty()));
+      junctions.clear();
+      num_lanes = 0;
+    }
+  }
+  if (!junctions.empty() || views.empty()) {
+    views.push_back(std::make_unique<RoadGeometryView>(road_geometry, std::move(junctions), views.empty()));
+  }
+  return views;
+}
+
+std::unique_ptr<RoadGeometryView> MakeSegmentView(const api::RoadGeometry* road_geometry,
+                                                  const api::Segment* segment) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(segment != nullptr);
+  std::vector<std::unique_ptr<JunctionView>> junctions;
+  junctions.push_back(std::make_unique<JunctionView>(segment->junction(), std::vector<const api::Segment*>{segment}));
+  return std::make_unique<RoadGeometryView>(road_geometry, std::move(junctions), false);
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,145 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+/// api::Junction that exposes a subset of the segments of another api::Junction.
+///
+/// Every query other than the segment enumeration is delegated to the underlying api::Junction.
+class JunctionView : public api::Junction {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(JunctionView)
+
+  /// Constructs a JunctionView.
+  ///
+  /// @param junction The viewed api::Junction. It must not be nullptr and must outlive this view.
+  /// @param segments The segments to expose. They must belong to @p junction.
+  /// @throws maliput::common::assertion_error When @p junction or any of @p segments is nullptr.
+  JunctionView(const api::Junction* junction, std::vector<const api::Segment*> segments);
+
+  ~JunctionView() override = default;
+
+ private:
+  api::JunctionId do_id() const override { return junction_->id(); }
+  const api::RoadGeometry* do_road_geometry() const override { return junction_->road_geometry(); }
+  int do_num_segments() const override { return static_cast<int>(segments_.size()); }
+  const api::Segment* do_segment(int index) const override { return segments_.at(index); }
+
+  const api::Junction* junction_{};
+  const std::vector<const api::Segment*> segments_;
+};
+
+/// api::RoadGeometry that exposes a subset of the junctions of another api::RoadGeometry.
+///
+/// It allows consumers that only accept a whole api::RoadGeometry, e.g. maliput::utility::GenerateObjFile(), to
+/// process a part of a road network. Every query other than the junction and branch point enumeration is delegated to
+/// the underlying api::RoadGeometry, so the exposed junctions keep referring to it.
+class RoadGeometryView : public api::RoadGeometry {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RoadGeometryView)
+
+  /// Constructs a RoadGeometryView.
+  ///
+  /// @param road_geometry The viewed api::RoadGeometry. It must not be nullptr and must outlive this view.
+  /// @param junctions The junctions to expose. They must belong to @p road_geometry.
+  /// @param include_branch_points Whether the branch points of @p road_geometry are exposed as well.
+  /// @throws maliput::common::assertion_error When @p road_geometry or any of @p junctions is nullptr.
+  RoadGeometryView(const api::RoadGeometry* road_geometry, std::vector<const api::Junction*> junctions,
+                   bool include_branch_points);
+
+  /// Constructs a RoadGeometryView that owns the exposed junctions.
+  ///
+  /// @param road_geometry The viewed api::RoadGeometry. It must not be nullptr and must outlive this view.
+  /// @param junctions The junctions to expose. They must view junctions of @p road_geometry.
+  /// @param include_branch_points Whether the branch points of @p road_geometry are exposed as well.
+  /// @throws maliput::common::assertion_error When @p road_geometry or any of @p junctions is nullptr.
+  RoadGeometryView(const api::RoadGeometry* road_geometry, std::vector<std::unique_ptr<JunctionView>> junctions,
+                   bool include_branch_points);
+
+  ~RoadGeometryView() override = default;
+
+ private:
+  api::RoadGeometryId do_id() const override { return road_geometry_->id(); }
+  int do_num_junctions() const override { return static_cast<int>(junctions_.size()); }
+  const api::Junction* do_junction(int index) const override { return junctions_.at(index); }
+  int do_num_branch_points() const override;
+  const api::BranchPoint* do_branch_point(int index) const override;
+  const IdIndex& DoById() const override { return road_geometry_->ById(); }
+  api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                           const std::optional<api::RoadPosition>& hint) const override {
+    return road_geometry_->ToRoadPosition(inertial_position, hint);
+  }
+  std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
+                                                           double radius) const override {
+    return road_geometry_->FindRoadPositions(inertial_position, radius);
+  }
+  double do_linear_tolerance() const override { return road_geometry_->linear_tolerance(); }
+  double do_angular_tolerance() const override { return road_geometry_->angular_tolerance(); }
+  double do_scale_length() const override { return road_geometry_->scale_length(); }
+  math::Vector3 do_inertial_to_backend_frame_translation() const override {
+    return road_geometry_->inertial_to_backend_frame_translation();
+  }
+
+  const api::RoadGeometry* road_geometry_{};
+  const std::vector<const api::Junction*> junctions_;
+  const bool include_branch_points_{};
+  std::vector<std::unique_ptr<JunctionView>> owned_junctions_;
+};
+
+/// @returns A RoadGeometryView of @p road_geometry that only exposes @p segment, within a view of its junction.
+/// @throws maliput::common::assertion_error When @p road_geometry or @p segment is nullptr.
+std::unique_ptr<RoadGeometryView> MakeSegmentView(const api::RoadGeometry* road_geometry,
+                                                  const api::Segment* segment);
+
+/// Splits the junctions of @p road_geometry into at most @p num_chunks views of contiguous junctions with a similar
+/// number of lanes each. Only the first view exposes the branch points.
+///
+/// @param road_geometry The viewed api::RoadGeometry. It must not be nullptr and must outlive the views.
+/// @param num_chunks Maximum number of views. It must be positive.
+/// @returns The views, in the same order as the junctions of @p road_geometry. No view is empty, unless
+///          @p road_geometry has no junctions, in which case a single empty view is returned.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or @p num_chunks is not positive.
+std::vector<std::unique_ptr<RoadGeometryView>> SplitRoadGeometry(const api::RoadGeometry* road_geometry,
+                                                                 int num_chunks);
+
+}  // namespace integration
+}  // namespace maliput
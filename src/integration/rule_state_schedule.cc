@@ -0,0 +1,101 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/rule_state_schedule.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <maliput/common/maliput_throw.h>
+#include <yaml-cpp/yaml.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Parses an event node.
+RuleStateEvent ParseEvent(const YAML::Node& node) {
+  MALIPUT_VALIDATE(node.IsMap(), "Rule state schedule events must be maps.");
+  MALIPUT_VALIDATE(node["time"].IsDefined() && node["rule"].IsDefined(),
+                   "Rule state schedule events must have a time and a rule.");
+  const YAML::Node& value = node["value"];
+  const YAML::Node& range = node["range"];
+  MALIPUT_VALIDATE(value.IsDefined() != range.IsDefined(),
+                   "Rule state schedule events must have either a value or a range.");
+  RuleStateEvent event;
+  event.time = node["time"].as<double>();
+  MALIPUT_VALIDATE(event.time >= 0., "Rule state schedule event times must be non-negative.");
+  event.rule_id = api::rules::Rule::Id(node["rule"].as<std::string>());
+  if (value.IsDefined()) {
+    event.value = value.as<std::string>();
+  } else {
+    MALIPUT_VALIDATE(range.IsSequence() && range.size() == 2, "Rule state schedule ranges must be [min, max].");
+    event.min = range[0].as<double>();
+    event.max = range[1].as<double>();
+  }
+  return event;
+}
+
+}  // namespace
+
+RuleStateSchedule LoadRuleStateSchedule(const std::string& input) {
+  RuleStateSchedule schedule;
+  try {
+    const YAML::Node root = YAML::Load(input)["RuleStateSchedule"];
+    MALIPUT_VALIDATE(root.IsMap(), "Missing RuleStateSchedule map.");
+    if (root["period"].IsDefined()) {
+      schedule.period = root["period"].as<double>();
+      MALIPUT_VALIDATE(*schedule.period > 0., "The rule state schedule period must be positive.");
+    }
+    const YAML::Node& events = root["events"];
+    if (events.IsDefined()) {
+      MALIPUT_VALIDATE(events.IsSequence(), "Rule state schedule events must be a sequence.");
+      schedule.events.reserve(events.size());
+      for (const YAML::Node& event : events) {
+        schedule.events.push_back(ParseEvent(event));
+        MALIPUT_VALIDATE(!schedule.period.has_value() || schedule.events.back().time < *schedule.period,
+                         "Rule state schedule event times must be less than the period.");
+      }
+    }
+  } catch (const YAML::Exception& e) {
+    MALIPUT_THROW_MESSAGE(std::string("Malformed rule state schedule: ") + e.what());
+  }
+  return schedule;
+}
+
+RuleStateSchedule LoadRuleStateScheduleFromFile(const std::string& file_path) {
+  std::ifstream file(file_path);
+  MALIPUT_VALIDATE(file.is_open(), "Could not open rule state schedule file: " + file_path);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return LoadRuleStateSchedule(buffer.str());
+}
+
+}  // namespace integration
+}  // namespace maliput
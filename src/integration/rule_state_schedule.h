@@ -0,0 +1,94 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <maliput/api/rules/rule.h>
+
+namespace maliput {
+namespace integration {
+
+/// Change of the state of a rule at a given time.
+///
+/// The new state is described by its value: exactly one of `value`, for DiscreteValueRules, or `min` and `max`, for
+/// RangeValueRules, is set. It is resolved against the states of the rule when the schedule is applied.
+struct RuleStateEvent {
+  /// Time at which the state changes, in seconds.
+  double time{};
+  /// ID of the rule whose state changes.
+  api::rules::Rule::Id rule_id{"none"};
+  /// Value of the new state of a DiscreteValueRule.
+  std::optional<std::string> value;
+  /// Lower bound of the new state of a RangeValueRule.
+  std::optional<double> min;
+  /// Upper bound of the new state of a RangeValueRule.
+  std::optional<double> max;
+};
+
+/// Sequence of rule state changes over time, e.g. variable speed limits or time-of-day lane directions.
+struct RuleStateSchedule {
+  /// When set, the events repeat every `period` seconds, e.g. 86400 for a daily schedule. Event times are then
+  /// relative to the start of each period.
+  std::optional<double> period;
+  /// Events of the schedule, in any order. Events with the same time are applied in this order.
+  std::vector<RuleStateEvent> events;
+};
+
+/// Parses a RuleStateSchedule from YAML.
+///
+/// The expected format is:
+/// @code{.yaml}
+/// RuleStateSchedule:
+///   period: 86400  # Optional.
+///   events:
+///     - time: 25200
+///       rule: "Direction-Usage Rule Type/1_0_1"
+///       value: "WithS"
+///     - time: 32400
+///       rule: "Speed-Limit Rule Type/1_0_1"
+///       range: [0., 16.7]
+/// @endcode
+///
+/// @param input YAML document.
+/// @returns The parsed RuleStateSchedule.
+/// @throws maliput::common::assertion_error When the document is malformed, an event has both or none of `value` and
+///         `range`, an event time is negative, or the period is not positive or not greater than every event time.
+RuleStateSchedule LoadRuleStateSchedule(const std::string& input);
+
+/// Parses the RuleStateSchedule YAML file at @p file_path. See LoadRuleStateSchedule().
+///
+/// @throws maliput::common::assertion_error When the file can't be opened.
+RuleStateSchedule LoadRuleStateScheduleFromFile(const std::string& file_path);
+
+}  // namespace integration
+}  // namespace maliput
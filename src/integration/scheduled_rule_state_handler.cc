@@ -0,0 +1,174 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/scheduled_rule_state_handler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Relative tolerance to match the bounds of a scheduled range with the bounds of a state of its rule, as both may have
+// been parsed from text with different numbers of digits.
+constexpr double kRangeTolerance{1e-6};
+
+// @returns Whether @p lhs and @p rhs are equal within kRangeTolerance.
+bool IsClose(double lhs, double rhs) {
+  return std::abs(lhs - rhs) <= kRangeTolerance * std::max({1., std::abs(lhs), std::abs(rhs)});
+}
+
+}  // namespace
+
+ScheduledRuleStateHandler::ScheduledRuleStateHandler(const Timer* timer, api::RoadNetwork* road_network,
+                                                     const RuleStateSchedule& schedule)
+    : DynamicEnvironmentHandler(timer, road_network),
+      period_(schedule.period),
+      discrete_value_rule_state_provider_(
+          dynamic_cast<ManualDiscreteValueRuleStateProvider*>(road_network_->discrete_value_rule_state_provider())),
+      range_value_rule_state_provider_(
+          dynamic_cast<ManualRangeValueRuleStateProvider*>(road_network_->range_value_rule_state_provider())) {
+  MALIPUT_THROW_UNLESS(!period_.has_value() || *period_ > 0.);
+  const api::rules::RoadRulebook* rulebook = road_network_->rulebook();
+  events_.reserve(schedule.events.size());
+  for (const RuleStateEvent& event : schedule.events) {
+    MALIPUT_THROW_UNLESS(event.time >= 0. && (!period_.has_value() || event.time < *period_));
+    Event resolved{event.time, event.rule_id, std::nullopt, std::nullopt};
+    if (event.value.has_value()) {
+      MALIPUT_VALIDATE(discrete_value_rule_state_provider_ != nullptr,
+                       "Scheduling discrete value rule states requires a ManualDiscreteValueRuleStateProvider.");
+      const api::rules::DiscreteValueRule rule = rulebook->GetDiscreteValueRule(event.rule_id);
+      const auto it = std::find_if(rule.states().begin(), rule.states().end(),
+                                   [&event](const auto& state) { return state.value == *event.value; });
+      MALIPUT_VALIDATE(it != rule.states().end(),
+                       "Rule " + event.rule_id.string() + " has no state with value " + *event.value + ".");
+      resolved.discrete_value = *it;
+    } else {
+      MALIPUT_THROW_UNLESS(event.min.has_value() && event.max.has_value());
+      MALIPUT_VALIDATE(range_value_rule_state_provider_ != nullptr,
+                       "Scheduling range value rule states requires a ManualRangeValueRuleStateProvider.");
+      const api::rules::RangeValueRule rule = rulebook->GetRangeValueRule(event.rule_id);
+      const auto it = std::find_if(rule.states().begin(), rule.states().end(), [&event](const auto& state) {
+        return IsClose(state.min, *event.min) && IsClose(state.max, *event.max);
+      });
+      MALIPUT_VALIDATE(it != rule.states().end(), "Rule " + event.rule_id.string() + " has no state with range [" +
+                                                      std::to_string(*event.min) + ", " + std::to_string(*event.max) +
+                                                      "].");
+      resolved.range = *it;
+    }
+    events_.push_back(std::move(resolved));
+  }
+  std::stable_sort(events_.begin(), events_.end(),
+                   [](const Event& lhs, const Event& rhs) { return lhs.time < rhs.time; });
+
+  // Links every event to the next one of the same rule, walking backwards. Holds the first and last events of every
+  // rule seen so far.
+  std::unordered_map<api::rules::Rule::Id, std::pair<int, int>> rule_events;
+  for (int i = static_cast<int>(events_.size()) - 1; i >= 0; --i) {
+    const auto it = rule_events.find(events_[i].rule_id);
+    if (it == rule_events.end()) {
+      rule_events.emplace(events_[i].rule_id, std::make_pair(i, i));
+      continue;
+    }
+    MALIPUT_VALIDATE(events_[it->second.first].time > events_[i].time,
+                     "Rule " + events_[i].rule_id.string() + " has more than one event at the same time.");
+    events_[i].next = it->second.first;
+    it->second.first = i;
+  }
+  if (period_.has_value()) {
+    // The last event of every rule in a period is followed by its first event in the next period.
+    for (const auto& rule_event : rule_events) {
+      events_[rule_event.second.second].next = rule_event.second.first;
+    }
+    // States set in the period before the current one may still hold, so catching up starts there instead of at
+    // time zero.
+    num_periods_ = std::max<int64_t>(0, static_cast<int64_t>(std::floor(timer_->Elapsed() / *period_)) - 1);
+  }
+}
+
+void ScheduledRuleStateHandler::Update() {
+  DynamicEnvironmentChanges* changes = BeginChanges();
+  const double now = timer_->Elapsed();
+  for (std::optional<double> time = NextUpdateTime(); time.has_value() && *time <= now; time = NextUpdateTime()) {
+    Apply(next_event_, changes);
+    changes->deadlines.push_back(*time);
+    if (++next_event_ == static_cast<int>(events_.size()) && period_.has_value()) {
+      next_event_ = 0;
+      ++num_periods_;
+    }
+  }
+  PublishChanges();
+}
+
+std::optional<double> ScheduledRuleStateHandler::NextUpdateTime() const {
+  if (next_event_ >= static_cast<int>(events_.size())) {
+    return std::nullopt;
+  }
+  return EventTime(next_event_);
+}
+
+double ScheduledRuleStateHandler::EventTime(int index) const {
+  return period_.has_value() ? events_[index].time + static_cast<double>(num_periods_) * *period_
+                             : events_[index].time;
+}
+
+void ScheduledRuleStateHandler::Apply(int index, DynamicEnvironmentChanges* changes) {
+  const Event& event = events_[index];
+  const Event* next = event.next >= 0 ? &events_[event.next] : nullptr;
+  std::optional<double> duration_until;
+  if (next != nullptr) {
+    // A next event at or before this one belongs to the next period.
+    duration_until = next->time - event.time + (event.next <= index ? *period_ : 0.);
+  }
+  if (event.discrete_value.has_value()) {
+    const auto current = discrete_value_rule_state_provider_->GetState(event.rule_id);
+    discrete_value_rule_state_provider_->SetState(event.rule_id, *event.discrete_value,
+                                                  next != nullptr ? next->discrete_value : std::nullopt,
+                                                  duration_until);
+    if (!current.has_value() || current->state != *event.discrete_value) {
+      changes->discrete_value_rule_states.emplace_back(event.rule_id, *event.discrete_value);
+    }
+  } else {
+    const auto current = range_value_rule_state_provider_->GetState(event.rule_id);
+    range_value_rule_state_provider_->SetState(event.rule_id, *event.range,
+                                               next != nullptr ? next->range : std::nullopt, duration_until);
+    if (!current.has_value() || current->state != *event.range) {
+      changes->range_value_rule_states.emplace_back(event.rule_id, *event.range);
+    }
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
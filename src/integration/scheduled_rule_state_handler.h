@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/base/manual_discrete_value_rule_state_provider.h>
+#include <maliput/base/manual_range_value_rule_state_provider.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/dynamic_environment_handler.h"
+#include "integration/rule_state_schedule.h"
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// DynamicEnvironmentHandler class implementation.
+/// Applies a RuleStateSchedule to the discrete and range value rule state providers of the road network, e.g. to
+/// change speed limits or lane directions along the day. Event times are times of the timer. Along with every state,
+/// the next scheduled state of the same rule and the time until it are set.
+///
+/// The events are sorted by time once, so Update() only visits the events that are due and its cost scales with their
+/// number rather than with the size of the schedule.
+class ScheduledRuleStateHandler : public DynamicEnvironmentHandler {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ScheduledRuleStateHandler)
+  ScheduledRuleStateHandler() = delete;
+
+  /// Constructs a ScheduledRuleStateHandler.
+  /// @param timer Timer implementation pointer.
+  /// @param road_network maliput::api::RoadNetwork pointer. Its state providers must be a
+  ///        maliput::ManualDiscreteValueRuleStateProvider and a maliput::ManualRangeValueRuleStateProvider when the
+  ///        schedule has events of that kind.
+  /// @param schedule The schedule to apply. The state of every event must be one of the states of its rule in the
+  ///        rulebook of @p road_network. Ranges match the state whose bounds are equal to theirs within a relative
+  ///        tolerance of 1e-6.
+  /// @throws maliput::common::assertion_error When any of the preconditions is not met.
+  ScheduledRuleStateHandler(const Timer* timer, api::RoadNetwork* road_network, const RuleStateSchedule& schedule);
+
+  ~ScheduledRuleStateHandler() override = default;
+
+  /// Applies every event whose time has come.
+  void Update() override;
+
+  /// @returns The time of the next event, or std::nullopt when no event is left.
+  std::optional<double> NextUpdateTime() const override;
+
+ private:
+  // Event with its state resolved against the rulebook.
+  struct Event {
+    double time{};
+    api::rules::Rule::Id rule_id;
+    // Exactly one of the states below is set.
+    std::optional<api::rules::DiscreteValueRule::DiscreteValue> discrete_value;
+    std::optional<api::rules::RangeValueRule::Range> range;
+    // Index in `events_` of the next event of the same rule, -1 when there is none.
+    int next{-1};
+  };
+
+  // Applies the state of `events_[index]`.
+  void Apply(int index, DynamicEnvironmentChanges* changes);
+
+  // @returns The time of `events_[index]` in the current period.
+  double EventTime(int index) const;
+
+  const std::optional<double> period_;
+  // The state providers of `road_network_`, nullptr when they are not manual ones.
+  ManualDiscreteValueRuleStateProvider* discrete_value_rule_state_provider_{};
+  ManualRangeValueRuleStateProvider* range_value_rule_state_provider_{};
+  // Events sorted by time.
+  std::vector<Event> events_;
+  // Index in `events_` of the next event to apply.
+  int next_event_{0};
+  // Number of periods already applied.
+  int64_t num_periods_{0};
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,64 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// Timer whose time only moves forward when it is advanced explicitly, so that simulations can run faster (or
+/// slower) than real time.
+class SimulatedTimer : public Timer {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(SimulatedTimer)
+
+  /// Constructs a SimulatedTimer at zero seconds.
+  SimulatedTimer() = default;
+
+  /// Destructor.
+  ~SimulatedTimer() override = default;
+
+  /// Moves the time forward.
+  /// @param time_step Seconds to advance. It must be non-negative.
+  /// @throws maliput::common::assertion_error When @p time_step is negative.
+  void Advance(double time_step);
+
+ private:
+  void DoReset() override;
+  double DoElapsed() const override;
+
+  double elapsed_{0.};
+};
+
+}  // namespace integration
+}  // namespace maliput
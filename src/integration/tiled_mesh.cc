@@ -0,0 +1,225 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/tiled_mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+#include <maliput/common/filesystem.h>
+#include <maliput/common/maliput_throw.h>
+#include <yaml-cpp/yaml.h>
+
+#include "integration/parallel_for.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The path of the file named @p file_name in @p dirpath.
+std::string JoinPath(const std::string& dirpath, const std::string& file_name) {
+  common::Path path(dirpath);
+  path.append(file_name);
+  return path.get_path();
+}
+
+// @returns The centroid of the corners of the @p face -th face of @p mesh.
+maliput::math::Vector3 FaceCentroid(const Mesh& mesh, int face) {
+  maliput::math::Vector3 centroid{0., 0., 0.};
+  for (int corner = mesh.face_offsets[face]; corner < mesh.face_offsets[face + 1]; ++corner) {
+    centroid = centroid + mesh.vertices[mesh.vertex_indices[corner]];
+  }
+  return centroid / static_cast<double>(mesh.num_corners(face));
+}
+
+// Expands the box defined by @p min_corner and @p max_corner to contain every vertex of @p mesh.
+void ExpandBounds(const Mesh& mesh, maliput::math::Vector3* min_corner, maliput::math::Vector3* max_corner) {
+  for (const maliput::math::Vector3& v : mesh.vertices) {
+    *min_corner = {std::min(min_corner->x(), v.x()), std::min(min_corner->y(), v.y()),
+                   std::min(min_corner->z(), v.z())};
+    *max_corner = {std::max(max_corner->x(), v.x()), std::max(max_corner->y(), v.y()),
+                   std::max(max_corner->z(), v.z())};
+  }
+}
+
+// @returns A flow-styled YAML sequence with the coordinates of @p v.
+YAML::Node ToYaml(const maliput::math::Vector3& v) {
+  YAML::Node node;
+  node.SetStyle(YAML::EmitterStyle::Flow);
+  node.push_back(v.x());
+  node.push_back(v.y());
+  node.push_back(v.z());
+  return node;
+}
+
+}  // namespace
+
+std::map<std::pair<int, int>, Mesh> PartitionMesh(const Mesh& mesh, double tile_size) {
+  MALIPUT_THROW_UNLESS(tile_size > 0.);
+  std::map<std::pair<int, int>, std::vector<int>> tile_faces;
+  for (int face = 0; face < mesh.num_faces(); ++face) {
+    const maliput::math::Vector3 centroid = FaceCentroid(mesh, face);
+    const std::pair<int, int> key{static_cast<int>(std::floor(centroid.x() / tile_size)),
+                                  static_cast<int>(std::floor(centroid.y() / tile_size))};
+    tile_faces[key].push_back(face);
+  }
+  std::map<std::pair<int, int>, Mesh> tiles;
+  for (const auto& key_faces : tile_faces) {
+    tiles.emplace(key_faces.first, ExtractFaces(mesh, key_faces.second));
+  }
+  return tiles;
+}
+
+TiledMeshIndex GenerateTiledObjFiles(const api::RoadGeometry* road_geometry, const std::string& dirpath,
+                                     const std::string& fileroot, const utility::ObjFeatures& features,
+                                     const TiledMeshOptions& options) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(options.tile_size > 0.);
+  MALIPUT_THROW_UNLESS(!options.levels_of_detail.empty());
+  const int num_levels = static_cast<int>(options.levels_of_detail.size());
+  const int num_threads = ResolveNumberOfThreads(options.generation.num_threads);
+
+  TiledMeshIndex index;
+  index.tile_size = options.tile_size;
+  index.levels_of_detail = options.levels_of_detail;
+  index.material_file = fileroot + ".mtl";
+  // Keyed by (row, column) so tiles are sorted as documented.
+  std::map<std::pair<int, int>, Tile> tiles;
+  MaterialLibrary materials;
+  for (int level = 0; level < num_levels; ++level) {
+    utility::ObjFeatures level_features = features;
+    level_features.max_grid_unit = options.levels_of_detail[level].max_grid_unit;
+    level_features.simplify_mesh_threshold = options.levels_of_detail[level].simplify_mesh_threshold;
+    RoadMesh road_mesh = GenerateRoadMesh(road_geometry, level_features, options.generation, nullptr);
+    AppendMaterials(road_mesh.materials, &materials);
+    std::map<std::pair<int, int>, Mesh> partition = PartitionMesh(road_mesh.mesh, options.tile_size);
+    road_mesh = RoadMesh{};
+
+    std::vector<std::pair<std::pair<int, int>, Mesh>> level_tiles(std::make_move_iterator(partition.begin()),
+                                                                  std::make_move_iterator(partition.end()));
+    partition.clear();
+    std::vector<std::string> file_names(level_tiles.size());
+    ParallelFor(static_cast<int>(level_tiles.size()), num_threads, [&](int i) {
+      const std::pair<int, int>& key = level_tiles[i].first;
+      file_names[i] = fileroot + "_lod" + std::to_string(level) + "_x" + std::to_string(key.first) + "_y" +
+                      std::to_string(key.second) + ".obj";
+      const std::string file_path = JoinPath(dirpath, file_names[i]);
+      std::ofstream file(file_path, std::ios::binary);
+      MALIPUT_VALIDATE(file.is_open(), "Could not open OBJ file: " + file_path);
+      WriteObj(level_tiles[i].second, index.material_file, &file);
+      file.close();
+      MALIPUT_VALIDATE(!file.fail(), "Could not write OBJ file: " + file_path);
+    });
+
+    for (size_t i = 0; i < level_tiles.size(); ++i) {
+      const int column = level_tiles[i].first.first;
+      const int row = level_tiles[i].first.second;
+      const Mesh& mesh = level_tiles[i].second;
+      auto it = tiles.find({row, column});
+      if (it == tiles.end()) {
+        Tile tile;
+        tile.column = column;
+        tile.row = row;
+        tile.min_corner = mesh.vertices.front();
+        tile.max_corner = mesh.vertices.front();
+        tile.files.resize(num_levels);
+        tile.num_triangles.resize(num_levels, 0);
+        it = tiles.emplace(std::make_pair(row, column), std::move(tile)).first;
+      }
+      ExpandBounds(mesh, &it->second.min_corner, &it->second.max_corner);
+      it->second.files[level] = file_names[i];
+      it->second.num_triangles[level] = CountTriangles(mesh);
+    }
+  }
+  for (auto& key_tile : tiles) {
+    index.tiles.push_back(std::move(key_tile.second));
+  }
+
+  const std::string mtl_path = JoinPath(dirpath, index.material_file);
+  std::ofstream mtl_file(mtl_path, std::ios::binary);
+  MALIPUT_VALIDATE(mtl_file.is_open(), "Could not open MTL file: " + mtl_path);
+  WriteMtl(materials, &mtl_file);
+  mtl_file.close();
+  MALIPUT_VALIDATE(!mtl_file.fail(), "Could not write MTL file: " + mtl_path);
+  const std::string index_path = JoinPath(dirpath, fileroot + "_tiles.yaml");
+  std::ofstream index_file(index_path);
+  MALIPUT_VALIDATE(index_file.is_open(), "Could not open tile index file: " + index_path);
+  WriteTiledMeshIndex(index, &index_file);
+  index_file.close();
+  MALIPUT_VALIDATE(!index_file.fail(), "Could not write tile index file: " + index_path);
+  return index;
+}
+
+void WriteTiledMeshIndex(const TiledMeshIndex& index, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  YAML::Node root;
+  root["tile_size"] = index.tile_size;
+  root["material_file"] = index.material_file;
+  for (const LevelOfDetail& level : index.levels_of_detail) {
+    YAML::Node level_node;
+    level_node.SetStyle(YAML::EmitterStyle::Flow);
+    level_node["max_grid_unit"] = level.max_grid_unit;
+    level_node["simplify_mesh_threshold"] = level.simplify_mesh_threshold;
+    root["levels_of_detail"].push_back(level_node);
+  }
+  root["tiles"] = YAML::Node(YAML::NodeType::Sequence);
+  for (const Tile& tile : index.tiles) {
+    YAML::Node tile_node;
+    tile_node["column"] = tile.column;
+    tile_node["row"] = tile.row;
+    YAML::Node cell_node;
+    cell_node.SetStyle(YAML::EmitterStyle::Flow);
+    cell_node.push_back(tile.column * index.tile_size);
+    cell_node.push_back(tile.row * index.tile_size);
+    cell_node.push_back((tile.column + 1) * index.tile_size);
+    cell_node.push_back((tile.row + 1) * index.tile_size);
+    tile_node["cell"] = cell_node;
+    YAML::Node bounds_node;
+    bounds_node.SetStyle(YAML::EmitterStyle::Flow);
+    bounds_node["min"] = ToYaml(tile.min_corner);
+    bounds_node["max"] = ToYaml(tile.max_corner);
+    tile_node["bounds"] = bounds_node;
+    for (size_t level = 0; level < tile.files.size(); ++level) {
+      YAML::Node level_node;
+      level_node.SetStyle(YAML::EmitterStyle::Flow);
+      level_node["file"] = tile.files[level];
+      level_node["triangles"] = tile.num_triangles[level];
+      tile_node["levels"].push_back(level_node);
+    }
+    root["tiles"].push_back(tile_node);
+  }
+  YAML::Emitter emitter;
+  emitter << root;
+  (*out) << emitter.c_str() << "\n";
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,144 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/vector.h>
+#include <maliput/utility/generate_obj.h>
+
+#include "integration/generate_mesh.h"
+#include "integration/mesh.h"
+
+namespace maliput {
+namespace integration {
+
+/// Meshing parameters of a level of detail. They override the homonymous fields of maliput::utility::ObjFeatures.
+struct LevelOfDetail {
+  double max_grid_unit{};
+  double simplify_mesh_threshold{};
+};
+
+/// Holds the configuration of GenerateTiledObjFiles().
+struct TiledMeshOptions {
+  /// Side of the square tiles of the grid, in meters.
+  double tile_size{100.};
+  /// Levels of detail to generate, usually from the finest to the coarsest.
+  std::vector<LevelOfDetail> levels_of_detail;
+  /// Configuration of the mesh generation of every level of detail.
+  MeshGenerationOptions generation;
+};
+
+/// Cell of the tile grid along with the files that hold its meshes.
+struct Tile {
+  /// Column of the cell, i.e. the cell spans x in [column * tile_size, (column + 1) * tile_size).
+  int column{};
+  /// Row of the cell, i.e. the cell spans y in [row * tile_size, (row + 1) * tile_size).
+  int row{};
+  /// Minimum corner of the bounding box of the faces of every level of detail. Faces may exceed the cell.
+  maliput::math::Vector3 min_corner;
+  /// Maximum corner of the bounding box of the faces of every level of detail.
+  maliput::math::Vector3 max_corner;
+  /// Name of the OBJ file of each level of detail, empty when the tile has no faces at that level.
+  std::vector<std::string> files;
+  /// Number of triangles of each level of detail.
+  std::vector<int64_t> num_triangles;
+};
+
+/// Describes the output of GenerateTiledObjFiles().
+struct TiledMeshIndex {
+  /// Side of the square tiles of the grid, in meters.
+  double tile_size{};
+  /// Generated levels of detail.
+  std::vector<LevelOfDetail> levels_of_detail;
+  /// Name of the MTL file shared by every tile.
+  std::string material_file;
+  /// Non-empty tiles, sorted by row and then by column.
+  std::vector<Tile> tiles;
+};
+
+/// Partitions @p mesh into a grid of square tiles aligned with the inertial frame origin.
+///
+/// Faces are not split: each one is assigned to the tile that contains the XY projection of its centroid.
+///
+/// @param mesh Mesh to partition.
+/// @param tile_size Side of the tiles, in meters. It must be positive.
+/// @returns The mesh of every non-empty tile, keyed by (column, row).
+/// @throws maliput::common::assertion_error When @p tile_size is not positive.
+std::map<std::pair<int, int>, Mesh> PartitionMesh(const Mesh& mesh, double tile_size);
+
+/// Meshes @p road_geometry at several levels of detail and writes every level of every tile as a separate OBJ file.
+///
+/// The following files are written into @p dirpath:
+/// - `<fileroot>_lod<l>_x<column>_y<row>.obj`: The mesh of the tile at the l-th level of detail.
+/// - `<fileroot>.mtl`: The materials shared by every tile.
+/// - `<fileroot>_tiles.yaml`: The index of the tiles. See WriteTiledMeshIndex().
+///
+/// @param road_geometry The api::RoadGeometry to mesh. It must not be nullptr.
+/// @param dirpath Directory of the output files. It must exist.
+/// @param fileroot Base name of the output files.
+/// @param features Meshing configuration. `max_grid_unit` and `simplify_mesh_threshold` are overridden by every
+///                 level of detail.
+/// @param options Tiling configuration. At least one level of detail must be provided.
+/// @returns The index of the written tiles.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr, @p options is invalid or a file
+///         cannot be written.
+TiledMeshIndex GenerateTiledObjFiles(const api::RoadGeometry* road_geometry, const std::string& dirpath,
+                                     const std::string& fileroot, const utility::ObjFeatures& features,
+                                     const TiledMeshOptions& options);
+
+/// Serializes @p index as YAML, e.g.:
+/// @code{.yaml}
+/// tile_size: 100
+/// material_file: map.mtl
+/// levels_of_detail:
+///   - {max_grid_unit: 1, simplify_mesh_threshold: 0}
+///   - {max_grid_unit: 4, simplify_mesh_threshold: 0.05}
+/// tiles:
+///   - column: 0
+///     row: -1
+///     cell: [0, -100, 100, 0]
+///     bounds: {min: [0.5, -98.2, -0.1], max: [103.1, -0.4, 2.3]}
+///     levels:
+///       - {file: map_lod0_x0_y-1.obj, triangles: 10243}
+///       - {file: map_lod1_x0_y-1.obj, triangles: 812}
+/// @endcode
+///
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteTiledMeshIndex(const TiledMeshIndex& index, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
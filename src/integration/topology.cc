@@ -0,0 +1,490 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/topology.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Alignment of every array of records.
+constexpr size_t kAlignment{8};
+
+// @returns @p offset rounded up to the next multiple of kAlignment.
+uint64_t Align(uint64_t offset) { return (offset + kAlignment - 1) / kAlignment * kAlignment; }
+
+// Deduplicated table of null-terminated strings.
+class StringTable {
+ public:
+  TopologyString Add(const std::string& value) {
+    const auto it = offsets_.find(value);
+    if (it != offsets_.end()) {
+      return {it->second, static_cast<uint32_t>(value.size())};
+    }
+    MALIPUT_THROW_UNLESS(chars_.size() + value.size() < std::numeric_limits<uint32_t>::max());
+    const uint32_t offset = static_cast<uint32_t>(chars_.size());
+    chars_.insert(chars_.end(), value.begin(), value.end());
+    chars_.push_back('\0');
+    offsets_.emplace(value, offset);
+    return {offset, static_cast<uint32_t>(value.size())};
+  }
+
+  const std::vector<char>& chars() const { return chars_; }
+
+ private:
+  std::vector<char> chars_;
+  std::unordered_map<std::string, uint32_t> offsets_;
+};
+
+// Appends @p records to @p buffer, at an aligned offset.
+// @returns The offset of the first record.
+template <typename T>
+uint64_t AppendRecords(const std::vector<T>& records, std::vector<char>* buffer) {
+  buffer->resize(Align(buffer->size()), '\0');
+  const uint64_t offset = buffer->size();
+  const char* begin = reinterpret_cast<const char*>(records.data());
+  buffer->insert(buffer->end(), begin, begin + records.size() * sizeof(T));
+  return offset;
+}
+
+// @returns A pointer to the array of @p count records of type T at @p offset of the @p size bytes buffer at @p data.
+// @throws maliput::common::assertion_error When the array is misaligned or exceeds the buffer.
+template <typename T>
+const T* GetRecords(const char* data, size_t size, uint64_t offset, uint32_t count) {
+  MALIPUT_VALIDATE(offset % kAlignment == 0, "Misaligned topology records.");
+  MALIPUT_VALIDATE(offset <= size && count <= (size - offset) / sizeof(T), "Topology records exceed the buffer.");
+  return reinterpret_cast<const T*>(data + offset);
+}
+
+// Validates that @p reference lies within the string table at @p strings, of @p strings_size characters, and is
+// followed by a null character.
+void ValidateString(const TopologyString& reference, const char* strings, uint64_t strings_size) {
+  MALIPUT_VALIDATE(static_cast<uint64_t>(reference.offset) + reference.size < strings_size,
+                   "Topology string exceeds the string table.");
+  MALIPUT_VALIDATE(strings[reference.offset + reference.size] == '\0', "Topology string is not null terminated.");
+}
+
+// Validates that @p index refers to one of @p count records, or is -1 when @p optional is true.
+void ValidateIndex(int32_t index, uint32_t count, bool optional) {
+  MALIPUT_VALIDATE((optional && index == -1) || (index >= 0 && static_cast<uint32_t>(index) < count),
+                   "Topology record index out of range: " + std::to_string(index));
+}
+
+// Validates that the [first, first + num) range of indices refers to records among @p count records.
+void ValidateRange(int32_t first, int64_t num, uint32_t count) {
+  MALIPUT_VALIDATE(first >= 0 && num >= 0 && static_cast<uint64_t>(first) + static_cast<uint64_t>(num) <= count,
+                   "Topology record range out of range.");
+}
+
+// Validates that @p lane_end refers to one of @p num_lanes lanes, or to none when @p optional is true, and to an end.
+void ValidateLaneEnd(const TopologyLaneEnd& lane_end, uint32_t num_lanes, bool optional) {
+  ValidateIndex(lane_end.lane, num_lanes, optional);
+  MALIPUT_VALIDATE(lane_end.end == 0 || lane_end.end == 1, "Invalid topology lane end.");
+}
+
+// @returns The TopologyLaneEnd of @p lane_end.
+TopologyLaneEnd ToTopologyLaneEnd(const api::LaneEnd& lane_end,
+                                  const std::unordered_map<const api::Lane*, int32_t>& lane_indices) {
+  const auto it = lane_indices.find(lane_end.lane);
+  return {it != lane_indices.end() ? it->second : -1, lane_end.end == api::LaneEnd::kStart ? 0 : 1};
+}
+
+// Writes @p value as a JSON string.
+void WriteJsonString(std::string_view value, std::ostream* out) {
+  *out << '"';
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        *out << "\\\"";
+        break;
+      case '\\':
+        *out << "\\\\";
+        break;
+      case '\n':
+        *out << "\\n";
+        break;
+      case '\t':
+        *out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          *out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+               << std::setfill(' ');
+        } else {
+          *out << c;
+        }
+    }
+  }
+  *out << '"';
+}
+
+// Writes @p index as a JSON number, or null when it is negative.
+void WriteJsonIndex(int32_t index, std::ostream* out) {
+  if (index < 0) {
+    *out << "null";
+  } else {
+    *out << index;
+  }
+}
+
+// Writes @p lane_end as a JSON object, or null when it has no lane.
+void WriteJsonLaneEnd(const TopologyLaneEnd& lane_end, std::ostream* out) {
+  if (lane_end.lane < 0) {
+    *out << "null";
+    return;
+  }
+  *out << "{\"lane\": " << lane_end.lane << ", \"end\": " << (lane_end.end == 0 ? "\"start\"" : "\"finish\"") << "}";
+}
+
+// Writes the [first, first + count) range of indices as a JSON array.
+void WriteJsonRange(int32_t first, int32_t count, std::ostream* out) {
+  *out << "[";
+  for (int32_t i = 0; i < count; ++i) {
+    *out << (i == 0 ? "" : ", ") << first + i;
+  }
+  *out << "]";
+}
+
+// Writes @p bounds as a JSON array.
+void WriteJsonBounds(const double bounds[2], std::ostream* out) {
+  *out << "[" << bounds[0] << ", " << bounds[1] << "]";
+}
+
+}  // namespace
+
+TopologyView::TopologyView(const char* data, size_t size) {
+  MALIPUT_THROW_UNLESS(data != nullptr);
+  MALIPUT_VALIDATE(reinterpret_cast<uintptr_t>(data) % kAlignment == 0, "Misaligned topology buffer.");
+  MALIPUT_VALIDATE(size >= sizeof(TopologyHeader), "Topology buffer is too small.");
+  header_ = reinterpret_cast<const TopologyHeader*>(data);
+  MALIPUT_VALIDATE(std::memcmp(header_->magic, kTopologyMagic, sizeof(kTopologyMagic)) == 0,
+                   "Not a topology buffer.");
+  MALIPUT_VALIDATE(header_->version == kTopologyVersion,
+                   "Unsupported topology version: " + std::to_string(header_->version));
+  MALIPUT_VALIDATE(header_->byte_order == kTopologyByteOrder, "Topology buffer has a different byte order.");
+  junctions_ = GetRecords<TopologyJunction>(data, size, header_->junctions_offset, header_->num_junctions);
+  segments_ = GetRecords<TopologySegment>(data, size, header_->segments_offset, header_->num_segments);
+  lanes_ = GetRecords<TopologyLane>(data, size, header_->lanes_offset, header_->num_lanes);
+  branch_points_ =
+      GetRecords<TopologyBranchPoint>(data, size, header_->branch_points_offset, header_->num_branch_points);
+  lane_ends_ = GetRecords<TopologyLaneEnd>(data, size, header_->lane_ends_offset, header_->num_lane_ends);
+  MALIPUT_VALIDATE(header_->strings_offset <= size && header_->strings_size <= size - header_->strings_offset,
+                   "Topology strings exceed the buffer.");
+  strings_ = data + header_->strings_offset;
+
+  // Every string reference and record index is checked once, so accessors and consumers that follow the references
+  // of valid records never read out of the buffer.
+  const TopologyHeader& h = *header_;
+  ValidateString(h.road_geometry_id, strings_, h.strings_size);
+  for (uint32_t i = 0; i < h.num_junctions; ++i) {
+    ValidateString(junctions_[i].id, strings_, h.strings_size);
+    ValidateRange(junctions_[i].first_segment, junctions_[i].num_segments, h.num_segments);
+  }
+  for (uint32_t i = 0; i < h.num_segments; ++i) {
+    ValidateString(segments_[i].id, strings_, h.strings_size);
+    ValidateIndex(segments_[i].junction, h.num_junctions, false);
+    ValidateRange(segments_[i].first_lane, segments_[i].num_lanes, h.num_lanes);
+  }
+  for (uint32_t i = 0; i < h.num_lanes; ++i) {
+    const TopologyLane& lane = lanes_[i];
+    ValidateString(lane.id, strings_, h.strings_size);
+    ValidateIndex(lane.segment, h.num_segments, false);
+    ValidateIndex(lane.left_lane, h.num_lanes, true);
+    ValidateIndex(lane.right_lane, h.num_lanes, true);
+    for (int side = 0; side < 2; ++side) {
+      ValidateIndex(lane.branch_points[side], h.num_branch_points, true);
+      ValidateLaneEnd(lane.default_branches[side], h.num_lanes, true);
+    }
+  }
+  for (uint32_t i = 0; i < h.num_branch_points; ++i) {
+    const TopologyBranchPoint& branch_point = branch_points_[i];
+    ValidateString(branch_point.id, strings_, h.strings_size);
+    MALIPUT_VALIDATE(branch_point.num_a_side >= 0 && branch_point.num_b_side >= 0,
+                     "Invalid topology branch point sides.");
+    ValidateRange(branch_point.first_lane_end,
+                  static_cast<int64_t>(branch_point.num_a_side) + branch_point.num_b_side, h.num_lane_ends);
+  }
+  for (uint32_t i = 0; i < h.num_lane_ends; ++i) {
+    // Lane ends of lanes that are not part of the road geometry are stored with no lane.
+    ValidateLaneEnd(lane_ends_[i], h.num_lanes, true);
+  }
+}
+
+MappedTopologyFile::Mapping::Mapping(const std::string& file_path) {
+  const int fd = ::open(file_path.c_str(), O_RDONLY);
+  MALIPUT_VALIDATE(fd >= 0, "Could not open topology file: " + file_path);
+  struct stat status {};
+  const bool stat_ok = ::fstat(fd, &status) == 0 && status.st_size > 0;
+  if (stat_ok) {
+    size = static_cast<size_t>(status.st_size);
+    data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);
+  MALIPUT_VALIDATE(stat_ok, "Empty or unreadable topology file: " + file_path);
+  MALIPUT_VALIDATE(data != MAP_FAILED, "Could not map topology file: " + file_path);
+}
+
+MappedTopologyFile::Mapping::~Mapping() {
+  if (data != nullptr && data != MAP_FAILED) {
+    ::munmap(data, size);
+  }
+}
+
+// mmap() returns page-aligned memory, which satisfies the alignment of TopologyView.
+MappedTopologyFile::MappedTopologyFile(const std::string& file_path)
+    : mapping_(file_path), view_(static_cast<const char*>(mapping_.data), mapping_.size) {}
+
+std::vector<char> SerializeTopology(const api::RoadGeometry* road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  StringTable strings;
+  std::vector<TopologyJunction> junctions;
+  std::vector<TopologySegment> segments;
+  std::vector<TopologyLane> lanes;
+  std::vector<TopologyBranchPoint> branch_points;
+  std::vector<TopologyLaneEnd> lane_ends;
+
+  // Indexes every lane and branch point first, so records can reference entities that come later.
+  std::unordered_map<const api::Lane*, int32_t> lane_indices;
+  std::vector<const api::Lane*> ordered_lanes;
+  // Index of the segment of every lane.
+  std::vector<int32_t> lane_segments;
+  int32_t num_segments{0};
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j, ++num_segments) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lane_indices.emplace(segment->lane(k), static_cast<int32_t>(ordered_lanes.size()));
+        ordered_lanes.push_back(segment->lane(k));
+        lane_segments.push_back(num_segments);
+      }
+    }
+  }
+  std::unordered_map<const api::BranchPoint*, int32_t> branch_point_indices;
+  for (int i = 0; i < road_geometry->num_branch_points(); ++i) {
+    branch_point_indices.emplace(road_geometry->branch_point(i), i);
+  }
+  const auto lane_index = [&lane_indices](const api::Lane* lane) -> int32_t {
+    const auto it = lane_indices.find(lane);
+    return it != lane_indices.end() ? it->second : -1;
+  };
+
+  int32_t next_lane{0};
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    TopologyJunction junction_record{};
+    junction_record.id = strings.Add(junction->id().string());
+    junction_record.first_segment = static_cast<int32_t>(segments.size());
+    junction_record.num_segments = junction->num_segments();
+    junctions.push_back(junction_record);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      TopologySegment segment_record{};
+      segment_record.id = strings.Add(segment->id().string());
+      segment_record.junction = i;
+      segment_record.first_lane = next_lane;
+      segment_record.num_lanes = segment->num_lanes();
+      segments.push_back(segment_record);
+      next_lane += segment->num_lanes();
+    }
+  }
+
+  for (size_t i = 0; i < ordered_lanes.size(); ++i) {
+    const api::Lane* lane = ordered_lanes[i];
+    TopologyLane lane_record{};
+    lane_record.id = strings.Add(lane->id().string());
+    lane_record.segment = lane_segments[i];
+    lane_record.index = lane->index();
+    lane_record.left_lane = lane_index(lane->to_left());
+    lane_record.right_lane = lane_index(lane->to_right());
+    lane_record.length = lane->length();
+    for (const api::LaneEnd::Which end : {api::LaneEnd::kStart, api::LaneEnd::kFinish}) {
+      const int side = end == api::LaneEnd::kStart ? 0 : 1;
+      const auto branch_point_it = branch_point_indices.find(lane->GetBranchPoint(end));
+      lane_record.branch_points[side] =
+          branch_point_it != branch_point_indices.end() ? branch_point_it->second : -1;
+      const std::optional<api::LaneEnd> default_branch = lane->GetDefaultBranch(end);
+      lane_record.default_branches[side] =
+          default_branch.has_value() ? ToTopologyLaneEnd(*default_branch, lane_indices) : TopologyLaneEnd{-1, 0};
+      const double s = end == api::LaneEnd::kStart ? 0. : lane->length();
+      const api::RBounds lane_bounds = lane->lane_bounds(s);
+      const api::RBounds segment_bounds = lane->segment_bounds(s);
+      lane_record.lane_bounds[side][0] = lane_bounds.min();
+      lane_record.lane_bounds[side][1] = lane_bounds.max();
+      lane_record.segment_bounds[side][0] = segment_bounds.min();
+      lane_record.segment_bounds[side][1] = segment_bounds.max();
+    }
+    lanes.push_back(lane_record);
+  }
+  for (int i = 0; i < road_geometry->num_branch_points(); ++i) {
+    const api::BranchPoint* branch_point = road_geometry->branch_point(i);
+    TopologyBranchPoint branch_point_record{};
+    branch_point_record.id = strings.Add(branch_point->id().string());
+    branch_point_record.first_lane_end = static_cast<int32_t>(lane_ends.size());
+    branch_point_record.num_a_side = branch_point->GetASide()->size();
+    branch_point_record.num_b_side = branch_point->GetBSide()->size();
+    for (const api::LaneEndSet* side : {branch_point->GetASide(), branch_point->GetBSide()}) {
+      for (int j = 0; j < side->size(); ++j) {
+        lane_ends.push_back(ToTopologyLaneEnd(side->get(j), lane_indices));
+      }
+    }
+    branch_points.push_back(branch_point_record);
+  }
+
+  TopologyHeader header{};
+  std::memcpy(header.magic, kTopologyMagic, sizeof(kTopologyMagic));
+  header.version = kTopologyVersion;
+  header.byte_order = kTopologyByteOrder;
+  header.road_geometry_id = strings.Add(road_geometry->id().string());
+  header.num_junctions = static_cast<uint32_t>(junctions.size());
+  header.num_segments = static_cast<uint32_t>(segments.size());
+  header.num_lanes = static_cast<uint32_t>(lanes.size());
+  header.num_branch_points = static_cast<uint32_t>(branch_points.size());
+  header.num_lane_ends = static_cast<uint32_t>(lane_ends.size());
+  header.linear_tolerance = road_geometry->linear_tolerance();
+  header.angular_tolerance = road_geometry->angular_tolerance();
+  header.scale_length = road_geometry->scale_length();
+
+  std::vector<char> buffer(sizeof(TopologyHeader), '\0');
+  header.junctions_offset = AppendRecords(junctions, &buffer);
+  header.segments_offset = AppendRecords(segments, &buffer);
+  header.lanes_offset = AppendRecords(lanes, &buffer);
+  header.branch_points_offset = AppendRecords(branch_points, &buffer);
+  header.lane_ends_offset = AppendRecords(lane_ends, &buffer);
+  header.strings_offset = AppendRecords(strings.chars(), &buffer);
+  header.strings_size = strings.chars().size();
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  return buffer;
+}
+
+void WriteTopologyFile(const std::vector<char>& buffer, const std::string& file_path) {
+  std::ofstream file(file_path, std::ios::binary);
+  MALIPUT_VALIDATE(file.is_open(), "Could not open topology file: " + file_path);
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  MALIPUT_VALIDATE(static_cast<bool>(file), "Could not write topology file: " + file_path);
+  file.close();
+  MALIPUT_VALIDATE(!file.fail(), "Could not write topology file: " + file_path);
+}
+
+void WriteTopologyJson(const TopologyView& topology, std::ostream* out) {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  const std::streamsize precision = out->precision(std::numeric_limits<double>::max_digits10);
+  const TopologyHeader& header = topology.header();
+  *out << "{\n  \"road_geometry\": {\"id\": ";
+  WriteJsonString(topology.road_geometry_id(), out);
+  *out << ", \"linear_tolerance\": " << header.linear_tolerance << ", \"angular_tolerance\": "
+       << header.angular_tolerance << ", \"scale_length\": " << header.scale_length << "},\n";
+
+  *out << "  \"junctions\": [";
+  for (int i = 0; i < topology.num_junctions(); ++i) {
+    const TopologyJunction& junction = topology.junction(i);
+    *out << (i == 0 ? "\n" : ",\n") << "    {\"id\": ";
+    WriteJsonString(topology.string(junction.id), out);
+    *out << ", \"segments\": ";
+    WriteJsonRange(junction.first_segment, junction.num_segments, out);
+    *out << "}";
+  }
+  *out << "\n  ],\n  \"segments\": [";
+  for (int i = 0; i < topology.num_segments(); ++i) {
+    const TopologySegment& segment = topology.segment(i);
+    *out << (i == 0 ? "\n" : ",\n") << "    {\"id\": ";
+    WriteJsonString(topology.string(segment.id), out);
+    *out << ", \"junction\": " << segment.junction << ", \"lanes\": ";
+    WriteJsonRange(segment.first_lane, segment.num_lanes, out);
+    *out << "}";
+  }
+  *out << "\n  ],\n  \"lanes\": [";
+  for (int i = 0; i < topology.num_lanes(); ++i) {
+    const TopologyLane& lane = topology.lane(i);
+    *out << (i == 0 ? "\n" : ",\n") << "    {\"id\": ";
+    WriteJsonString(topology.string(lane.id), out);
+    *out << ", \"segment\": " << lane.segment << ", \"index\": " << lane.index << ", \"left\": ";
+    WriteJsonIndex(lane.left_lane, out);
+    *out << ", \"right\": ";
+    WriteJsonIndex(lane.right_lane, out);
+    *out << ", \"length\": " << lane.length << ", \"start_branch_point\": ";
+    WriteJsonIndex(lane.branch_points[0], out);
+    *out << ", \"finish_branch_point\": ";
+    WriteJsonIndex(lane.branch_points[1], out);
+    *out << ", \"default_start_branch\": ";
+    WriteJsonLaneEnd(lane.default_branches[0], out);
+    *out << ", \"default_finish_branch\": ";
+    WriteJsonLaneEnd(lane.default_branches[1], out);
+    *out << ", \"start_lane_bounds\": ";
+    WriteJsonBounds(lane.lane_bounds[0], out);
+    *out << ", \"finish_lane_bounds\": ";
+    WriteJsonBounds(lane.lane_bounds[1], out);
+    *out << ", \"start_segment_bounds\": ";
+    WriteJsonBounds(lane.segment_bounds[0], out);
+    *out << ", \"finish_segment_bounds\": ";
+    WriteJsonBounds(lane.segment_bounds[1], out);
+    *out << "}";
+  }
+  *out << "\n  ],\n  \"branch_points\": [";
+  for (int i = 0; i < topology.num_branch_points(); ++i) {
+    const TopologyBranchPoint& branch_point = topology.branch_point(i);
+    *out << (i == 0 ? "\n" : ",\n") << "    {\"id\": ";
+    WriteJsonString(topology.string(branch_point.id), out);
+    *out << ", \"a_side\": [";
+    for (int j = 0; j < branch_point.num_a_side; ++j) {
+      *out << (j == 0 ? "" : ", ");
+      WriteJsonLaneEnd(topology.lane_end(branch_point.first_lane_end + j), out);
+    }
+    *out << "], \"b_side\": [";
+    for (int j = 0; j < branch_point.num_b_side; ++j) {
+      *out << (j == 0 ? "" : ", ");
+      WriteJsonLaneEnd(topology.lane_end(branch_point.first_lane_end + branch_point.num_a_side + j), out);
+    }
+    *out << "]}";
+  }
+  *out << "\n  ]\n}\n";
+  out->precision(precision);
+}
+
+}  // namespace integration
+}  // namespace maliput
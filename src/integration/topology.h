@@ -0,0 +1,274 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// @defgroup topology_format Binary topology format
+///
+/// Compact description of the junction, segment, lane and branch point topology of a road geometry, designed to be
+/// memory mapped and read in place.
+///
+/// A topology buffer starts with a TopologyHeader followed by the arrays of TopologyJunction, TopologySegment,
+/// TopologyLane, TopologyBranchPoint and TopologyLaneEnd records and a table of strings. Every array starts at an
+/// offset, relative to the start of the buffer, that is a multiple of 8. Records reference each other by their
+/// index in their array, where -1 stands for none; strings are referenced by TopologyString. Segments are stored in
+/// junction order and lanes in segment order, so the children of every entity are contiguous. All the values use the
+/// byte order of the machine that wrote the buffer, which is recorded in TopologyHeader::byte_order.
+///
+/// Record layouts only depend on fixed-width types, so consumers only need this header to read a buffer.
+/// @{
+
+/// Reference to a string of the string table.
+struct TopologyString {
+  /// Offset of the first character, relative to the start of the string table.
+  uint32_t offset;
+  /// Number of characters. The string is followed by a null character.
+  uint32_t size;
+};
+
+/// Heads a topology buffer.
+struct TopologyHeader {
+  /// Holds kTopologyMagic.
+  char magic[4];
+  /// Holds kTopologyVersion.
+  uint32_t version;
+  /// Holds kTopologyByteOrder, written in the byte order of the buffer.
+  uint32_t byte_order;
+  /// ID of the road geometry.
+  TopologyString road_geometry_id;
+  uint32_t num_junctions;
+  uint32_t num_segments;
+  uint32_t num_lanes;
+  uint32_t num_branch_points;
+  uint32_t num_lane_ends;
+  uint64_t junctions_offset;
+  uint64_t segments_offset;
+  uint64_t lanes_offset;
+  uint64_t branch_points_offset;
+  uint64_t lane_ends_offset;
+  uint64_t strings_offset;
+  uint64_t strings_size;
+  double linear_tolerance;
+  double angular_tolerance;
+  double scale_length;
+};
+
+/// Describes an api::Junction.
+struct TopologyJunction {
+  TopologyString id;
+  /// Index of the first segment.
+  int32_t first_segment;
+  int32_t num_segments;
+};
+
+/// Describes an api::Segment.
+struct TopologySegment {
+  TopologyString id;
+  /// Index of the junction.
+  int32_t junction;
+  /// Index of the first lane.
+  int32_t first_lane;
+  int32_t num_lanes;
+  int32_t reserved;
+};
+
+/// Describes an api::LaneEnd.
+struct TopologyLaneEnd {
+  /// Index of the lane.
+  int32_t lane;
+  /// 0 for api::LaneEnd::kStart, 1 for api::LaneEnd::kFinish.
+  int32_t end;
+};
+
+/// Describes an api::Lane.
+struct TopologyLane {
+  TopologyString id;
+  /// Index of the segment.
+  int32_t segment;
+  /// Index of the lane within its segment.
+  int32_t index;
+  /// Index of the lane to the left, or -1.
+  int32_t left_lane;
+  /// Index of the lane to the right, or -1.
+  int32_t right_lane;
+  /// Index of the branch point at the start and at the finish.
+  int32_t branch_points[2];
+  /// Default branch at the start and at the finish. Its lane is -1 when there is none.
+  TopologyLaneEnd default_branches[2];
+  double length;
+  /// Lateral bounds of the lane, at the start and at the finish: {min, max}.
+  double lane_bounds[2][2];
+  /// Lateral bounds of the segment, at the start and at the finish: {min, max}.
+  double segment_bounds[2][2];
+};
+
+/// Describes an api::BranchPoint. Its lane ends are contiguous: first the A-side ones, then the B-side ones.
+struct TopologyBranchPoint {
+  TopologyString id;
+  /// Index of the first lane end.
+  int32_t first_lane_end;
+  int32_t num_a_side;
+  int32_t num_b_side;
+  int32_t reserved;
+};
+
+// Records must not have implicit padding, so their layout does not depend on the compiler.
+static_assert(sizeof(TopologyString) == 8);
+static_assert(sizeof(TopologyHeader) == 120);
+static_assert(sizeof(TopologyJunction) == 16);
+static_assert(sizeof(TopologySegment) == 24);
+static_assert(sizeof(TopologyLaneEnd) == 8);
+static_assert(sizeof(TopologyLane) == 120);
+static_assert(sizeof(TopologyBranchPoint) == 24);
+
+/// Magic characters that head a topology buffer.
+constexpr char kTopologyMagic[4] = {'M', 'T', 'O', 'P'};
+/// Version of the record layouts. It is bumped whenever any of them changes.
+constexpr uint32_t kTopologyVersion{1};
+/// Value that reveals the byte order of a buffer.
+constexpr uint32_t kTopologyByteOrder{0x01020304};
+
+/// @}
+
+/// Read-only access to a topology buffer, in place.
+///
+/// See @ref topology_format.
+class TopologyView {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TopologyView)
+
+  /// Constructs a TopologyView.
+  ///
+  /// Every record array, string reference and record index of the buffer is checked against the buffer bounds and
+  /// the record counts, so following the references of the records never reads out of the buffer.
+  ///
+  /// @param data Start of the buffer. It must be aligned to 8 bytes and must outlive this view.
+  /// @param size Size of the buffer, in bytes.
+  /// @throws maliput::common::assertion_error When @p data is nullptr or misaligned, the buffer is not a topology
+  ///         buffer of this version and byte order, or any of its arrays, strings or record indices is out of range.
+  TopologyView(const char* data, size_t size);
+
+  const TopologyHeader& header() const { return *header_; }
+  std::string_view road_geometry_id() const { return string(header_->road_geometry_id); }
+
+  int num_junctions() const { return static_cast<int>(header_->num_junctions); }
+  int num_segments() const { return static_cast<int>(header_->num_segments); }
+  int num_lanes() const { return static_cast<int>(header_->num_lanes); }
+  int num_branch_points() const { return static_cast<int>(header_->num_branch_points); }
+  int num_lane_ends() const { return static_cast<int>(header_->num_lane_ends); }
+
+  /// Accessors to the records. Indices are not checked; those held by the records are in range.
+  /// @{
+  const TopologyJunction& junction(int index) const { return junctions_[index]; }
+  const TopologySegment& segment(int index) const { return segments_[index]; }
+  const TopologyLane& lane(int index) const { return lanes_[index]; }
+  const TopologyBranchPoint& branch_point(int index) const { return branch_points_[index]; }
+  const TopologyLaneEnd& lane_end(int index) const { return lane_ends_[index]; }
+  /// @}
+
+  /// @returns The string referenced by @p reference.
+  std::string_view string(const TopologyString& reference) const {
+    return std::string_view(strings_ + reference.offset, reference.size);
+  }
+
+ private:
+  const TopologyHeader* header_{};
+  const TopologyJunction* junctions_{};
+  const TopologySegment* segments_{};
+  const TopologyLane* lanes_{};
+  const TopologyBranchPoint* branch_points_{};
+  const TopologyLaneEnd* lane_ends_{};
+  const char* strings_{};
+};
+
+/// Read-only memory mapping of a topology file.
+class MappedTopologyFile {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(MappedTopologyFile)
+
+  /// Maps the file at @p file_path.
+  ///
+  /// @throws maliput::common::assertion_error When the file cannot be mapped or is not a valid topology file.
+  explicit MappedTopologyFile(const std::string& file_path);
+
+  /// @returns The view of the mapped topology.
+  const TopologyView& view() const { return view_; }
+
+ private:
+  // Owns the memory mapping of a file.
+  struct Mapping {
+    MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(Mapping)
+    explicit Mapping(const std::string& file_path);
+    ~Mapping();
+
+    void* data{};
+    size_t size{};
+  };
+
+  const Mapping mapping_;
+  const TopologyView view_;
+};
+
+/// Serializes the topology of @p road_geometry. See @ref topology_format.
+///
+/// @param road_geometry The api::RoadGeometry to serialize. It must not be nullptr.
+/// @returns The topology buffer. Its storage comes from the default allocator, so it can be viewed in place with
+///          TopologyView.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr.
+std::vector<char> SerializeTopology(const api::RoadGeometry* road_geometry);
+
+/// Writes @p buffer, as returned by SerializeTopology(), into the file at @p file_path.
+///
+/// @throws maliput::common::assertion_error When the file cannot be written.
+void WriteTopologyFile(const std::vector<char>& buffer, const std::string& file_path);
+
+/// Writes the topology held by @p topology as a JSON document.
+///
+/// The document is an object with a `road_geometry` object (ID and tolerances) and the `junctions`, `segments`,
+/// `lanes` and `branch_points` arrays. Entities reference each other by their index in those arrays, as in the binary
+/// format, and lane ends are `{"lane": <index>, "end": "start"|"finish"}` objects.
+///
+/// @throws maliput::common::assertion_error When @p out is nullptr.
+void WriteTopologyJson(const TopologyView& topology, std::ostream* out);
+
+}  // namespace integration
+}  // namespace maliput
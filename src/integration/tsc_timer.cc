@@ -0,0 +1,95 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/tsc_timer.h"
+
+#include <chrono>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Time during which the counter is compared against std::chrono::steady_clock to calibrate it.
+constexpr std::chrono::milliseconds kCalibrationDuration{20};
+
+// @returns The value of the time stamp counter.
+inline uint64_t ReadCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// @returns The number of counter ticks per second, measured over kCalibrationDuration.
+double Calibrate() {
+  const auto steady_start = std::chrono::steady_clock::now();
+  const uint64_t counter_start = ReadCounter();
+  std::this_thread::sleep_for(kCalibrationDuration);
+  const uint64_t counter_end = ReadCounter();
+  const auto steady_end = std::chrono::steady_clock::now();
+  return static_cast<double>(counter_end - counter_start) /
+         std::chrono::duration<double>(steady_end - steady_start).count();
+}
+
+}  // namespace
+
+TscTimer::TscTimer() : Timer(), seconds_per_tick_(1. / ticks_per_second()), start_(ReadCounter()) {}
+
+bool TscTimer::IsSupported() {
+#if defined(__x86_64__) || defined(__i386__)
+  // The invariant counter flag is bit 8 of EDX in the advanced power management leaf.
+  unsigned int eax{}, ebx{}, ecx{}, edx{};
+  return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0 && (edx & (1u << 8)) != 0;
+#else
+  return false;
+#endif
+}
+
+double TscTimer::ticks_per_second() {
+  MALIPUT_VALIDATE(IsSupported(), "The processor has no invariant time stamp counter.");
+  // Calibrated once per process; initialization of function-local statics is thread-safe.
+  static const double kTicksPerSecond = Calibrate();
+  return kTicksPerSecond;
+}
+
+void TscTimer::DoReset() { start_ = ReadCounter(); }
+
+double TscTimer::DoElapsed() const { return static_cast<double>(ReadCounter() - start_) * seconds_per_tick_; }
+
+}  // namespace integration
+}  // namespace maliput
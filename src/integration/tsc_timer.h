@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/timer.h"
+
+namespace maliput {
+namespace integration {
+
+/// Timer implementation based on the time stamp counter of x86 processors.
+///
+/// Reading the counter takes a single instruction, without the system call or the clock source lookup that
+/// std::chrono clocks may need, which makes it the cheapest timer for loops that read the time very often. Counter
+/// ticks are converted to seconds with a rate that is calibrated once per process against std::chrono::steady_clock.
+///
+/// It is only available on processors with an invariant counter, i.e. one that ticks at a constant rate regardless of
+/// frequency scaling and sleep states. See IsSupported().
+class TscTimer : public Timer {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(TscTimer)
+
+  /// Constructs a TscTimer. The first construction in a process calibrates the counter, which takes a few
+  /// milliseconds.
+  /// @throws maliput::common::assertion_error When IsSupported() is false.
+  TscTimer();
+
+  /// Destructor.
+  ~TscTimer() override = default;
+
+  /// @returns Whether the processor has an invariant time stamp counter.
+  static bool IsSupported();
+
+  /// @returns The calibrated number of counter ticks per second.
+  /// @throws maliput::common::assertion_error When IsSupported() is false.
+  static double ticks_per_second();
+
+ private:
+  void DoReset() override;
+  double DoElapsed() const override;
+
+  const double seconds_per_tick_{};
+  uint64_t start_{};
+};
+
+}  // namespace integration
+}  // namespace maliput
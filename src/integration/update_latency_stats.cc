@@ -0,0 +1,151 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/update_latency_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+constexpr double kMicrosecondsPerSecond{1e6};
+
+// @returns The index of the histogram bucket of @p lateness, in seconds.
+int GetBucket(double lateness) {
+  const double microseconds = lateness * kMicrosecondsPerSecond;
+  if (microseconds < 1.) {
+    return 0;
+  }
+  // Bucket i >= 1 holds [2^(i - 1), 2^i) microseconds.
+  int exponent{};
+  std::frexp(microseconds, &exponent);
+  return std::min(exponent, UpdateLatencyStats::kNumBuckets - 1);
+}
+
+}  // namespace
+
+UpdateLatencyStats::UpdateLatencyStats(double deadline_miss_tolerance)
+    : deadline_miss_tolerance_(deadline_miss_tolerance) {
+  MALIPUT_THROW_UNLESS(deadline_miss_tolerance_ >= 0.);
+}
+
+void UpdateLatencyStats::AddUpdate(double update_duration, double loop_overhead) {
+  ++num_updates_;
+  total_update_duration_ += update_duration;
+  total_loop_overhead_ += loop_overhead;
+  max_loop_overhead_ = std::max(max_loop_overhead_, loop_overhead);
+}
+
+void UpdateLatencyStats::AddTransition(double lateness) {
+  lateness = std::max(lateness, 0.);
+  ++num_transitions_;
+  if (lateness > deadline_miss_tolerance_) {
+    ++num_missed_deadlines_;
+  }
+  total_lateness_ += lateness;
+  max_lateness_ = std::max(max_lateness_, lateness);
+  ++lateness_histogram_[GetBucket(lateness)];
+}
+
+void UpdateLatencyStats::AddTransitions(const DynamicEnvironmentChanges& changes,
+                                        const std::optional<double>& next_update_time, double update_start_time) {
+  for (const double deadline : changes.deadlines) {
+    AddTransition(update_start_time - deadline);
+  }
+  if (changes.deadlines.empty() && next_update_time.has_value() && *next_update_time <= update_start_time) {
+    AddTransition(update_start_time - *next_update_time);
+  }
+}
+
+void UpdateLatencyStats::Merge(const UpdateLatencyStats& other) {
+  MALIPUT_THROW_UNLESS(other.deadline_miss_tolerance_ == deadline_miss_tolerance_);
+  num_updates_ += other.num_updates_;
+  num_transitions_ += other.num_transitions_;
+  num_missed_deadlines_ += other.num_missed_deadlines_;
+  total_lateness_ += other.total_lateness_;
+  max_lateness_ = std::max(max_lateness_, other.max_lateness_);
+  for (int i = 0; i < kNumBuckets; ++i) {
+    lateness_histogram_[i] += other.lateness_histogram_[i];
+  }
+  total_update_duration_ += other.total_update_duration_;
+  total_loop_overhead_ += other.total_loop_overhead_;
+  max_loop_overhead_ = std::max(max_loop_overhead_, other.max_loop_overhead_);
+}
+
+void UpdateLatencyStats::Clear() { *this = UpdateLatencyStats(deadline_miss_tolerance_); }
+
+double UpdateLatencyStats::BucketUpperBound(int bucket) {
+  MALIPUT_THROW_UNLESS(bucket >= 0 && bucket < kNumBuckets);
+  if (bucket == kNumBuckets - 1) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return std::ldexp(1., bucket) / kMicrosecondsPerSecond;
+}
+
+double UpdateLatencyStats::LatenessQuantile(double quantile) const {
+  MALIPUT_THROW_UNLESS(quantile >= 0. && quantile <= 1.);
+  if (num_transitions_ == 0) {
+    return 0.;
+  }
+  // Number of transitions at or below the quantile, at least one so that the 0-quantile is the first non-empty bucket.
+  const int64_t rank = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(quantile * num_transitions_)));
+  int64_t count{0};
+  for (int i = 0; i < kNumBuckets; ++i) {
+    count += lateness_histogram_[i];
+    if (count >= rank) {
+      // The largest lateness is a tighter bound for the last non-empty bucket.
+      return std::min(BucketUpperBound(i), max_lateness_);
+    }
+  }
+  return max_lateness_;
+}
+
+std::string UpdateLatencyStats::Summary() const {
+  std::ostringstream out;
+  out << num_updates_ << " updates, " << num_transitions_ << " transitions, " << num_missed_deadlines_
+      << " missed deadlines (later than " << deadline_miss_tolerance_ * kMicrosecondsPerSecond
+      << " us). Lateness: mean " << mean_lateness() * kMicrosecondsPerSecond << " us, p50 "
+      << LatenessQuantile(0.5) * kMicrosecondsPerSecond << " us, p99 "
+      << LatenessQuantile(0.99) * kMicrosecondsPerSecond << " us, max " << max_lateness_ * kMicrosecondsPerSecond
+      << " us. Update: mean "
+      << (num_updates_ > 0 ? total_update_duration_ / num_updates_ : 0.) * kMicrosecondsPerSecond
+      << " us. Loop overhead: mean "
+      << (num_updates_ > 0 ? total_loop_overhead_ / num_updates_ : 0.) * kMicrosecondsPerSecond << " us, max "
+      << max_loop_overhead_ * kMicrosecondsPerSecond << " us.";
+  return out.str();
+}
+
+}  // namespace integration
+}  // namespace maliput
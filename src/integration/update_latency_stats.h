@@ -0,0 +1,145 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "integration/dynamic_environment_changes.h"
+
+namespace maliput {
+namespace integration {
+
+/// Statistics of how late the transitions applied by a DynamicEnvironmentHandler are with respect to their deadlines,
+/// and of the time its updates and the loop that drives them take.
+///
+/// A single update may apply several transitions that were due at different times, e.g. phase rings whose deadlines
+/// passed while the loop was busy, so lateness is recorded per transition while durations are recorded per update.
+///
+/// Lateness is kept in a histogram of power-of-two buckets of microseconds, so recording a transition takes constant
+/// time and memory regardless of how many are recorded, and quantiles are known up to a factor of two.
+class UpdateLatencyStats {
+ public:
+  /// Number of buckets of the lateness histogram.
+  static constexpr int kNumBuckets{32};
+
+  /// Constructs an empty UpdateLatencyStats.
+  /// @param deadline_miss_tolerance Lateness, in seconds, above which a transition counts as a missed deadline. It must
+  ///                                be non-negative.
+  /// @throws maliput::common::assertion_error When @p deadline_miss_tolerance is negative.
+  explicit UpdateLatencyStats(double deadline_miss_tolerance);
+
+  /// Records an update.
+  /// @param update_duration Time spent in DynamicEnvironmentHandler::Update(), in seconds.
+  /// @param loop_overhead Time the loop spent before the update besides waiting for the deadline, in seconds.
+  void AddUpdate(double update_duration, double loop_overhead);
+
+  /// Records a transition.
+  /// @param lateness Time between the deadline of the transition and the start of the update that applied it, in
+  ///                 seconds. Negative values, i.e. early transitions, are recorded as zero.
+  void AddTransition(double lateness);
+
+  /// Records the transitions applied by a DynamicEnvironmentHandler::Update() call: one per
+  /// DynamicEnvironmentChanges::deadlines entry of @p changes. Handlers that don't report the deadlines of their
+  /// transitions count as applying a single transition, due at @p next_update_time, whenever it has passed.
+  /// @param changes DynamicEnvironmentHandler::last_changes() after the call.
+  /// @param next_update_time DynamicEnvironmentHandler::NextUpdateTime() before the call.
+  /// @param update_start_time Time of the timer at which the call started, in seconds.
+  void AddTransitions(const DynamicEnvironmentChanges& changes, const std::optional<double>& next_update_time,
+                      double update_start_time);
+
+  /// Adds the updates recorded by @p other.
+  /// @throws maliput::common::assertion_error When @p other has a different deadline miss tolerance.
+  void Merge(const UpdateLatencyStats& other);
+
+  /// Forgets every recorded update.
+  void Clear();
+
+  /// @returns The lateness above which a transition counts as a missed deadline, in seconds.
+  double deadline_miss_tolerance() const { return deadline_miss_tolerance_; }
+
+  /// @returns The number of recorded updates.
+  int64_t num_updates() const { return num_updates_; }
+
+  /// @returns The number of recorded transitions.
+  int64_t num_transitions() const { return num_transitions_; }
+
+  /// @returns The number of transitions later than deadline_miss_tolerance().
+  int64_t num_missed_deadlines() const { return num_missed_deadlines_; }
+
+  /// @returns The mean lateness of the transitions, in seconds, or zero when no transition was recorded.
+  double mean_lateness() const { return num_transitions_ > 0 ? total_lateness_ / num_transitions_ : 0.; }
+
+  /// @returns The largest lateness, in seconds.
+  double max_lateness() const { return max_lateness_; }
+
+  /// @returns The number of transitions per lateness bucket. See BucketUpperBound().
+  const std::array<int64_t, kNumBuckets>& lateness_histogram() const { return lateness_histogram_; }
+
+  /// @returns The upper bound, in seconds, of the lateness of the transitions in the @p bucket -th bucket: one
+  ///          microsecond for the first bucket, twice the previous one for the others. The last bucket holds every
+  ///          transition later than the previous bound as well, hence its bound is infinite.
+  /// @throws maliput::common::assertion_error When @p bucket is not in [0, kNumBuckets).
+  static double BucketUpperBound(int bucket);
+
+  /// @returns The upper bound of the bucket that holds the @p quantile of the lateness, in seconds, or zero when no
+  ///          transition was recorded.
+  /// @throws maliput::common::assertion_error When @p quantile is not in [0, 1].
+  double LatenessQuantile(double quantile) const;
+
+  /// @returns The total time spent in the updates, in seconds.
+  double total_update_duration() const { return total_update_duration_; }
+
+  /// @returns The total loop overhead, in seconds.
+  double total_loop_overhead() const { return total_loop_overhead_; }
+
+  /// @returns The largest loop overhead of an update, in seconds.
+  double max_loop_overhead() const { return max_loop_overhead_; }
+
+  /// @returns A single line summary of the statistics, with times in microseconds.
+  std::string Summary() const;
+
+ private:
+  double deadline_miss_tolerance_{};
+  int64_t num_updates_{0};
+  int64_t num_transitions_{0};
+  int64_t num_missed_deadlines_{0};
+  double total_lateness_{0.};
+  double max_lateness_{0.};
+  std::array<int64_t, kNumBuckets> lateness_histogram_{};
+  double total_update_duration_{0.};
+  double total_loop_overhead_{0.};
+  double max_loop_overhead_{0.};
+};
+
+}  // namespace integration
+}  // namespace maliput
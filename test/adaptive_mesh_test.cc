@@ -0,0 +1,152 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/adaptive_mesh.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/common/filesystem.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(GridUnitForErrorTest, GridUnitForError) {
+  SegmentComplexity complexity;
+  // Flat and straight segments get the largest grid unit.
+  EXPECT_EQ(20., GridUnitForError(complexity, 0.01, 0.1, 20.));
+  // Arc of 50m radius: chords of sqrt(8 * 0.01 * 50) = 2m deviate 1cm from it.
+  complexity.max_curvature = 1. / 50.;
+  EXPECT_NEAR(2., GridUnitForError(complexity, 0.01, 0.1, 20.), 1e-12);
+  // The tightest of both curvatures prevails.
+  complexity.max_vertical_curvature = 1. / 2.;
+  EXPECT_NEAR(0.4, GridUnitForError(complexity, 0.01, 0.1, 20.), 1e-12);
+  EXPECT_EQ(0.5, GridUnitForError(complexity, 0.01, 0.5, 20.));
+}
+
+GTEST_TEST(EstimateTrianglesTest, EstimateTriangles) {
+  SegmentComplexity complexity;
+  complexity.lane_sizes = {{100., 4.}, {100., 4.}};
+  // Every lane is 25 x 1 grid units of two triangles each.
+  EXPECT_EQ(100, EstimateTriangles(complexity, 4., 1.));
+  // The minimum resolution splits the width into two.
+  EXPECT_EQ(2 * 2 * 50 * 2, EstimateTriangles(complexity, 4., 2.));
+}
+
+class GenerateRoadMeshAdaptivelyTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    features_.draw_elevation_bounds = false;
+    options_.scratch_dirpath = common::Filesystem::get_cwd().get_path();
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  utility::ObjFeatures features_;
+  AdaptiveMeshOptions options_;
+};
+
+TEST_F(GenerateRoadMeshAdaptivelyTest, MeasureSegment) {
+  EXPECT_THROW(MeasureSegment(nullptr, 1.), maliput::common::assertion_error);
+  const api::Segment* segment = rn_->road_geometry()->junction(0)->segment(0);
+  EXPECT_THROW(MeasureSegment(segment, 0.), maliput::common::assertion_error);
+  const SegmentComplexity dut = MeasureSegment(segment, 1.);
+  ASSERT_EQ(segment->num_lanes(), static_cast<int>(dut.lane_sizes.size()));
+  EXPECT_DOUBLE_EQ(segment->lane(0)->length(), dut.lane_sizes[0].first);
+  EXPECT_LE(0., dut.max_curvature);
+  EXPECT_LE(0., dut.max_vertical_curvature);
+}
+
+TEST_F(GenerateRoadMeshAdaptivelyTest, Throws) {
+  options_.max_error = 0.01;
+  EXPECT_THROW(GenerateRoadMeshAdaptively(nullptr, features_, options_, nullptr), maliput::common::assertion_error);
+  options_.max_error = 0.;
+  EXPECT_THROW(GenerateRoadMeshAdaptively(rn_->road_geometry(), features_, options_, nullptr),
+               maliput::common::assertion_error);
+}
+
+TEST_F(GenerateRoadMeshAdaptivelyTest, MaxError) {
+  options_.max_error = 0.01;
+  AdaptiveMeshReport fine_report;
+  const RoadMesh fine = GenerateRoadMeshAdaptively(rn_->road_geometry(), features_, options_, &fine_report);
+  EXPECT_EQ(0.01, fine_report.max_error);
+  EXPECT_EQ(CountTriangles(fine.mesh), fine_report.num_triangles);
+  EXPECT_LE(options_.min_grid_unit, fine_report.min_grid_unit);
+  EXPECT_GE(options_.max_grid_unit, fine_report.max_grid_unit);
+
+  // A looser error never produces more triangles.
+  options_.max_error = 0.5;
+  AdaptiveMeshReport coarse_report;
+  GenerateRoadMeshAdaptively(rn_->road_geometry(), features_, options_, &coarse_report);
+  EXPECT_LE(coarse_report.estimated_triangles, fine_report.estimated_triangles);
+  EXPECT_LE(coarse_report.num_triangles, fine_report.num_triangles);
+}
+
+TEST_F(GenerateRoadMeshAdaptivelyTest, TriangleBudget) {
+  options_.max_error = 0.01;
+  AdaptiveMeshReport unbounded_report;
+  GenerateRoadMeshAdaptively(rn_->road_geometry(), features_, options_, &unbounded_report);
+
+  // The coarsest possible mesh uses the largest grid unit everywhere.
+  int64_t min_triangles{0};
+  const api::RoadGeometry* rg = rn_->road_geometry();
+  for (int i = 0; i < rg->num_junctions(); ++i) {
+    for (int j = 0; j < rg->junction(i)->num_segments(); ++j) {
+      min_triangles += EstimateTriangles(MeasureSegment(rg->junction(i)->segment(j), options_.sampling_step),
+                                         options_.max_grid_unit, options_.min_grid_resolution);
+    }
+  }
+  ASSERT_LT(min_triangles, unbounded_report.estimated_triangles);
+
+  options_.triangle_budget = (min_triangles + unbounded_report.estimated_triangles) / 2;
+  AdaptiveMeshReport dut;
+  GenerateRoadMeshAdaptively(rn_->road_geometry(), features_, options_, &dut);
+  EXPECT_LE(dut.estimated_triangles, options_.triangle_budget);
+  EXPECT_LT(unbounded_report.max_error, dut.max_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
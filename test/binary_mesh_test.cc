@@ -0,0 +1,169 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/binary_mesh.h"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <yaml-cpp/yaml.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// A quad and a triangle that share two vertices, with a material each. The triangle has no normals.
+constexpr char kObj[] = R"R(v 0 0 0
+v 1 0 0
+v 1 1 0
+v 0 1 0
+v 2 0 1
+vn 0 0 1
+usemtl asphalt
+f 1//1 2//1 3//1 4//1
+usemtl marker
+f 2 5 3
+)R";
+
+class BinaryMeshTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::istringstream in(kObj);
+    mesh_ = ReadObj(&in);
+    materials_ = {{"asphalt", {"Kd 0.2 0.4 0.6"}}, {"marker", {"Kd 1 1 1", "d 0.5"}}};
+  }
+
+  template <typename T>
+  static T Read(const std::string& bytes, size_t offset) {
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+  }
+
+  Mesh mesh_;
+  MaterialLibrary materials_;
+};
+
+TEST_F(BinaryMeshTest, Glb) {
+  EXPECT_THROW(WriteGlb(mesh_, materials_, nullptr), maliput::common::assertion_error);
+
+  std::ostringstream out;
+  WriteGlb(mesh_, materials_, &out);
+  const std::string glb = out.str();
+  ASSERT_GE(glb.size(), 20u);
+  EXPECT_EQ("glTF", glb.substr(0, 4));
+  EXPECT_EQ(2u, Read<uint32_t>(glb, 4));
+  EXPECT_EQ(glb.size(), Read<uint32_t>(glb, 8));
+  const uint32_t json_size = Read<uint32_t>(glb, 12);
+  EXPECT_EQ(0u, json_size % 4);
+  EXPECT_EQ("JSON", glb.substr(16, 4));
+  const YAML::Node json = YAML::Load(glb.substr(20, json_size));
+  const size_t bin_offset = 20 + json_size;
+  const uint32_t bin_size = Read<uint32_t>(glb, bin_offset);
+  EXPECT_EQ(std::string("BIN\0", 4), glb.substr(bin_offset + 4, 4));
+  EXPECT_EQ(glb.size(), bin_offset + 8 + bin_size);
+  EXPECT_EQ(bin_size, json["buffers"][0]["byteLength"].as<uint32_t>());
+
+  // Five distinct positions but seven distinct (vertex, normal) pairs, as the corners of the triangle have no normal.
+  const YAML::Node& accessors = json["accessors"];
+  EXPECT_EQ(7, accessors[0]["count"].as<int>());
+  EXPECT_EQ(7, accessors[1]["count"].as<int>());
+  // The quad is split into two triangles.
+  const YAML::Node& primitives = json["meshes"][0]["primitives"];
+  ASSERT_EQ(2u, primitives.size());
+  EXPECT_EQ(6, accessors[primitives[0]["indices"].as<int>()]["count"].as<int>());
+  EXPECT_EQ(3, accessors[primitives[1]["indices"].as<int>()]["count"].as<int>());
+  EXPECT_EQ(1, primitives[1]["material"].as<int>());
+  // Positions are relative to the minimum corner, in the y-up frame.
+  EXPECT_EQ((std::vector<double>{0., 0., -1.}), json["nodes"][0]["translation"].as<std::vector<double>>());
+  EXPECT_EQ((std::vector<double>{2., 1., 1.}), accessors[0]["max"].as<std::vector<double>>());
+  EXPECT_EQ(0.5, json["materials"][1]["pbrMetallicRoughness"]["baseColorFactor"][3].as<double>());
+  EXPECT_EQ("BLEND", json["materials"][1]["alphaMode"].as<std::string>());
+  EXPECT_EQ(7u * 3 * 4 * 2 + 9 * 4, bin_size);
+}
+
+// Meshes without triangles cannot be written as valid glTF.
+TEST_F(BinaryMeshTest, GlbEmptyMesh) {
+  std::ostringstream out;
+  EXPECT_THROW(WriteGlb(Mesh{}, materials_, &out), maliput::common::assertion_error);
+  std::istringstream in("v 0 0 0\nv 1 0 0\n");
+  EXPECT_THROW(WriteGlb(ReadObj(&in), materials_, &out), maliput::common::assertion_error);
+}
+
+// Faces without material use the default glTF material, and no empty materials array is written.
+TEST_F(BinaryMeshTest, GlbWithoutMaterials) {
+  std::istringstream in("v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\n");
+  std::ostringstream out;
+  WriteGlb(ReadObj(&in), materials_, &out);
+  const std::string glb = out.str();
+  const uint32_t json_size = Read<uint32_t>(glb, 12);
+  const YAML::Node json = YAML::Load(glb.substr(20, json_size));
+  EXPECT_FALSE(json["materials"].IsDefined());
+  const YAML::Node& primitives = json["meshes"][0]["primitives"];
+  ASSERT_EQ(1u, primitives.size());
+  EXPECT_FALSE(primitives[0]["material"].IsDefined());
+  EXPECT_EQ(3, json["accessors"][primitives[0]["indices"].as<int>()]["count"].as<int>());
+  EXPECT_EQ(glb.size(), Read<uint32_t>(glb, 8));
+}
+
+TEST_F(BinaryMeshTest, Ply) {
+  EXPECT_THROW(WritePly(mesh_, materials_, nullptr), maliput::common::assertion_error);
+
+  std::ostringstream out;
+  WritePly(mesh_, materials_, &out);
+  const std::string ply = out.str();
+  const size_t header_end = ply.find("end_header\n");
+  ASSERT_NE(std::string::npos, header_end);
+  const std::string header = ply.substr(0, header_end);
+  EXPECT_EQ(0u, header.find("ply\nformat binary_little_endian 1.0\n"));
+  EXPECT_NE(std::string::npos, header.find("element vertex 7\n"));
+  EXPECT_NE(std::string::npos, header.find("element face 2\n"));
+
+  const size_t vertex_size = 3 * sizeof(double) + 3 * sizeof(float);
+  size_t offset = header_end + std::string("end_header\n").size();
+  EXPECT_EQ(1., Read<double>(ply, offset + vertex_size + 0));
+  offset += 7 * vertex_size;
+  // Quad: corner count, four indices and the asphalt color.
+  EXPECT_EQ(4, Read<uint8_t>(ply, offset));
+  EXPECT_EQ(3u, Read<uint32_t>(ply, offset + 1 + 3 * sizeof(uint32_t)));
+  EXPECT_EQ(51, Read<uint8_t>(ply, offset + 1 + 4 * sizeof(uint32_t)));
+  offset += 1 + 4 * sizeof(uint32_t) + 3;
+  // Triangle.
+  EXPECT_EQ(3, Read<uint8_t>(ply, offset));
+  EXPECT_EQ(255, Read<uint8_t>(ply, offset + 1 + 3 * sizeof(uint32_t)));
+  EXPECT_EQ(ply.size(), offset + 1 + 3 * sizeof(uint32_t) + 3);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
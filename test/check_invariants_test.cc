@@ -0,0 +1,135 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/check_invariants.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class CheckInvariantsInParallelTest : public ::testing::TestWithParam<int> {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    options_.num_threads = GetParam();
+  }
+
+  // @returns The violations reported by CheckInvariantsInParallel() with `options_`.
+  std::vector<std::string> Check(InvariantCheckReport* report) const {
+    std::vector<std::string> violations;
+    *report = CheckInvariantsInParallel(
+        rn_->road_geometry(), options_, [&violations](const std::string& v) { violations.push_back(v); }, nullptr);
+    return violations;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  InvariantCheckOptions options_;
+};
+
+TEST_P(CheckInvariantsInParallelTest, Throws) {
+  const auto on_violation = [](const std::string&) {};
+  EXPECT_THROW(CheckInvariantsInParallel(nullptr, options_, on_violation, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(CheckInvariantsInParallel(rn_->road_geometry(), options_, nullptr, nullptr),
+               maliput::common::assertion_error);
+  EXPECT_THROW(CheckSegmentInvariants(nullptr, 1., 1.), maliput::common::assertion_error);
+}
+
+TEST_P(CheckInvariantsInParallelTest, ValidRoadGeometry) {
+  int num_progress_calls{0};
+  const InvariantCheckReport report = CheckInvariantsInParallel(
+      rn_->road_geometry(), options_, [](const std::string& v) { ADD_FAILURE() << v; },
+      [&num_progress_calls](int num_checked, int num_segments) {
+        EXPECT_EQ(++num_progress_calls, num_checked);
+        EXPECT_LE(num_checked, num_segments);
+      });
+  int num_segments{0};
+  for (int i = 0; i < rn_->road_geometry()->num_junctions(); ++i) {
+    num_segments += rn_->road_geometry()->junction(i)->num_segments();
+  }
+  EXPECT_EQ(num_segments, report.num_segments);
+  EXPECT_EQ(num_segments, report.num_checked_segments);
+  EXPECT_EQ(num_segments, num_progress_calls);
+  EXPECT_EQ(0, report.num_violations);
+  EXPECT_FALSE(report.aborted);
+  EXPECT_LE(1, report.num_threads);
+}
+
+// Zero tolerances report every lane end that is not bitwise coincident with its reference. The reported violations
+// must not depend on the number of threads and must be cut at `max_violations`.
+TEST_P(CheckInvariantsInParallelTest, MaxViolations) {
+  options_.linear_tolerance = 0.;
+  options_.angular_tolerance = 0.;
+  InvariantCheckReport report;
+  const std::vector<std::string> all_violations = Check(&report);
+  EXPECT_EQ(static_cast<int>(all_violations.size()), report.num_violations);
+
+  options_.num_threads = 1;
+  InvariantCheckReport sequential_report;
+  EXPECT_EQ(all_violations, Check(&sequential_report));
+
+  options_.num_threads = GetParam();
+  options_.max_violations = 1;
+  const std::vector<std::string> first_violations = Check(&report);
+  if (all_violations.empty()) {
+    EXPECT_TRUE(first_violations.empty());
+    EXPECT_FALSE(report.aborted);
+  } else {
+    ASSERT_EQ(1, static_cast<int>(first_violations.size()));
+    EXPECT_EQ(all_violations.front(), first_violations.front());
+    if (all_violations.size() > 1) {
+      EXPECT_TRUE(report.aborted);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(CheckInvariantsInParallelTestGroup, CheckInvariantsInParallelTest,
+                        ::testing::Values(0, 1, 4));
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,266 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/composite_dynamic_environment_handler.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "integration/simulated_timer.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Reports a deadline every `period` seconds, or none when `period` is std::nullopt. Every update takes `cost` seconds,
+// appends `name` to `calls` and publishes that the phase ring `name` changed.
+class MockDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  MockDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network, std::optional<double> period,
+                                double cost, const std::string& name, std::vector<std::string>* calls)
+      : DynamicEnvironmentHandler(timer, road_network), period_(period), cost_(cost), name_(name), calls_(calls) {}
+
+  void Update() override {
+    DynamicEnvironmentChanges* changes = BeginChanges();
+    calls_->push_back(name_);
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < cost_) {
+    }
+    changes->phases.push_back({api::rules::PhaseRing::Id(name_), api::rules::Phase::Id("Phase")});
+    if (period_.has_value()) {
+      while (next_update_time_ <= timer_->Elapsed()) {
+        next_update_time_ += *period_;
+      }
+    }
+    PublishChanges();
+  }
+
+  std::optional<double> NextUpdateTime() const override {
+    return period_.has_value() ? std::make_optional(next_update_time_) : std::nullopt;
+  }
+
+ private:
+  const std::optional<double> period_;
+  const double cost_{};
+  const std::string name_;
+  std::vector<std::string>* calls_{};
+  double next_update_time_{period_.value_or(0.)};
+};
+
+// Reaches a transition deadline at the time of every update without changing any state.
+class DeadlineOnlyDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  DeadlineOnlyDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network)
+      : DynamicEnvironmentHandler(timer, road_network) {}
+
+  void Update() override {
+    DynamicEnvironmentChanges* changes = BeginChanges();
+    changes->deadlines.push_back(changes->time);
+    PublishChanges();
+  }
+};
+
+class CompositeDynamicEnvironmentHandlerTest : public ::testing::Test {
+ public:
+  static constexpr double kTickBudget{1.};
+
+  void SetUp() override { ASSERT_NE(rn_, nullptr); }
+
+  std::unique_ptr<MockDynamicEnvironmentHandler> MakeHandler(std::optional<double> period, double cost,
+                                                             const std::string& name) {
+    return std::make_unique<MockDynamicEnvironmentHandler>(&timer_, rn_.get(), period, cost, name, &calls_);
+  }
+
+  SimulatedTimer timer_;
+  std::unique_ptr<api::RoadNetwork> rn_ = maliput::api::test::CreateRoadNetwork();
+  std::vector<std::string> calls_;
+};
+
+TEST_F(CompositeDynamicEnvironmentHandlerTest, Constructor) {
+  EXPECT_THROW(CompositeDynamicEnvironmentHandler(&timer_, rn_.get(), 0.), maliput::common::assertion_error);
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kTickBudget);
+  EXPECT_EQ(kTickBudget, dut.tick_budget());
+  EXPECT_EQ(0, dut.num_handlers());
+  EXPECT_THROW(dut.AddHandler(nullptr, 0), maliput::common::assertion_error);
+  EXPECT_THROW(dut.handler(0), maliput::common::assertion_error);
+  EXPECT_THROW(dut.handler_stats(0), maliput::common::assertion_error);
+}
+
+// Children run in decreasing order of priority and, with the same priority, in the order they were added.
+TEST_F(CompositeDynamicEnvironmentHandlerTest, PriorityOrder) {
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kTickBudget);
+  EXPECT_EQ(0, dut.AddHandler(MakeHandler(1., 0., "Low"), 1));
+  EXPECT_EQ(1, dut.AddHandler(MakeHandler(1., 0., "High"), 3));
+  EXPECT_EQ(2, dut.AddHandler(MakeHandler(1., 0., "MediumFirst"), 2));
+  EXPECT_EQ(3, dut.AddHandler(MakeHandler(1., 0., "MediumSecond"), 2));
+  ASSERT_EQ(4, dut.num_handlers());
+  EXPECT_EQ(3, dut.handler_stats(1).priority);
+
+  int num_published_changes{0};
+  dut.Subscribe([&num_published_changes](const DynamicEnvironmentChanges&) { ++num_published_changes; });
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"High", "MediumFirst", "MediumSecond", "Low"}), calls_);
+  // The changes of all the children are published at once.
+  EXPECT_EQ(1, num_published_changes);
+  EXPECT_EQ(1., dut.last_changes().time);
+  ASSERT_EQ(4u, dut.last_changes().phases.size());
+  EXPECT_EQ(api::rules::PhaseRing::Id("High"), dut.last_changes().phases[0].phase_ring_id);
+  EXPECT_EQ(api::rules::PhaseRing::Id("Low"), dut.last_changes().phases[3].phase_ring_id);
+}
+
+// Only the children that are due run.
+TEST_F(CompositeDynamicEnvironmentHandlerTest, DueChildren) {
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kTickBudget);
+  dut.AddHandler(MakeHandler(1., 0., "Fast"), 1);
+  dut.AddHandler(MakeHandler(3., 0., "Slow"), 0);
+  ASSERT_TRUE(dut.NextUpdateTime().has_value());
+  EXPECT_EQ(1., dut.NextUpdateTime().value());
+
+  timer_.Advance(0.5);
+  dut.Update();
+  EXPECT_TRUE(calls_.empty());
+  EXPECT_TRUE(dut.last_changes().empty());
+
+  timer_.Advance(0.5);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"Fast"}), calls_);
+  EXPECT_EQ(2., dut.NextUpdateTime().value());
+
+  timer_.Advance(2.);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"Fast", "Fast", "Slow"}), calls_);
+  EXPECT_EQ(1, dut.handler_stats(1).num_updates);
+  EXPECT_EQ(2, dut.handler_stats(0).num_updates);
+
+  // A child that can't tell when it is due makes the composite unable to tell as well.
+  dut.AddHandler(MakeHandler(std::nullopt, 0., "Polled"), 2);
+  EXPECT_FALSE(dut.NextUpdateTime().has_value());
+}
+
+// Once the budget is exhausted, the due children left are deferred to the next tick, where they run first.
+TEST_F(CompositeDynamicEnvironmentHandlerTest, TickBudget) {
+  constexpr double kBudget{1e-3};
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kBudget);
+  dut.AddHandler(MakeHandler(1., 2. * kBudget, "Expensive"), 1);
+  dut.AddHandler(MakeHandler(1., 0., "Cheap"), 0);
+
+  timer_.Advance(1.);
+  dut.Update();
+  // The first child always runs, even when it exceeds the budget.
+  EXPECT_EQ((std::vector<std::string>{"Expensive"}), calls_);
+  EXPECT_LE(2. * kBudget, dut.handler_stats(0).last_cost);
+  EXPECT_LE(2. * kBudget, dut.last_tick_cost());
+  EXPECT_EQ(1, dut.handler_stats(1).num_deferrals);
+  EXPECT_EQ(0, dut.handler_stats(1).num_updates);
+  EXPECT_EQ(1, dut.num_over_budget_ticks());
+  // The deferred child is due right away.
+  ASSERT_TRUE(dut.NextUpdateTime().has_value());
+  EXPECT_EQ(timer_.Elapsed(), dut.NextUpdateTime().value());
+
+  // Next tick, the expensive child is not due while the deferred one runs regardless of the budget.
+  timer_.Advance(0.1);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"Expensive", "Cheap"}), calls_);
+  EXPECT_EQ(1, dut.handler_stats(1).num_updates);
+  EXPECT_EQ(1, dut.num_over_budget_ticks());
+  EXPECT_EQ(2., dut.NextUpdateTime().value());
+
+  // When both are due again, the deferred child runs in the next tick even if the budget is exhausted again.
+  timer_.Advance(0.9);
+  dut.Update();
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"Expensive", "Cheap", "Expensive", "Cheap"}), calls_);
+  EXPECT_EQ(2, dut.handler_stats(1).num_deferrals);
+  EXPECT_EQ(2, dut.handler_stats(0).num_updates);
+  EXPECT_LE(dut.handler_stats(0).last_cost, dut.handler_stats(0).max_cost);
+  EXPECT_LE(dut.handler_stats(0).max_cost, dut.handler_stats(0).total_cost);
+}
+
+// Deferred children run before higher priority children that are due in the same tick, so a child that keeps being
+// starved by the budget is never deferred twice in a row.
+TEST_F(CompositeDynamicEnvironmentHandlerTest, DeferredChildrenRunFirst) {
+  constexpr double kBudget{1e-3};
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kBudget);
+  dut.AddHandler(MakeHandler(1., 2. * kBudget, "High"), 2);
+  dut.AddHandler(MakeHandler(1., 2. * kBudget, "Medium"), 1);
+  dut.AddHandler(MakeHandler(1., 0., "Low"), 0);
+
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"High"}), calls_);
+
+  // Every child is due again. The deferred ones run first, in decreasing order of priority, and exhaust the budget, so
+  // the higher priority child is deferred this time.
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"High", "Medium", "Low"}), calls_);
+  EXPECT_EQ(1, dut.handler_stats(0).num_deferrals);
+  EXPECT_EQ(1, dut.handler_stats(1).num_deferrals);
+  EXPECT_EQ(1, dut.handler_stats(2).num_deferrals);
+
+  // The higher priority child catches up in the next tick, and every child ran once per period.
+  dut.Update();
+  EXPECT_EQ((std::vector<std::string>{"High", "Medium", "Low", "High"}), calls_);
+  for (int i = 0; i < dut.num_handlers(); ++i) {
+    EXPECT_EQ(i == 0 ? 2 : 1, dut.handler_stats(i).num_updates);
+  }
+}
+
+// The deadlines reached by children that change no state are kept, although their changes aren't published.
+TEST_F(CompositeDynamicEnvironmentHandlerTest, DeadlinesWithoutChanges) {
+  CompositeDynamicEnvironmentHandler dut(&timer_, rn_.get(), kTickBudget);
+  dut.AddHandler(std::make_unique<DeadlineOnlyDynamicEnvironmentHandler>(&timer_, rn_.get()), 0);
+  int num_published{0};
+  dut.Subscribe([&num_published](const DynamicEnvironmentChanges&) { ++num_published; });
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ(0, num_published);
+  EXPECT_TRUE(dut.last_changes().empty());
+  EXPECT_EQ((std::vector<double>{1.}), dut.last_changes().deadlines);
+
+  dut.AddHandler(MakeHandler(std::nullopt, 0., "A"), 0);
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ(1, num_published);
+  EXPECT_EQ((std::vector<double>{2.}), dut.last_changes().deadlines);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -31,12 +31,19 @@
 
 #include <chrono>
 #include <memory>
+#include <sstream>
 
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
 #include <maliput/test_utilities/mock.h>
 
 #include "integration/create_timer.h"
+#include "integration/dynamic_environment_log.h"
+#include "integration/dynamic_environment_replay_handler.h"
 #include "integration/fixed_phase_iteration_handler.h"
+#include "integration/phase_duration_iteration_handler.h"
+#include "integration/rule_state_schedule.h"
+#include "integration/scheduled_rule_state_handler.h"
 
 namespace maliput {
 namespace integration {
@@ -53,6 +60,55 @@ GTEST_TEST(CreateDynamicEnvironmentHandlerTest, CreateDynamicEnvironmentHandler)
 
   EXPECT_NE(deh, nullptr);
   EXPECT_NE(dynamic_cast<FixedPhaseIterationHandler*>(deh.get()), nullptr);
+
+  deh = CreateDynamicEnvironmentHandler(DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler, timer.get(),
+                                        rn.get(), kPhaseDuration);
+  EXPECT_NE(deh, nullptr);
+  EXPECT_NE(dynamic_cast<PhaseDurationIterationHandler*>(deh.get()), nullptr);
+
+  deh = CreateDynamicEnvironmentHandler(DynamicEnvironmentHandlerType::kScheduledRuleStateHandler, timer.get(),
+                                        rn.get(), RuleStateSchedule{});
+  EXPECT_NE(deh, nullptr);
+  EXPECT_NE(dynamic_cast<ScheduledRuleStateHandler*>(deh.get()), nullptr);
+
+  // A log with a single keyframe and no states.
+  DynamicEnvironmentRecord keyframe;
+  keyframe.type = DynamicEnvironmentRecord::Type::kKeyframe;
+  std::stringstream log;
+  DynamicEnvironmentLogWriter(&log).Write(keyframe);
+  deh = CreateDynamicEnvironmentHandler(DynamicEnvironmentHandlerType::kDynamicEnvironmentReplayHandler, timer.get(),
+                                        rn.get(), &log, DynamicEnvironmentReplayHandler::Speed::kRealTime);
+  EXPECT_NE(deh, nullptr);
+  EXPECT_NE(dynamic_cast<DynamicEnvironmentReplayHandler*>(deh.get()), nullptr);
+
+  // Each implementation takes its own arguments.
+  EXPECT_THROW(CreateDynamicEnvironmentHandler(DynamicEnvironmentHandlerType::kScheduledRuleStateHandler, timer.get(),
+                                               rn.get(), kPhaseDuration),
+               maliput::common::assertion_error);
+  EXPECT_THROW(CreateDynamicEnvironmentHandler(DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler, timer.get(),
+                                               rn.get(), RuleStateSchedule{}),
+               maliput::common::assertion_error);
+}
+
+// The implementation is selected at compile time.
+GTEST_TEST(CreateDynamicEnvironmentHandlerTest, CreateDynamicEnvironmentHandlerOfType) {
+  auto rn = maliput::api::test::CreateRoadNetwork();
+  ASSERT_NE(rn, nullptr);
+  auto timer = CreateTimer(TimerType::kChronoTimer);
+  ASSERT_NE(timer, nullptr);
+  const double kPhaseDuration{1};
+  std::unique_ptr<DynamicEnvironmentHandler> deh =
+      CreateDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler>(timer.get(), rn.get(),
+                                                                                                  kPhaseDuration);
+  EXPECT_NE(dynamic_cast<FixedPhaseIterationHandler*>(deh.get()), nullptr);
+
+  deh = CreateDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kPhaseDurationIterationHandler>(
+      timer.get(), rn.get(), kPhaseDuration);
+  EXPECT_NE(dynamic_cast<PhaseDurationIterationHandler*>(deh.get()), nullptr);
+
+  deh = CreateDynamicEnvironmentHandler<DynamicEnvironmentHandlerType::kScheduledRuleStateHandler>(
+      timer.get(), rn.get(), RuleStateSchedule{});
+  EXPECT_NE(dynamic_cast<ScheduledRuleStateHandler*>(deh.get()), nullptr);
 }
 
 }  // namespace
@@ -33,9 +33,13 @@
 #include <memory>
 
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
 #include <maliput/test_utilities/mock.h>
 
 #include "integration/chrono_timer.h"
+#include "integration/simulated_timer.h"
+#include "integration/steady_timer.h"
+#include "integration/tsc_timer.h"
 
 namespace maliput {
 namespace integration {
@@ -45,6 +49,22 @@ GTEST_TEST(CreateTimerTest, CreateTimer) {
   std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
   EXPECT_NE(timer, nullptr);
   EXPECT_NE(dynamic_cast<ChronoTimer*>(timer.get()), nullptr);
+
+  timer = CreateTimer(TimerType::kSimulatedTimer);
+  EXPECT_NE(timer, nullptr);
+  EXPECT_NE(dynamic_cast<SimulatedTimer*>(timer.get()), nullptr);
+
+  timer = CreateTimer(TimerType::kSteadyTimer);
+  EXPECT_NE(timer, nullptr);
+  EXPECT_NE(dynamic_cast<SteadyTimer*>(timer.get()), nullptr);
+
+  if (TscTimer::IsSupported()) {
+    timer = CreateTimer(TimerType::kTscTimer);
+    EXPECT_NE(timer, nullptr);
+    EXPECT_NE(dynamic_cast<TscTimer*>(timer.get()), nullptr);
+  } else {
+    EXPECT_THROW(CreateTimer(TimerType::kTscTimer), maliput::common::assertion_error);
+  }
 }
 
 }  // namespace
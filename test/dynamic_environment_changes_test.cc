@@ -0,0 +1,160 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_changes.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/traffic_lights.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::BulbState;
+using api::rules::DiscreteValueRule;
+using api::rules::Phase;
+using api::rules::Rule;
+
+DiscreteValueRule::DiscreteValue MakeDiscreteValue(const std::string& value) {
+  DiscreteValueRule::DiscreteValue discrete_value;
+  discrete_value.value = value;
+  return discrete_value;
+}
+
+class DynamicEnvironmentChangesTest : public ::testing::Test {
+ public:
+  const Rule::Id kChangingRule{"Right-Of-Way Rule Type/Changing"};
+  const Rule::Id kSteadyRule{"Right-Of-Way Rule Type/Steady"};
+  const api::rules::UniqueBulbId kChangingBulb{api::rules::TrafficLight::Id("TrafficLight"),
+                                               api::rules::BulbGroup::Id("BulbGroup"), api::rules::Bulb::Id("Green")};
+  const api::rules::UniqueBulbId kSteadyBulb{api::rules::TrafficLight::Id("TrafficLight"),
+                                             api::rules::BulbGroup::Id("BulbGroup"), api::rules::Bulb::Id("Yellow")};
+  const Phase kGo{Phase::Id("Go"),
+                  {{kChangingRule, MakeDiscreteValue("Go")}, {kSteadyRule, MakeDiscreteValue("Go")}},
+                  api::rules::BulbStates{{kChangingBulb, BulbState::kOn}, {kSteadyBulb, BulbState::kOff}}};
+  const Phase kStop{Phase::Id("Stop"),
+                    {{kChangingRule, MakeDiscreteValue("Stop")}, {kSteadyRule, MakeDiscreteValue("Go")}},
+                    api::rules::BulbStates{{kChangingBulb, BulbState::kOff}, {kSteadyBulb, BulbState::kOff}}};
+};
+
+TEST_F(DynamicEnvironmentChangesTest, DiffPhases) {
+  const PhaseStateChanges dut = DiffPhases(kGo, kStop);
+  ASSERT_EQ(1u, dut.discrete_value_rule_states.size());
+  EXPECT_EQ(kChangingRule, dut.discrete_value_rule_states[0].first);
+  EXPECT_EQ(MakeDiscreteValue("Stop"), dut.discrete_value_rule_states[0].second);
+  ASSERT_EQ(1u, dut.bulb_states.size());
+  EXPECT_EQ(kChangingBulb, dut.bulb_states[0].first);
+  EXPECT_EQ(BulbState::kOff, dut.bulb_states[0].second);
+
+  // Nothing changes within a phase.
+  const PhaseStateChanges same = DiffPhases(kGo, kGo);
+  EXPECT_TRUE(same.discrete_value_rule_states.empty());
+  EXPECT_TRUE(same.bulb_states.empty());
+}
+
+TEST_F(DynamicEnvironmentChangesTest, AppendAndClear) {
+  DynamicEnvironmentChanges dut;
+  EXPECT_TRUE(dut.empty());
+
+  dut.Clear(1.);
+  dut.Append(api::rules::PhaseRing::Id("Ring"), kStop.id(), DiffPhases(kGo, kStop));
+  EXPECT_FALSE(dut.empty());
+  EXPECT_EQ(1., dut.time);
+  ASSERT_EQ(1u, dut.phases.size());
+  EXPECT_EQ(api::rules::PhaseRing::Id("Ring"), dut.phases[0].phase_ring_id);
+  EXPECT_EQ(kStop.id(), dut.phases[0].phase_id);
+  EXPECT_EQ(1u, dut.discrete_value_rule_states.size());
+  EXPECT_EQ(1u, dut.bulb_states.size());
+
+  dut.Clear(2.);
+  EXPECT_TRUE(dut.empty());
+  EXPECT_EQ(2., dut.time);
+
+  api::rules::RangeValueRule::Range speed_limit;
+  speed_limit.min = 0.;
+  speed_limit.max = 13.9;
+  dut.range_value_rule_states.emplace_back(api::rules::Rule::Id("SpeedLimit"), speed_limit);
+  EXPECT_FALSE(dut.empty());
+  dut.Clear(3.);
+  EXPECT_TRUE(dut.empty());
+}
+
+// Changes appended after Clear() reuse the removed ones, which must not leak into the new changes.
+TEST_F(DynamicEnvironmentChangesTest, ReuseAfterClear) {
+  DynamicEnvironmentChanges dut;
+  dut.Clear(1.);
+  dut.Append(api::rules::PhaseRing::Id("LongPhaseRingIdentifier"), kStop.id(), DiffPhases(kGo, kStop));
+  dut.Append(api::rules::PhaseRing::Id("Ring"), kStop.id(), DiffPhases(kGo, kStop));
+
+  for (int i = 0; i < 3; ++i) {
+    dut.Clear(2. + i);
+    dut.Append(api::rules::PhaseRing::Id("Ring"), kGo.id(), DiffPhases(kStop, kGo));
+    ASSERT_EQ(1u, dut.phases.size());
+    EXPECT_EQ(api::rules::PhaseRing::Id("Ring"), dut.phases[0].phase_ring_id);
+    EXPECT_EQ(kGo.id(), dut.phases[0].phase_id);
+    ASSERT_EQ(1u, dut.discrete_value_rule_states.size());
+    EXPECT_EQ(kChangingRule, dut.discrete_value_rule_states[0].first);
+    EXPECT_EQ(MakeDiscreteValue("Go"), dut.discrete_value_rule_states[0].second);
+    ASSERT_EQ(1u, dut.bulb_states.size());
+    EXPECT_EQ(kChangingBulb, dut.bulb_states[0].first);
+    EXPECT_EQ(BulbState::kOn, dut.bulb_states[0].second);
+  }
+}
+
+TEST_F(DynamicEnvironmentChangesTest, AppendChanges) {
+  DynamicEnvironmentChanges other;
+  other.Clear(5.);
+  other.Append(api::rules::PhaseRing::Id("Ring"), kStop.id(), DiffPhases(kGo, kStop));
+  api::rules::RangeValueRule::Range speed_limit;
+  speed_limit.min = 0.;
+  speed_limit.max = 13.9;
+  other.range_value_rule_states.emplace_back(api::rules::Rule::Id("SpeedLimit"), speed_limit);
+
+  DynamicEnvironmentChanges dut;
+  dut.Clear(1.);
+  dut.Append(api::rules::PhaseRing::Id("OtherRing"), kGo.id(), DiffPhases(kStop, kGo));
+  dut.Append(other);
+  EXPECT_EQ(1., dut.time);
+  ASSERT_EQ(2u, dut.phases.size());
+  EXPECT_EQ(api::rules::PhaseRing::Id("OtherRing"), dut.phases[0].phase_ring_id);
+  EXPECT_EQ(api::rules::PhaseRing::Id("Ring"), dut.phases[1].phase_ring_id);
+  EXPECT_EQ(2u, dut.discrete_value_rule_states.size());
+  EXPECT_EQ(2u, dut.bulb_states.size());
+  ASSERT_EQ(1u, dut.range_value_rule_states.size());
+  EXPECT_EQ(api::rules::Rule::Id("SpeedLimit"), dut.range_value_rule_states[0].first);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
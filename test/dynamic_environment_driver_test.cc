@@ -0,0 +1,235 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_driver.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "integration/create_timer.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Reports a deadline every `period` seconds, or none when `period` is std::nullopt, and takes `update_duration`
+// seconds to update. It records the deadline each update was due at and whether two updates ever overlapped.
+class MockDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  MockDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network, std::optional<double> period,
+                                bool fail = false, double update_duration = 0.)
+      : DynamicEnvironmentHandler(timer, road_network),
+        period_(period),
+        fail_(fail),
+        update_duration_(update_duration) {}
+
+  void Update() override {
+    if (updating_.exchange(true)) {
+      overlapped_ = true;
+    }
+    update_times_.push_back(timer_->Elapsed());
+    deadlines_.push_back(next_update_time_);
+    if (period_.has_value()) {
+      next_update_time_ += *period_;
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(update_duration_));
+    updating_ = false;
+    if (fail_) {
+      throw std::runtime_error("Update failed.");
+    }
+  }
+
+  std::optional<double> NextUpdateTime() const override {
+    return period_.has_value() ? std::make_optional(next_update_time_) : std::nullopt;
+  }
+
+  const std::vector<double>& update_times() const { return update_times_; }
+  const std::vector<double>& deadlines() const { return deadlines_; }
+  bool overlapped() const { return overlapped_; }
+
+ private:
+  const std::optional<double> period_;
+  const bool fail_{};
+  const double update_duration_{};
+  double next_update_time_{period_.value_or(0.)};
+  std::vector<double> update_times_;
+  std::vector<double> deadlines_;
+  std::atomic<bool> updating_{false};
+  bool overlapped_{false};
+};
+
+class DynamicEnvironmentDriverTest : public ::testing::Test {
+ public:
+  static constexpr double kPeriod{0.02};
+  static constexpr double kPollPeriod{0.02};
+  static constexpr int kNumThreads{3};
+
+  void SetUp() override {
+    ASSERT_NE(rn_, nullptr);
+    ASSERT_NE(timer_, nullptr);
+  }
+
+  // Adds a MockDynamicEnvironmentHandler to @p dut.
+  MockDynamicEnvironmentHandler* AddHandler(DynamicEnvironmentDriver* dut, std::optional<double> period,
+                                            bool fail = false, double update_duration = 0.) {
+    auto handler =
+        std::make_unique<MockDynamicEnvironmentHandler>(timer_.get(), rn_.get(), period, fail, update_duration);
+    MockDynamicEnvironmentHandler* result = handler.get();
+    dut->AddHandler(std::move(handler));
+    return result;
+  }
+
+  std::unique_ptr<Timer> timer_ = CreateTimer(TimerType::kChronoTimer);
+  std::unique_ptr<maliput::api::RoadNetwork> rn_ = maliput::api::test::CreateRoadNetwork();
+};
+
+TEST_F(DynamicEnvironmentDriverTest, Constructor) {
+  EXPECT_THROW(DynamicEnvironmentDriver(nullptr, kNumThreads, kPollPeriod), maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentDriver(timer_.get(), kNumThreads, 0.), maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentDriver(timer_.get(), kNumThreads, kPollPeriod, -1.), maliput::common::assertion_error);
+  const DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  EXPECT_EQ(kNumThreads, dut.num_threads());
+  EXPECT_EQ(0, dut.num_handlers());
+}
+
+TEST_F(DynamicEnvironmentDriverTest, AddHandler) {
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  EXPECT_THROW(dut.AddHandler(nullptr), maliput::common::assertion_error);
+  MockDynamicEnvironmentHandler* handler = AddHandler(&dut, kPeriod);
+  EXPECT_EQ(1, dut.num_handlers());
+  EXPECT_EQ(handler, dut.handler(0));
+  EXPECT_THROW(dut.handler(1), maliput::common::assertion_error);
+  EXPECT_THROW(dut.handler(-1), maliput::common::assertion_error);
+}
+
+// Many more handlers than threads are updated at their deadlines, never before them nor concurrently.
+TEST_F(DynamicEnvironmentDriverTest, UpdatesAtDeadlines) {
+  constexpr int kNumHandlers{50};
+  constexpr int kNumPeriods{5};
+  constexpr double kEndTime{kPeriod * kNumPeriods + kPeriod / 2.};
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  std::vector<MockDynamicEnvironmentHandler*> handlers;
+  for (int i = 0; i < kNumHandlers; ++i) {
+    handlers.push_back(AddHandler(&dut, kPeriod));
+  }
+  timer_->Reset();
+  const DynamicEnvironmentDriver::Report report = dut.Run(kEndTime);
+
+  EXPECT_EQ(kNumHandlers * kNumPeriods, report.num_updates);
+  EXPECT_LE(0., report.max_update_delay);
+  // The mock doesn't report the deadlines of its transitions, so every update counts as one.
+  EXPECT_EQ(report.num_updates, report.stats.num_updates());
+  EXPECT_EQ(report.num_updates, report.stats.num_transitions());
+  EXPECT_LE(report.stats.max_lateness(), report.max_update_delay);
+  EXPECT_LE(0., report.stats.total_update_duration());
+  for (const MockDynamicEnvironmentHandler* handler : handlers) {
+    EXPECT_FALSE(handler->overlapped());
+    ASSERT_EQ(kNumPeriods, static_cast<int>(handler->update_times().size()));
+    for (int i = 0; i < kNumPeriods; ++i) {
+      EXPECT_DOUBLE_EQ(kPeriod * (i + 1), handler->deadlines()[i]);
+      EXPECT_LE(handler->deadlines()[i], handler->update_times()[i]);
+    }
+  }
+}
+
+// A handler that takes longer to update than its period falls behind, and every deadline due by the end time is
+// still served after it.
+TEST_F(DynamicEnvironmentDriverTest, SlowHandler) {
+  constexpr int kNumPeriods{4};
+  constexpr double kEndTime{kPeriod * kNumPeriods + kPeriod / 2.};
+  constexpr double kDeadlineMissTolerance{kPeriod / 2.};
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod, kDeadlineMissTolerance);
+  MockDynamicEnvironmentHandler* handler = AddHandler(&dut, kPeriod, false /* fail */, 3. * kPeriod);
+  timer_->Reset();
+  const DynamicEnvironmentDriver::Report report = dut.Run(kEndTime);
+
+  EXPECT_EQ(kNumPeriods, report.num_updates);
+  // Every update but the first one starts at least two periods late.
+  EXPECT_EQ(kDeadlineMissTolerance, report.stats.deadline_miss_tolerance());
+  EXPECT_EQ(kNumPeriods, report.stats.num_transitions());
+  EXPECT_LE(kNumPeriods - 1, report.stats.num_missed_deadlines());
+  EXPECT_LE(3. * kPeriod * kNumPeriods, report.stats.total_update_duration());
+  EXPECT_FALSE(handler->overlapped());
+  ASSERT_EQ(kNumPeriods, static_cast<int>(handler->update_times().size()));
+  for (int i = 0; i < kNumPeriods; ++i) {
+    EXPECT_DOUBLE_EQ(kPeriod * (i + 1), handler->deadlines()[i]);
+  }
+  // The last updates started past the end time, once the previous ones were completed.
+  EXPECT_LT(kEndTime, handler->update_times().back());
+}
+
+// Handlers without deadlines are polled.
+TEST_F(DynamicEnvironmentDriverTest, Polling) {
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  MockDynamicEnvironmentHandler* handler = AddHandler(&dut, std::nullopt);
+  timer_->Reset();
+  const DynamicEnvironmentDriver::Report report = dut.Run(kPollPeriod * 1.5);
+  EXPECT_EQ(1, report.num_updates);
+  // Polls have no deadline to be late for.
+  EXPECT_EQ(0, report.stats.num_transitions());
+  ASSERT_EQ(1, static_cast<int>(handler->update_times().size()));
+  EXPECT_LE(kPollPeriod, handler->update_times()[0]);
+}
+
+TEST_F(DynamicEnvironmentDriverTest, Stop) {
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  MockDynamicEnvironmentHandler* handler = AddHandler(&dut, 100.);
+  timer_->Reset();
+  std::thread stopper([&dut]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    dut.Stop();
+  });
+  EXPECT_EQ(0, dut.Run(200.).num_updates);
+  stopper.join();
+  EXPECT_GT(1., timer_->Elapsed());
+  EXPECT_TRUE(handler->update_times().empty());
+  EXPECT_EQ(0, dut.Run(200.).num_updates);
+}
+
+TEST_F(DynamicEnvironmentDriverTest, Failure) {
+  DynamicEnvironmentDriver dut(timer_.get(), kNumThreads, kPollPeriod);
+  AddHandler(&dut, kPeriod);
+  AddHandler(&dut, kPeriod, true /* fail */);
+  timer_->Reset();
+  EXPECT_THROW(dut.Run(200.), std::runtime_error);
+  EXPECT_GT(1., timer_->Elapsed());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -46,8 +46,16 @@ class MockDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
   MockDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network)
       : DynamicEnvironmentHandler(timer, road_network) {}
 
-  void Update() override { call_update_ = true; }
+  void Update() override {
+    call_update_ = true;
+    DynamicEnvironmentChanges* changes = BeginChanges();
+    if (change_phase_) {
+      changes->Append(api::rules::PhaseRing::Id("PhaseRing"), api::rules::Phase::Id("Phase"), {});
+    }
+    PublishChanges();
+  }
   bool call_update_{false};
+  bool change_phase_{false};
 };
 
 class DynamicEnvironmentHandlerTest : public ::testing::Test {
@@ -75,6 +83,63 @@ TEST_F(DynamicEnvironmentHandlerTest, API) {
   EXPECT_TRUE(mock_deh.call_update_);
 }
 
+TEST_F(DynamicEnvironmentHandlerTest, Subscriptions) {
+  MockDynamicEnvironmentHandler dut{timer_.get(), rn_.get()};
+  int num_first_calls{0};
+  int num_second_calls{0};
+  const int first_id = dut.Subscribe([&num_first_calls](const DynamicEnvironmentChanges& changes) {
+    EXPECT_EQ(1u, changes.phases.size());
+    ++num_first_calls;
+  });
+  const int second_id = dut.Subscribe([&num_second_calls](const DynamicEnvironmentChanges&) { ++num_second_calls; });
+  EXPECT_NE(first_id, second_id);
+
+  // Subscribers are only called when something changes.
+  dut.Update();
+  EXPECT_TRUE(dut.last_changes().empty());
+  EXPECT_EQ(0, num_first_calls);
+
+  dut.change_phase_ = true;
+  dut.Update();
+  EXPECT_EQ(1u, dut.last_changes().phases.size());
+  EXPECT_EQ(1, num_first_calls);
+  EXPECT_EQ(1, num_second_calls);
+
+  dut.Unsubscribe(first_id);
+  dut.Update();
+  EXPECT_EQ(1, num_first_calls);
+  EXPECT_EQ(2, num_second_calls);
+}
+
+// Callbacks can subscribe and unsubscribe, themselves included, while the changes are being published.
+TEST_F(DynamicEnvironmentHandlerTest, SubscriptionsFromCallbacks) {
+  MockDynamicEnvironmentHandler dut{timer_.get(), rn_.get()};
+  dut.change_phase_ = true;
+  int num_self_calls{0};
+  int num_later_calls{0};
+  int num_new_calls{0};
+  int self_id{-1};
+  int later_id{-1};
+  self_id = dut.Subscribe([&](const DynamicEnvironmentChanges&) {
+    ++num_self_calls;
+    dut.Unsubscribe(self_id);
+    dut.Unsubscribe(later_id);
+    dut.Subscribe([&num_new_calls](const DynamicEnvironmentChanges&) { ++num_new_calls; });
+  });
+  later_id = dut.Subscribe([&num_later_calls](const DynamicEnvironmentChanges&) { ++num_later_calls; });
+
+  // The removed subscriber is not called, and the new one starts with the next changes.
+  dut.Update();
+  EXPECT_EQ(1, num_self_calls);
+  EXPECT_EQ(0, num_later_calls);
+  EXPECT_EQ(0, num_new_calls);
+
+  dut.Update();
+  EXPECT_EQ(1, num_self_calls);
+  EXPECT_EQ(0, num_later_calls);
+  EXPECT_EQ(1, num_new_calls);
+}
+
 }  // namespace
 }  // namespace integration
 }  // namespace maliput
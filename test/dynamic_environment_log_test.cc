@@ -0,0 +1,210 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_log.h"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::BulbState;
+using api::rules::Phase;
+using api::rules::PhaseProvider;
+using api::rules::PhaseRing;
+using api::rules::Rule;
+using api::rules::UniqueBulbId;
+
+class DynamicEnvironmentLogTest : public ::testing::Test {
+ public:
+  using DiscreteValueRuleState = DynamicEnvironmentRecord::RuleState<std::string>;
+  using RangeValueRuleState = DynamicEnvironmentRecord::RuleState<std::pair<double, double>>;
+
+  // @returns A log header with @p version and @p byte_order.
+  static std::string MakeHeader(uint32_t version, uint32_t byte_order) {
+    std::string header("MDEL");
+    header.append(reinterpret_cast<const char*>(&version), sizeof(version));
+    header.append(reinterpret_cast<const char*>(&byte_order), sizeof(byte_order));
+    return header;
+  }
+
+  // @returns A record of @p type at @p time.
+  DynamicEnvironmentRecord MakeRecord(DynamicEnvironmentRecord::Type type, double time) const {
+    DynamicEnvironmentRecord record;
+    record.type = type;
+    record.time = time;
+    record.phases.emplace_back(kPhaseRing, PhaseProvider::Result{kGo, PhaseProvider::Result::Next{kStop, 2.5}});
+    record.phases.emplace_back(PhaseRing::Id("OtherRing"), PhaseProvider::Result{kStop, std::nullopt});
+    record.phases.emplace_back(PhaseRing::Id("ThirdRing"),
+                               PhaseProvider::Result{kStop, PhaseProvider::Result::Next{kGo, std::nullopt}});
+    record.discrete_value_rule_states.emplace_back(kRule, DiscreteValueRuleState{"Go", "Stop", 3.});
+    record.discrete_value_rule_states.emplace_back(Rule::Id("Direction Usage Rule Type/Rule"),
+                                                   DiscreteValueRuleState{"Bidirectional", std::nullopt, std::nullopt});
+    record.range_value_rule_states.emplace_back(
+        Rule::Id("SpeedLimit"), RangeValueRuleState{std::make_pair(0., 13.9), std::make_pair(0., 8.3), std::nullopt});
+    record.bulb_states.emplace_back(kBulb, BulbState::kBlinking);
+    return record;
+  }
+
+  const PhaseRing::Id kPhaseRing{"Ring"};
+  const Phase::Id kGo{"Go"};
+  const Phase::Id kStop{"Stop"};
+  const Rule::Id kRule{"Right-Of-Way Rule Type/Rule"};
+  const UniqueBulbId kBulb{api::rules::TrafficLight::Id("TrafficLight"), api::rules::BulbGroup::Id("BulbGroup"),
+                           api::rules::Bulb::Id("Bulb")};
+};
+
+TEST_F(DynamicEnvironmentLogTest, RoundTrip) {
+  std::stringstream log;
+  DynamicEnvironmentLogWriter writer(&log);
+  const DynamicEnvironmentRecord keyframe = MakeRecord(DynamicEnvironmentRecord::Type::kKeyframe, 1.);
+  writer.Write(keyframe);
+  const int64_t first_record_size = writer.bytes_written();
+  writer.Write(MakeRecord(DynamicEnvironmentRecord::Type::kDelta, 2.));
+  // Strings are only logged once, so later records are smaller.
+  EXPECT_GT(first_record_size, writer.bytes_written() - first_record_size);
+  DynamicEnvironmentRecord empty;
+  empty.time = 3.;
+  writer.Write(empty);
+  EXPECT_EQ(static_cast<int64_t>(log.str().size()), writer.bytes_written());
+
+  const DynamicEnvironmentLogReader dut(&log);
+  ASSERT_EQ(3, dut.num_records());
+  EXPECT_EQ(DynamicEnvironmentRecord::Type::kKeyframe, dut.type(0));
+  EXPECT_EQ(DynamicEnvironmentRecord::Type::kDelta, dut.type(1));
+  EXPECT_EQ(2., dut.time(1));
+  const DynamicEnvironmentRecord record = dut.Read(0);
+  EXPECT_EQ(keyframe.type, record.type);
+  EXPECT_EQ(keyframe.time, record.time);
+  ASSERT_EQ(keyframe.phases.size(), record.phases.size());
+  for (size_t i = 0; i < keyframe.phases.size(); ++i) {
+    EXPECT_EQ(keyframe.phases[i].first, record.phases[i].first);
+    EXPECT_EQ(keyframe.phases[i].second.state, record.phases[i].second.state);
+    ASSERT_EQ(keyframe.phases[i].second.next.has_value(), record.phases[i].second.next.has_value());
+    if (keyframe.phases[i].second.next.has_value()) {
+      EXPECT_EQ(keyframe.phases[i].second.next->state, record.phases[i].second.next->state);
+      EXPECT_EQ(keyframe.phases[i].second.next->duration_until, record.phases[i].second.next->duration_until);
+    }
+  }
+  EXPECT_EQ(keyframe.discrete_value_rule_states, record.discrete_value_rule_states);
+  EXPECT_EQ(keyframe.range_value_rule_states, record.range_value_rule_states);
+  EXPECT_EQ(keyframe.bulb_states, record.bulb_states);
+  EXPECT_EQ(keyframe.bulb_states, dut.Read(1).bulb_states);
+  EXPECT_TRUE(dut.Read(2).phases.empty());
+  EXPECT_THROW(dut.Read(3), maliput::common::assertion_error);
+}
+
+TEST_F(DynamicEnvironmentLogTest, FindKeyframe) {
+  std::stringstream log;
+  DynamicEnvironmentLogWriter writer(&log);
+  EXPECT_EQ(-1, DynamicEnvironmentLogReader(&log).FindKeyframe(0.));
+  log.clear();
+  log.seekg(0);
+  for (int i = 0; i < 10; ++i) {
+    writer.Write(MakeRecord(
+        i % 4 == 0 ? DynamicEnvironmentRecord::Type::kKeyframe : DynamicEnvironmentRecord::Type::kDelta, 1. + i));
+  }
+  const DynamicEnvironmentLogReader dut(&log);
+  EXPECT_EQ(0, dut.FindKeyframe(0.));
+  EXPECT_EQ(0, dut.FindKeyframe(1.));
+  EXPECT_EQ(0, dut.FindKeyframe(4.5));
+  EXPECT_EQ(4, dut.FindKeyframe(5.));
+  EXPECT_EQ(8, dut.FindKeyframe(100.));
+}
+
+TEST_F(DynamicEnvironmentLogTest, Malformed) {
+  EXPECT_THROW(DynamicEnvironmentLogWriter(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentLogReader(nullptr), maliput::common::assertion_error);
+  std::stringstream bad_magic("MDEX");
+  EXPECT_THROW(DynamicEnvironmentLogReader{&bad_magic}, maliput::common::assertion_error);
+  std::stringstream no_header("MDEL");
+  EXPECT_THROW(DynamicEnvironmentLogReader{&no_header}, maliput::common::assertion_error);
+  // Unknown versions and byte orders.
+  std::stringstream bad_version(MakeHeader(kDynamicEnvironmentLogVersion + 1, kDynamicEnvironmentLogByteOrder));
+  EXPECT_THROW(DynamicEnvironmentLogReader{&bad_version}, maliput::common::assertion_error);
+  std::stringstream bad_byte_order(MakeHeader(kDynamicEnvironmentLogVersion, 0x04030201));
+  EXPECT_THROW(DynamicEnvironmentLogReader{&bad_byte_order}, maliput::common::assertion_error);
+  std::stringstream empty_log(MakeHeader(kDynamicEnvironmentLogVersion, kDynamicEnvironmentLogByteOrder));
+  EXPECT_EQ(0, DynamicEnvironmentLogReader(&empty_log).num_records());
+
+  std::stringstream log;
+  DynamicEnvironmentLogWriter writer(&log);
+  writer.Write(MakeRecord(DynamicEnvironmentRecord::Type::kKeyframe, 2.));
+  const std::string data = log.str();
+  // Truncated logs.
+  std::stringstream truncated(data.substr(0, data.size() - 1));
+  EXPECT_THROW(DynamicEnvironmentLogReader{&truncated}, maliput::common::assertion_error);
+  // Records out of time order.
+  writer.Write(MakeRecord(DynamicEnvironmentRecord::Type::kDelta, 1.));
+  EXPECT_THROW(DynamicEnvironmentLogReader{&log}, maliput::common::assertion_error);
+}
+
+// Counts that don't fit in their record are rejected before any memory is reserved for them.
+TEST_F(DynamicEnvironmentLogTest, CorruptCounts) {
+  std::string data = MakeHeader(kDynamicEnvironmentLogVersion, kDynamicEnvironmentLogByteOrder);
+  std::string payload;
+  const double time{1.};
+  const uint32_t num_phases{std::numeric_limits<uint32_t>::max()};
+  payload.append(reinterpret_cast<const char*>(&time), sizeof(time));
+  payload.append(reinterpret_cast<const char*>(&num_phases), sizeof(num_phases));
+  const uint32_t payload_size = static_cast<uint32_t>(payload.size());
+  data.push_back(static_cast<char>(DynamicEnvironmentRecord::Type::kKeyframe));
+  data.append(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+  data.append(payload);
+  std::stringstream log(data);
+  const DynamicEnvironmentLogReader dut(&log);
+  ASSERT_EQ(1, dut.num_records());
+  EXPECT_THROW(dut.Read(0), maliput::common::assertion_error);
+}
+
+TEST_F(DynamicEnvironmentLogTest, WriteErrors) {
+  std::stringstream failed_log;
+  failed_log.setstate(std::ios::badbit);
+  EXPECT_THROW(DynamicEnvironmentLogWriter{&failed_log}, maliput::common::assertion_error);
+
+  std::stringstream log;
+  DynamicEnvironmentLogWriter dut(&log);
+  EXPECT_NO_THROW(dut.Flush());
+  log.setstate(std::ios::badbit);
+  EXPECT_THROW(dut.Write(MakeRecord(DynamicEnvironmentRecord::Type::kKeyframe, 1.)), maliput::common::assertion_error);
+  EXPECT_THROW(dut.Flush(), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,272 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_replay_handler.h"
+
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/intersection.h>
+#include <maliput/api/intersection_book.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/dynamic_environment_log.h"
+#include "integration/dynamic_environment_recorder.h"
+#include "integration/phase_duration_iteration_handler.h"
+#include "integration/rule_state_schedule.h"
+#include "integration/scheduled_rule_state_handler.h"
+#include "integration/timer.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Timer whose elapsed time is set by hand.
+class ManualTimer : public Timer {
+ public:
+  void set_elapsed(double elapsed) { elapsed_ = elapsed; }
+
+ private:
+  void DoReset() override { elapsed_ = 0.; }
+  double DoElapsed() const override { return elapsed_; }
+
+  double elapsed_{0.};
+};
+
+// Records a PhaseDurationIterationHandler run on maliput_malidrive's SingleRoadPedestrianCrosswalk and replays it on
+// a second instance of the same road network.
+class DynamicEnvironmentReplayHandlerTest : public ::testing::Test {
+ public:
+  static constexpr char kYamlFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.yaml";
+  static constexpr char kXodrFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.xodr";
+  static constexpr int kNumSteps{40};
+  static constexpr double kTimeStep{0.25};
+  static constexpr int kKeyframeInterval{3};
+
+  void SetUp() override {
+    recorded_rn_ = MakeRoadNetwork();
+    replayed_rn_ = MakeRoadNetwork();
+    ASSERT_NE(recorded_rn_, nullptr);
+    ASSERT_NE(replayed_rn_, nullptr);
+
+    ManualTimer timer;
+    PhaseDurationIterationHandler handler{&timer, recorded_rn_.get(), kDefaultPhaseDuration};
+    DynamicEnvironmentRecorder recorder{&timer, recorded_rn_.get(), &handler, &log_, kKeyframeInterval};
+    for (int i = 1; i <= kNumSteps; ++i) {
+      timer.set_elapsed(i * kTimeStep);
+      handler.Update();
+      recorded_phases_.push_back(GetPhase(recorded_rn_.get()));
+    }
+    num_keyframes_ = recorder.num_keyframes();
+    num_deltas_ = recorder.num_deltas();
+    bytes_written_ = recorder.bytes_written();
+  }
+
+  std::unique_ptr<api::RoadNetwork> MakeRoadNetwork() const {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    properties.rule_registry_file = kYamlFilePath;
+    properties.road_rule_book_file = kYamlFilePath;
+    properties.traffic_light_book_file = kYamlFilePath;
+    properties.phase_ring_book_file = kYamlFilePath;
+    properties.intersection_book_file = kYamlFilePath;
+    return CreateMalidriveRoadNetwork(properties);
+  }
+
+  // @returns The current phase of the crosswalk intersection of @p rn.
+  static api::rules::Phase::Id GetPhase(api::RoadNetwork* rn) {
+    const api::Intersection* intersection =
+        rn->intersection_book()->GetIntersection(api::Intersection::Id("PedestrianCrosswalkIntersection"));
+    return intersection->Phase()->state;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kYamlFilePath{kMaliputMalidriveResourcePath + kYamlFileName};
+  const double kDefaultPhaseDuration{0.5};
+  std::unique_ptr<api::RoadNetwork> recorded_rn_;
+  std::unique_ptr<api::RoadNetwork> replayed_rn_;
+  std::stringstream log_;
+  // Phase after every step of the recorded run.
+  std::vector<api::rules::Phase::Id> recorded_phases_;
+  int num_keyframes_{};
+  int num_deltas_{};
+  int64_t bytes_written_{};
+};
+
+TEST_F(DynamicEnvironmentReplayHandlerTest, Recorder) {
+  ManualTimer timer;
+  PhaseDurationIterationHandler handler{&timer, recorded_rn_.get(), kDefaultPhaseDuration};
+  std::stringstream log;
+  EXPECT_THROW(DynamicEnvironmentRecorder(nullptr, recorded_rn_.get(), &handler, &log, 1),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentRecorder(&timer, nullptr, &handler, &log, 1), maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentRecorder(&timer, recorded_rn_.get(), nullptr, &log, 1),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentRecorder(&timer, recorded_rn_.get(), &handler, &log, 0),
+               maliput::common::assertion_error);
+  {
+    DynamicEnvironmentRecorder recorder(&timer, recorded_rn_.get(), &handler, &log, 1);
+    EXPECT_NO_THROW(recorder.Flush());
+    log.setstate(std::ios::badbit);
+    EXPECT_THROW(recorder.Flush(), maliput::common::assertion_error);
+  }
+
+  // The phases alternate every kDefaultPhaseDuration at most, so the run has several deltas.
+  EXPECT_LT(1, num_deltas_);
+  EXPECT_EQ(1 + num_deltas_ / kKeyframeInterval, num_keyframes_);
+  EXPECT_EQ(static_cast<int64_t>(log_.str().size()), bytes_written_);
+
+  DynamicEnvironmentLogReader reader(&log_);
+  ASSERT_EQ(num_keyframes_ + num_deltas_, reader.num_records());
+  EXPECT_EQ(DynamicEnvironmentRecord::Type::kKeyframe, reader.type(0));
+  EXPECT_EQ(0., reader.time(0));
+  const DynamicEnvironmentRecord keyframe = reader.Read(0);
+  ASSERT_EQ(1u, keyframe.phases.size());
+  EXPECT_EQ(GetPhase(replayed_rn_.get()), keyframe.phases[0].second.state);
+  EXPECT_FALSE(keyframe.discrete_value_rule_states.empty());
+  EXPECT_FALSE(keyframe.bulb_states.empty());
+  // Deltas carry the next phase, which replays need to keep the providers' queries consistent.
+  ASSERT_EQ(DynamicEnvironmentRecord::Type::kDelta, reader.type(1));
+  const DynamicEnvironmentRecord delta = reader.Read(1);
+  ASSERT_EQ(1u, delta.phases.size());
+  EXPECT_TRUE(delta.phases[0].second.next.has_value());
+}
+
+TEST_F(DynamicEnvironmentReplayHandlerTest, Constructor) {
+  ManualTimer timer;
+  std::stringstream empty_log;
+  EXPECT_THROW(DynamicEnvironmentReplayHandler(&timer, replayed_rn_.get(), &empty_log,
+                                               DynamicEnvironmentReplayHandler::Speed::kRealTime),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentReplayHandler(&timer, replayed_rn_.get(), nullptr,
+                                               DynamicEnvironmentReplayHandler::Speed::kRealTime),
+               maliput::common::assertion_error);
+}
+
+TEST_F(DynamicEnvironmentReplayHandlerTest, RealTime) {
+  ManualTimer timer;
+  DynamicEnvironmentReplayHandler dut(&timer, replayed_rn_.get(), &log_,
+                                      DynamicEnvironmentReplayHandler::Speed::kRealTime);
+  EXPECT_FALSE(dut.finished());
+  ASSERT_TRUE(dut.NextUpdateTime().has_value());
+  EXPECT_LT(0., dut.NextUpdateTime().value());
+  for (int i = 1; i <= kNumSteps; ++i) {
+    timer.set_elapsed(i * kTimeStep);
+    dut.Update();
+    EXPECT_EQ(recorded_phases_[i - 1], GetPhase(replayed_rn_.get())) << "At step " << i;
+    EXPECT_GE(i * kTimeStep, dut.log_time());
+  }
+  EXPECT_TRUE(dut.finished());
+  EXPECT_FALSE(dut.NextUpdateTime().has_value());
+}
+
+TEST_F(DynamicEnvironmentReplayHandlerTest, Seek) {
+  ManualTimer timer;
+  DynamicEnvironmentReplayHandler dut(&timer, replayed_rn_.get(), &log_,
+                                      DynamicEnvironmentReplayHandler::Speed::kRealTime);
+  // Seeks backwards and forwards, across keyframes.
+  for (const int step : {30, 5, 17, 40, 1}) {
+    int num_published_changes{0};
+    const int subscription_id =
+        dut.Subscribe([&num_published_changes](const DynamicEnvironmentChanges&) { ++num_published_changes; });
+    dut.Seek(step * kTimeStep);
+    dut.Unsubscribe(subscription_id);
+    EXPECT_EQ(recorded_phases_[step - 1], GetPhase(replayed_rn_.get())) << "At step " << step;
+    EXPECT_EQ(1, num_published_changes);
+    EXPECT_FALSE(dut.last_changes().phases.empty());
+  }
+
+  // Replay resumes from the last seek, relative to the current time of the timer.
+  timer.set_elapsed(10.);
+  dut.Seek(5 * kTimeStep);
+  for (int i = 6; i <= kNumSteps; ++i) {
+    timer.set_elapsed(10. + (i - 5) * kTimeStep);
+    dut.Update();
+    EXPECT_EQ(recorded_phases_[i - 1], GetPhase(replayed_rn_.get())) << "At step " << i;
+  }
+}
+
+// Rule states are recorded and replayed along with their next state.
+TEST_F(DynamicEnvironmentReplayHandlerTest, NextRuleStates) {
+  const auto rules = recorded_rn_->rulebook()->Rules();
+  ASSERT_FALSE(rules.range_value_rules.empty());
+  const api::rules::Rule::Id rule_id = rules.range_value_rules.begin()->first;
+  const api::rules::RangeValueRule::Range first = rules.range_value_rules.begin()->second.states().front();
+  const api::rules::RangeValueRule::Range last = rules.range_value_rules.begin()->second.states().back();
+  ManualTimer timer;
+  ScheduledRuleStateHandler handler(
+      &timer, recorded_rn_.get(),
+      RuleStateSchedule{std::nullopt,
+                        {RuleStateEvent{1., rule_id, std::nullopt, first.min, first.max},
+                         RuleStateEvent{3., rule_id, std::nullopt, last.min, last.max}}});
+  timer.set_elapsed(1.);
+  handler.Update();
+  // The first keyframe holds the state set by the handler and its next state.
+  std::stringstream log;
+  { const DynamicEnvironmentRecorder recorder(&timer, recorded_rn_.get(), &handler, &log, kKeyframeInterval); }
+
+  const DynamicEnvironmentReplayHandler dut(&timer, replayed_rn_.get(), &log,
+                                            DynamicEnvironmentReplayHandler::Speed::kRealTime);
+  const auto result = replayed_rn_->range_value_rule_state_provider()->GetState(rule_id);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(first, result->state);
+  ASSERT_TRUE(result->next.has_value());
+  EXPECT_EQ(last, result->next->state);
+  EXPECT_EQ(std::make_optional(2.), result->next->duration_until);
+}
+
+TEST_F(DynamicEnvironmentReplayHandlerTest, MaximumSpeed) {
+  ManualTimer timer;
+  DynamicEnvironmentReplayHandler dut(&timer, replayed_rn_.get(), &log_,
+                                      DynamicEnvironmentReplayHandler::Speed::kMaximum);
+  // Every delta is due right away, regardless of the timer.
+  int num_updates{0};
+  while (!dut.finished()) {
+    ASSERT_TRUE(dut.NextUpdateTime().has_value());
+    EXPECT_EQ(timer.Elapsed(), dut.NextUpdateTime().value());
+    dut.Update();
+    EXPECT_FALSE(dut.last_changes().empty());
+    ++num_updates;
+  }
+  EXPECT_EQ(num_deltas_, num_updates);
+  EXPECT_EQ(recorded_phases_.back(), GetPhase(replayed_rn_.get()));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,225 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_scheduler.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "integration/create_timer.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Reports a deadline every `period` seconds, or none when `period` is std::nullopt.
+class MockDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  MockDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network, std::optional<double> period)
+      : DynamicEnvironmentHandler(timer, road_network), period_(period) {}
+
+  void Update() override {
+    update_times_.push_back(timer_->Elapsed());
+    if (period_.has_value()) {
+      next_update_time_ += *period_;
+    }
+  }
+
+  std::optional<double> NextUpdateTime() const override {
+    return period_.has_value() ? std::make_optional(next_update_time_) : std::nullopt;
+  }
+
+  const std::vector<double>& update_times() const { return update_times_; }
+
+ private:
+  const std::optional<double> period_;
+  double next_update_time_{period_.value_or(0.)};
+  std::vector<double> update_times_;
+};
+
+// Applies every transition of `deadlines` that is due, reporting their deadlines.
+class TransitionsDynamicEnvironmentHandler : public DynamicEnvironmentHandler {
+ public:
+  TransitionsDynamicEnvironmentHandler(const Timer* timer, api::RoadNetwork* road_network,
+                                       std::vector<double> deadlines)
+      : DynamicEnvironmentHandler(timer, road_network), deadlines_(std::move(deadlines)) {}
+
+  void Update() override {
+    DynamicEnvironmentChanges* changes = BeginChanges();
+    for (; next_ < static_cast<int>(deadlines_.size()) && deadlines_[next_] <= changes->time; ++next_) {
+      changes->deadlines.push_back(deadlines_[next_]);
+    }
+    PublishChanges();
+  }
+
+  std::optional<double> NextUpdateTime() const override {
+    return next_ < static_cast<int>(deadlines_.size()) ? std::make_optional(deadlines_[next_]) : std::nullopt;
+  }
+
+ private:
+  const std::vector<double> deadlines_;
+  int next_{0};
+};
+
+class DynamicEnvironmentSchedulerTest : public ::testing::Test {
+ public:
+  static constexpr double kPeriod{0.05};
+  static constexpr double kPollPeriod{0.02};
+  static constexpr double kDeadlineMissTolerance{0.01};
+
+  void SetUp() override {
+    ASSERT_NE(rn_, nullptr);
+    ASSERT_NE(timer_, nullptr);
+  }
+
+  std::unique_ptr<Timer> timer_ = CreateTimer(TimerType::kChronoTimer);
+  std::unique_ptr<maliput::api::RoadNetwork> rn_ = maliput::api::test::CreateRoadNetwork();
+};
+
+TEST_F(DynamicEnvironmentSchedulerTest, Constructor) {
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), kPeriod};
+  EXPECT_THROW(DynamicEnvironmentScheduler(nullptr, &handler, kPollPeriod, kDeadlineMissTolerance),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentScheduler(timer_.get(), nullptr, kPollPeriod, kDeadlineMissTolerance),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentScheduler(timer_.get(), &handler, 0., kDeadlineMissTolerance),
+               maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentScheduler(timer_.get(), &handler, kPollPeriod, -1.), maliput::common::assertion_error);
+  EXPECT_NO_THROW(DynamicEnvironmentScheduler(timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance));
+  // Every late transition is a missed deadline by default.
+  EXPECT_EQ(0., DynamicEnvironmentScheduler(timer_.get(), &handler, kPollPeriod).stats().deadline_miss_tolerance());
+}
+
+// Updates happen at the deadlines, never before them.
+TEST_F(DynamicEnvironmentSchedulerTest, UpdatesAtDeadlines) {
+  constexpr int kNumUpdates{3};
+  timer_->Reset();
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), kPeriod};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  for (int i = 0; i < kNumUpdates; ++i) {
+    EXPECT_TRUE(dut.WaitAndUpdate(1.));
+    EXPECT_LE(0., dut.last_update_delay());
+  }
+  // Every update is recorded, and counts as a single transition as the handler doesn't report their deadlines.
+  EXPECT_EQ(kNumUpdates, dut.stats().num_updates());
+  EXPECT_EQ(kNumUpdates, dut.stats().num_transitions());
+  EXPECT_EQ(kDeadlineMissTolerance, dut.stats().deadline_miss_tolerance());
+  EXPECT_LE(dut.last_update_delay(), dut.stats().max_lateness());
+  EXPECT_LE(0., dut.stats().total_update_duration());
+  EXPECT_LE(0., dut.stats().total_loop_overhead());
+  dut.ResetStats();
+  EXPECT_EQ(0, dut.stats().num_updates());
+  ASSERT_EQ(kNumUpdates, static_cast<int>(handler.update_times().size()));
+  for (int i = 0; i < kNumUpdates; ++i) {
+    EXPECT_LE(kPeriod * (i + 1), handler.update_times()[i]);
+  }
+}
+
+// No update is done when the end time comes first.
+TEST_F(DynamicEnvironmentSchedulerTest, EndTime) {
+  timer_->Reset();
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), kPeriod};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  EXPECT_FALSE(dut.WaitAndUpdate(kPeriod / 2.));
+  EXPECT_LE(kPeriod / 2., timer_->Elapsed());
+  EXPECT_TRUE(handler.update_times().empty());
+}
+
+// Handlers without deadlines are polled.
+TEST_F(DynamicEnvironmentSchedulerTest, Polling) {
+  timer_->Reset();
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), std::nullopt};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  EXPECT_TRUE(dut.WaitAndUpdate(1.));
+  ASSERT_EQ(1, static_cast<int>(handler.update_times().size()));
+  EXPECT_LE(kPollPeriod, handler.update_times()[0]);
+  // Polls have no deadline to be late for.
+  EXPECT_EQ(1, dut.stats().num_updates());
+  EXPECT_EQ(0, dut.stats().num_transitions());
+}
+
+// Every transition applied by an update is timed against its own deadline.
+TEST_F(DynamicEnvironmentSchedulerTest, LatenessPerTransition) {
+  timer_->Reset();
+  TransitionsDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), {kPeriod, 2. * kPeriod, 3. * kPeriod}};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  // Every deadline is already due by the time of the update.
+  std::this_thread::sleep_for(std::chrono::duration<double>(3. * kPeriod + kDeadlineMissTolerance));
+  EXPECT_TRUE(dut.WaitAndUpdate(1.));
+  EXPECT_EQ(1, dut.stats().num_updates());
+  EXPECT_EQ(3, dut.stats().num_transitions());
+  // The last transition was due more recently than the first one, so it is less late.
+  EXPECT_LE(2. * kPeriod + kDeadlineMissTolerance, dut.stats().max_lateness());
+  EXPECT_GT(dut.stats().max_lateness(), dut.stats().mean_lateness());
+  EXPECT_EQ(3, dut.stats().num_missed_deadlines());
+  EXPECT_FALSE(handler.NextUpdateTime().has_value());
+}
+
+// Time spent by the caller between updates is loop overhead, and makes the next update late when it runs past its
+// deadline.
+TEST_F(DynamicEnvironmentSchedulerTest, LoopOverhead) {
+  constexpr double kCallerDuration{2. * kPeriod};
+  timer_->Reset();
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), kPeriod};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  EXPECT_TRUE(dut.WaitAndUpdate(1.));
+  std::this_thread::sleep_for(std::chrono::duration<double>(kCallerDuration));
+  // The next deadline is already due.
+  EXPECT_TRUE(dut.WaitAndUpdate(1.));
+  EXPECT_EQ(2, dut.stats().num_updates());
+  EXPECT_LE(kCallerDuration, dut.stats().max_loop_overhead());
+  EXPECT_LE(kCallerDuration - kPeriod, dut.stats().max_lateness());
+  EXPECT_LE(1, dut.stats().num_missed_deadlines());
+}
+
+TEST_F(DynamicEnvironmentSchedulerTest, Stop) {
+  timer_->Reset();
+  MockDynamicEnvironmentHandler handler{timer_.get(), rn_.get(), 100.};
+  DynamicEnvironmentScheduler dut{timer_.get(), &handler, kPollPeriod, kDeadlineMissTolerance};
+  std::thread stopper([&dut]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    dut.Stop();
+  });
+  EXPECT_FALSE(dut.WaitAndUpdate(200.));
+  stopper.join();
+  EXPECT_TRUE(handler.update_times().empty());
+  EXPECT_FALSE(dut.WaitAndUpdate(200.));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
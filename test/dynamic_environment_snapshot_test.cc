@@ -0,0 +1,220 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/dynamic_environment_snapshot.h"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/rule_registry.h>
+#include <maliput/api/rules/traffic_lights.h>
+#include <maliput/base/intersection_book.h>
+#include <maliput/base/manual_discrete_value_rule_state_provider.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/base/manual_phase_ring_book.h>
+#include <maliput/base/manual_range_value_rule_state_provider.h>
+#include <maliput/base/manual_right_of_way_rule_state_provider.h>
+#include <maliput/base/manual_rulebook.h>
+#include <maliput/base/traffic_light_book.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/vector.h>
+#include <maliput_dragway/road_geometry.h>
+
+#include "integration/fixed_phase_iteration_handler.h"
+#include "integration/phase_duration_iteration_handler.h"
+#include "integration/simulated_timer.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class DynamicEnvironmentSnapshotPublisherTest : public ::testing::Test {
+ public:
+  static constexpr char kYamlFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.yaml";
+  static constexpr char kXodrFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    properties.rule_registry_file = kYamlFilePath;
+    properties.road_rule_book_file = kYamlFilePath;
+    properties.traffic_light_book_file = kYamlFilePath;
+    properties.phase_ring_book_file = kYamlFilePath;
+    properties.intersection_book_file = kYamlFilePath;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    deh_ = std::make_unique<PhaseDurationIterationHandler>(&timer_, rn_.get(), kDefaultPhaseDuration);
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kYamlFilePath{kMaliputMalidriveResourcePath + kYamlFileName};
+  const api::rules::PhaseRing::Id kPhaseRingId{"PedestrianCrosswalkIntersection"};
+  const api::rules::Phase::Id kAllGoPhase{"AllGoPhase"};
+  const api::rules::Phase::Id kAllStopPhase{"AllStopPhase"};
+  const double kDefaultPhaseDuration{0.5};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  SimulatedTimer timer_;
+  std::unique_ptr<DynamicEnvironmentHandler> deh_;
+};
+
+TEST_F(DynamicEnvironmentSnapshotPublisherTest, Constructor) {
+  EXPECT_THROW(DynamicEnvironmentSnapshotPublisher(nullptr, deh_.get()), maliput::common::assertion_error);
+  EXPECT_THROW(DynamicEnvironmentSnapshotPublisher(rn_.get(), nullptr), maliput::common::assertion_error);
+
+  const DynamicEnvironmentSnapshotPublisher dut(rn_.get(), deh_.get());
+  const auto phase = dut.GetPhase(kPhaseRingId);
+  ASSERT_TRUE(phase.has_value());
+  EXPECT_EQ(kAllGoPhase, phase->state);
+  EXPECT_EQ(std::nullopt, dut.GetPhase(api::rules::PhaseRing::Id("UnknownPhaseRing")));
+  // Every rule of the rulebook is in the snapshot.
+  const auto rules = rn_->rulebook()->Rules();
+  for (const auto& rule : rules.discrete_value_rules) {
+    EXPECT_EQ(rn_->discrete_value_rule_state_provider()->GetState(rule.first)->state,
+              dut.GetDiscreteValueRuleState(rule.first));
+  }
+  EXPECT_EQ(rules.range_value_rules.size(), dut.Read([](const DynamicEnvironmentSnapshot& snapshot) {
+    return snapshot.range_value_rule_states.size();
+  }));
+  EXPECT_FALSE(dut.Read([](const DynamicEnvironmentSnapshot& snapshot) { return snapshot.bulb_states.empty(); }));
+}
+
+TEST_F(DynamicEnvironmentSnapshotPublisherTest, FollowsUpdates) {
+  const DynamicEnvironmentSnapshotPublisher dut(rn_.get(), deh_.get());
+  const std::optional<double> next_update_time = deh_->NextUpdateTime();
+  ASSERT_TRUE(next_update_time.has_value());
+
+  // Readers run concurrently with the updates and must always find a phase.
+  std::atomic<bool> done{false};
+  std::atomic<int> num_missing_phases{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 2; ++i) {
+    readers.emplace_back([&]() {
+      while (!done) {
+        if (!dut.GetPhase(kPhaseRingId).has_value()) {
+          ++num_missing_phases;
+        }
+      }
+    });
+  }
+  timer_.Advance(*next_update_time);
+  deh_->Update();
+  done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, num_missing_phases);
+
+  const auto phase = dut.GetPhase(kPhaseRingId);
+  ASSERT_TRUE(phase.has_value());
+  EXPECT_EQ(kAllStopPhase, phase->state);
+  EXPECT_EQ(*next_update_time, dut.Read([](const DynamicEnvironmentSnapshot& snapshot) { return snapshot.time; }));
+  for (const auto& state : deh_->last_changes().discrete_value_rule_states) {
+    EXPECT_EQ(std::optional(state.second), dut.GetDiscreteValueRuleState(state.first));
+  }
+  for (const auto& bulb_state : deh_->last_changes().bulb_states) {
+    EXPECT_EQ(std::optional(bulb_state.second), dut.GetBulbState(bulb_state.first));
+  }
+}
+
+// Each phase of the phase ring sets its own bulb, so the bulb of the previous phase must be gone after every update.
+TEST(DynamicEnvironmentSnapshotPublisherDisjointBulbsTest, UnsetsBulbsOfPreviousPhases) {
+  const api::rules::PhaseRing::Id kPhaseRingId{"Ring"};
+  const api::rules::Phase::Id kRedPhase{"Red"};
+  const api::rules::Phase::Id kGreenPhase{"Green"};
+  const api::rules::UniqueBulbId kRedBulb{api::rules::TrafficLight::Id("TrafficLight"),
+                                          api::rules::BulbGroup::Id("BulbGroup"), api::rules::Bulb::Id("Red")};
+  const api::rules::UniqueBulbId kGreenBulb{api::rules::TrafficLight::Id("TrafficLight"),
+                                            api::rules::BulbGroup::Id("BulbGroup"), api::rules::Bulb::Id("Green")};
+  const double kPhaseDuration{1.};
+
+  auto road_geometry = std::make_unique<dragway::RoadGeometry>(
+      api::RoadGeometryId{"Dragway"}, 1 /* num_lanes */, 100. /* length */, 3.7 /* lane_width */,
+      0. /* shoulder_width */, 5. /* maximum_height */, std::numeric_limits<double>::epsilon(),
+      std::numeric_limits<double>::epsilon(), maliput::math::Vector3(0, 0, 0));
+  auto rulebook = std::make_unique<ManualRulebook>();
+  auto phase_ring_book = std::make_unique<ManualPhaseRingBook>();
+  phase_ring_book->AddPhaseRing(api::rules::PhaseRing(
+      kPhaseRingId,
+      {api::rules::Phase(kRedPhase, api::rules::DiscreteValueRuleStates{},
+                         api::rules::BulbStates{{kRedBulb, api::rules::BulbState::kOn}}),
+       api::rules::Phase(kGreenPhase, api::rules::DiscreteValueRuleStates{},
+                         api::rules::BulbStates{{kGreenBulb, api::rules::BulbState::kOn}})},
+      std::unordered_map<api::rules::Phase::Id, std::vector<api::rules::PhaseRing::NextPhase>>{
+          {kRedPhase, {{kGreenPhase, kPhaseDuration}}}, {kGreenPhase, {{kRedPhase, kPhaseDuration}}}}));
+  auto phase_provider = std::make_unique<ManualPhaseProvider>();
+  phase_provider->AddPhaseRing(kPhaseRingId, kRedPhase, kGreenPhase, kPhaseDuration);
+  auto intersection_book = std::make_unique<IntersectionBook>(road_geometry.get());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  auto right_of_way_rule_state_provider = std::make_unique<ManualRightOfWayRuleStateProvider>();
+#pragma GCC diagnostic pop
+  auto discrete_value_rule_state_provider = std::make_unique<ManualDiscreteValueRuleStateProvider>(rulebook.get());
+  auto range_value_rule_state_provider = std::make_unique<ManualRangeValueRuleStateProvider>(rulebook.get());
+  api::RoadNetwork road_network(std::move(road_geometry), std::move(rulebook), std::make_unique<TrafficLightBook>(),
+                                std::move(intersection_book), std::move(phase_ring_book),
+                                std::move(right_of_way_rule_state_provider), std::move(phase_provider),
+                                std::make_unique<api::rules::RuleRegistry>(),
+                                std::move(discrete_value_rule_state_provider),
+                                std::move(range_value_rule_state_provider));
+
+  SimulatedTimer timer;
+  FixedPhaseIterationHandler handler(&timer, &road_network, kPhaseDuration);
+  const DynamicEnvironmentSnapshotPublisher dut(&road_network, &handler);
+  EXPECT_EQ(std::optional(api::rules::BulbState::kOn), dut.GetBulbState(kRedBulb));
+  EXPECT_EQ(std::nullopt, dut.GetBulbState(kGreenBulb));
+
+  timer.Advance(kPhaseDuration);
+  handler.Update();
+  ASSERT_EQ(kGreenPhase, dut.GetPhase(kPhaseRingId)->state);
+  EXPECT_EQ(std::nullopt, dut.GetBulbState(kRedBulb));
+  EXPECT_EQ(std::optional(api::rules::BulbState::kOn), dut.GetBulbState(kGreenBulb));
+
+  timer.Advance(kPhaseDuration);
+  handler.Update();
+  ASSERT_EQ(kRedPhase, dut.GetPhase(kPhaseRingId)->state);
+  EXPECT_EQ(std::optional(api::rules::BulbState::kOn), dut.GetBulbState(kRedBulb));
+  EXPECT_EQ(std::nullopt, dut.GetBulbState(kGreenBulb));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,139 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/generate_mesh.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/common/filesystem.h>
+#include <maliput/utility/generate_obj.h>
+
+#include "integration/mesh.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class GenerateMeshTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+  static constexpr char kFileRoot[] = "generate_mesh_test";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    features_.draw_elevation_bounds = false;
+    options_.scratch_dirpath = kDirpath;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kDirpath{common::Filesystem::get_cwd().get_path()};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  utility::ObjFeatures features_;
+  MeshGenerationOptions options_;
+};
+
+TEST_F(GenerateMeshTest, Throws) {
+  EXPECT_THROW(GenerateRoadMesh(nullptr, features_, options_, nullptr), maliput::common::assertion_error);
+  options_.num_chunks = 0;
+  EXPECT_THROW(GenerateRoadMesh(rn_->road_geometry(), features_, options_, nullptr), maliput::common::assertion_error);
+}
+
+// The merged mesh must not depend on the number of threads.
+TEST_F(GenerateMeshTest, Deterministic) {
+  // Every road of the T shaped road is a junction of its own.
+  ASSERT_LT(1, rn_->road_geometry()->num_junctions());
+  options_.num_chunks = 3;
+  options_.num_threads = 1;
+  MeshGenerationReport sequential_report;
+  const RoadMesh sequential = GenerateRoadMesh(rn_->road_geometry(), features_, options_, &sequential_report);
+  EXPECT_EQ(1, sequential_report.num_threads);
+  EXPECT_LT(1, sequential_report.num_chunks);
+  EXPECT_EQ(CountTriangles(sequential.mesh), sequential_report.num_triangles);
+  EXPECT_LT(0, sequential_report.num_triangles);
+  EXPECT_LE(0., sequential_report.parsing_time);
+
+  for (const int num_threads : {2, 3, 4}) {
+    options_.num_threads = num_threads;
+    MeshGenerationReport parallel_report;
+    const RoadMesh parallel = GenerateRoadMesh(rn_->road_geometry(), features_, options_, &parallel_report);
+    EXPECT_EQ(sequential_report.num_chunks, parallel_report.num_chunks);
+    EXPECT_LE(parallel_report.num_threads, num_threads);
+    EXPECT_EQ(sequential.mesh.vertices, parallel.mesh.vertices);
+    EXPECT_EQ(sequential.mesh.normals, parallel.mesh.normals);
+    EXPECT_EQ(sequential.mesh.vertex_indices, parallel.mesh.vertex_indices);
+    EXPECT_EQ(sequential.mesh.face_materials, parallel.mesh.face_materials);
+    EXPECT_EQ(sequential_report.num_triangles, parallel_report.num_triangles);
+  }
+}
+
+// The concurrent generation must yield as many triangles as maliput::utility::GenerateObjFile().
+TEST_F(GenerateMeshTest, GenerateObjFileInParallel) {
+  utility::GenerateObjFile(rn_->road_geometry(), kDirpath, kFileRoot, features_);
+  const Mesh expected = ReadObjFile(kDirpath + "/" + kFileRoot + ".obj");
+
+  const MeshGenerationReport report =
+      GenerateObjFileInParallel(rn_->road_geometry(), kDirpath, kFileRoot, features_, 2);
+  const Mesh dut = ReadObjFile(kDirpath + "/" + kFileRoot + ".obj");
+  EXPECT_EQ(CountTriangles(expected), CountTriangles(dut));
+  EXPECT_EQ(CountTriangles(dut), report.num_triangles);
+  EXPECT_EQ(expected.materials.size(), dut.materials.size());
+  EXPECT_LE(0., report.triangles_per_second());
+
+  common::Filesystem::remove_file(common::Path(kDirpath + "/" + kFileRoot + ".obj"));
+  common::Filesystem::remove_file(common::Path(kDirpath + "/" + kFileRoot + ".mtl"));
+}
+
+TEST_F(GenerateMeshTest, WriteRoadMesh) {
+  const RoadMesh road_mesh = GenerateRoadMesh(rn_->road_geometry(), features_, options_, nullptr);
+  for (const auto& format_extension : std::vector<std::pair<MeshFormat, std::string>>{
+           {MeshFormat::kObj, ".obj"}, {MeshFormat::kGlb, ".glb"}, {MeshFormat::kPly, ".ply"}}) {
+    const MeshWriteReport dut = WriteRoadMesh(road_mesh, kDirpath, kFileRoot, format_extension.first);
+    EXPECT_EQ(kDirpath + "/" + kFileRoot + format_extension.second, dut.file_path);
+    EXPECT_LT(0, dut.file_size);
+    EXPECT_LE(0., dut.write_time);
+    common::Filesystem::remove_file(common::Path(dut.file_path));
+  }
+  common::Filesystem::remove_file(common::Path(kDirpath + "/" + kFileRoot + ".mtl"));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/generate_string.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/utility/generate_string.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class GenerateStringToStreamTest : public ::testing::TestWithParam<int> {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    options_.num_threads = GetParam();
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const utility::GenerateStringOptions kStringOptions{true, true, true, true, true, true};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  StringGenerationOptions options_;
+};
+
+TEST_P(GenerateStringToStreamTest, Throws) {
+  std::ostringstream out;
+  EXPECT_THROW(GenerateStringToStream(nullptr, kStringOptions, options_, &out), maliput::common::assertion_error);
+  EXPECT_THROW(GenerateStringToStream(rn_->road_geometry(), kStringOptions, options_, nullptr),
+               maliput::common::assertion_error);
+  options_.chunks_per_thread = 0;
+  EXPECT_THROW(GenerateStringToStream(rn_->road_geometry(), kStringOptions, options_, &out),
+               maliput::common::assertion_error);
+}
+
+// The streamed description must match the one of maliput::utility::GenerateString() regardless of the number of
+// threads.
+TEST_P(GenerateStringToStreamTest, MatchesGenerateString) {
+  const std::string expected = utility::GenerateString(*rn_->road_geometry(), kStringOptions);
+  std::ostringstream out;
+  const StringGenerationReport report = GenerateStringToStream(rn_->road_geometry(), kStringOptions, options_, &out);
+  EXPECT_EQ(expected, out.str());
+  EXPECT_EQ(rn_->road_geometry()->num_junctions(), report.num_chunks);
+  EXPECT_LE(1, report.num_threads);
+  EXPECT_EQ(static_cast<int64_t>(expected.size()), report.num_characters);
+  EXPECT_LE(0., report.generation_time);
+}
+
+// Only the first chunk holds the road geometry ID.
+TEST_P(GenerateStringToStreamTest, RoadGeometryIdOnlyOnce) {
+  const utility::GenerateStringOptions string_options{false, true, false, false, false, false};
+  std::ostringstream out;
+  GenerateStringToStream(rn_->road_geometry(), string_options, options_, &out);
+  EXPECT_EQ(utility::GenerateString(*rn_->road_geometry(), string_options), out.str());
+}
+
+INSTANTIATE_TEST_CASE_P(GenerateStringToStreamTestGroup, GenerateStringToStreamTest, ::testing::Values(0, 1, 4));
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,231 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_rule_index.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/road_rulebook.h>
+#include <maliput/base/rule_registry.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::DiscreteValueRule;
+using api::rules::RangeValueRule;
+using api::rules::Rule;
+
+class LaneRuleIndexTest : public ::testing::Test {
+ public:
+  static constexpr char kYamlFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.yaml";
+  static constexpr char kXodrFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    properties.rule_registry_file = kYamlFilePath;
+    properties.road_rule_book_file = kYamlFilePath;
+    properties.traffic_light_book_file = kYamlFilePath;
+    properties.phase_ring_book_file = kYamlFilePath;
+    properties.intersection_book_file = kYamlFilePath;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+  }
+
+  // @returns The ids of the discrete value rules at @p rule_indices.
+  std::vector<Rule::Id> DiscreteValueRuleIds(const LaneRuleIndex& dut, const std::vector<int>& rule_indices) const {
+    std::vector<Rule::Id> ids;
+    for (const int rule_index : rule_indices) {
+      ids.push_back(dut.discrete_value_rule(rule_index).id());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  // @returns The ids of the range value rules at @p rule_indices.
+  std::vector<Rule::Id> RangeValueRuleIds(const LaneRuleIndex& dut, const std::vector<int>& rule_indices) const {
+    std::vector<Rule::Id> ids;
+    for (const int rule_index : rule_indices) {
+      ids.push_back(dut.range_value_rule(rule_index).id());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  // @returns The keys of @p rules.
+  template <typename RuleT>
+  static std::vector<Rule::Id> Keys(const std::map<Rule::Id, RuleT>& rules) {
+    std::vector<Rule::Id> ids;
+    for (const auto& id_rule : rules) {
+      ids.push_back(id_rule.first);
+    }
+    return ids;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kYamlFilePath{kMaliputMalidriveResourcePath + kYamlFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+};
+
+TEST_F(LaneRuleIndexTest, Constructor) {
+  EXPECT_THROW(LaneRuleIndex(nullptr), maliput::common::assertion_error);
+
+  const LaneRuleIndex dut(rn_.get());
+  const api::rules::RoadRulebook::QueryResults rules = rn_->rulebook()->Rules();
+  EXPECT_EQ(static_cast<int>(rules.discrete_value_rules.size()), dut.num_discrete_value_rules());
+  EXPECT_EQ(static_cast<int>(rules.range_value_rules.size()), dut.num_range_value_rules());
+  EXPECT_EQ(static_cast<int>(rn_->road_geometry()->ById().GetLanes().size()), dut.num_lanes());
+  for (int i = 0; i < dut.num_lanes(); ++i) {
+    EXPECT_EQ(std::make_optional(i), dut.LaneIndex(dut.lane(i)->id()));
+  }
+  EXPECT_EQ(std::nullopt, dut.LaneIndex(api::LaneId("UnknownLane")));
+  EXPECT_EQ(std::nullopt, dut.RuleTypeIndex(Rule::TypeId("UnknownRuleType")));
+  EXPECT_NE(std::nullopt, dut.RuleTypeIndex(SpeedLimitRuleTypeId()));
+}
+
+// Every query must match RoadRulebook::FindRules().
+TEST_F(LaneRuleIndexTest, MatchesRulebook) {
+  const LaneRuleIndex dut(rn_.get());
+  const double kTolerance{1e-3};
+  for (int lane_index = 0; lane_index < dut.num_lanes(); ++lane_index) {
+    const api::Lane* lane = dut.lane(lane_index);
+    const double length = lane->length();
+    for (const auto& s_range : std::vector<std::pair<double, double>>{
+             {0., length}, {0., 0.}, {length / 3., length / 2.}, {length, length / 2.}}) {
+      const api::rules::RoadRulebook::QueryResults expected = rn_->rulebook()->FindRules(
+          {api::LaneSRange(lane->id(), api::SRange(s_range.first, s_range.second))}, kTolerance);
+      std::vector<int> rule_indices;
+      dut.FindDiscreteValueRules(lane_index, s_range.first, s_range.second, kTolerance, LaneRuleIndex::kAnyType,
+                                 &rule_indices);
+      EXPECT_EQ(Keys(expected.discrete_value_rules), DiscreteValueRuleIds(dut, rule_indices));
+      rule_indices.clear();
+      dut.FindRangeValueRules(lane_index, s_range.first, s_range.second, kTolerance, LaneRuleIndex::kAnyType,
+                              &rule_indices);
+      EXPECT_EQ(Keys(expected.range_value_rules), RangeValueRuleIds(dut, rule_indices));
+    }
+  }
+}
+
+TEST_F(LaneRuleIndexTest, FindByType) {
+  const LaneRuleIndex dut(rn_.get());
+  const std::optional<int> speed_limit_type = dut.RuleTypeIndex(SpeedLimitRuleTypeId());
+  ASSERT_TRUE(speed_limit_type.has_value());
+  int num_speed_limits{0};
+  for (int lane_index = 0; lane_index < dut.num_lanes(); ++lane_index) {
+    const double length = dut.lane(lane_index)->length();
+    std::vector<int> rule_indices;
+    dut.FindRangeValueRules(lane_index, 0., length, 0., *speed_limit_type, &rule_indices);
+    num_speed_limits += static_cast<int>(rule_indices.size());
+    std::optional<int> expected_max_speed_limit;
+    for (const int rule_index : rule_indices) {
+      EXPECT_EQ(SpeedLimitRuleTypeId(), dut.range_value_rule(rule_index).type_id());
+      const auto& state = dut.range_value_rule_state(rule_index);
+      if (state.has_value() && (!expected_max_speed_limit.has_value() ||
+                                state->max < dut.range_value_rule_state(*expected_max_speed_limit)->max)) {
+        expected_max_speed_limit = rule_index;
+      }
+    }
+    EXPECT_EQ(expected_max_speed_limit, dut.FindMaxSpeedLimit(lane_index, 0., length, 0.));
+
+    rule_indices.clear();
+    dut.FindRightOfWays(lane_index, 0., length, 0., &rule_indices);
+    for (const int rule_index : rule_indices) {
+      EXPECT_EQ(RightOfWayRuleTypeId(), dut.discrete_value_rule(rule_index).type_id());
+    }
+    rule_indices.clear();
+    dut.FindDirectionUsages(lane_index, 0., length, 0., &rule_indices);
+    for (const int rule_index : rule_indices) {
+      EXPECT_EQ(DirectionUsageRuleTypeId(), dut.discrete_value_rule(rule_index).type_id());
+    }
+  }
+  EXPECT_GT(num_speed_limits, 0);
+}
+
+TEST_F(LaneRuleIndexTest, InvalidQueries) {
+  const LaneRuleIndex dut(rn_.get());
+  std::vector<int> rule_indices;
+  EXPECT_THROW(dut.FindDiscreteValueRules(-1, 0., 1., 0., LaneRuleIndex::kAnyType, &rule_indices),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindRangeValueRules(dut.num_lanes(), 0., 1., 0., LaneRuleIndex::kAnyType, &rule_indices),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindRangeValueRules(0, 0., 1., -1., LaneRuleIndex::kAnyType, &rule_indices),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindRangeValueRules(0, 0., 1., 0., LaneRuleIndex::kAnyType, nullptr),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindMaxSpeedLimit(-1, 0., 1., 0.), maliput::common::assertion_error);
+}
+
+TEST_F(LaneRuleIndexTest, UpdateStates) {
+  LaneRuleIndex dut(rn_.get());
+  ASSERT_GT(dut.num_discrete_value_rules(), 0);
+  ASSERT_GT(dut.num_range_value_rules(), 0);
+  const DiscreteValueRule& discrete_value_rule = dut.discrete_value_rule(0);
+  const RangeValueRule& range_value_rule = dut.range_value_rule(0);
+  const DiscreteValueRule::DiscreteValue discrete_value = discrete_value_rule.states().back();
+  const RangeValueRule::Range range = range_value_rule.states().back();
+
+  // From the changes reported by a handler.
+  DynamicEnvironmentChanges changes;
+  changes.discrete_value_rule_states.emplace_back(discrete_value_rule.id(), discrete_value);
+  changes.range_value_rule_states.emplace_back(range_value_rule.id(), range);
+  changes.range_value_rule_states.emplace_back(Rule::Id("UnknownRule"), range);
+  dut.UpdateStates(changes);
+  ASSERT_TRUE(dut.discrete_value_rule_state(0).has_value());
+  EXPECT_EQ(discrete_value, *dut.discrete_value_rule_state(0));
+  ASSERT_TRUE(dut.range_value_rule_state(0).has_value());
+  EXPECT_EQ(range, *dut.range_value_rule_state(0));
+
+  // From the state providers.
+  dut.UpdateStates();
+  const auto discrete_value_result = rn_->discrete_value_rule_state_provider()->GetState(discrete_value_rule.id());
+  ASSERT_TRUE(discrete_value_result.has_value());
+  EXPECT_EQ(discrete_value_result->state, *dut.discrete_value_rule_state(0));
+  const auto range_result = rn_->range_value_rule_state_provider()->GetState(range_value_rule.id());
+  ASSERT_TRUE(range_result.has_value());
+  EXPECT_EQ(range_result->state, *dut.range_value_rule_state(0));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_s_route_writer.h"
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class LaneSRouteWriterTest : public ::testing::Test {
+ public:
+  static constexpr double kLength{10.};
+
+  void SetUp() override {
+    rn_ = CreateDragwayRoadNetwork(DragwayBuildProperties{2, kLength, 3.7, 3., 5.2});
+    ASSERT_NE(rn_, nullptr);
+    const api::Segment* segment = rn_->road_geometry()->junction(0)->segment(0);
+    lane_0_ = segment->lane(0)->id();
+    lane_1_ = segment->lane(1)->id();
+    // The first route covers the whole first lane and part of the second one.
+    routes_.push_back(api::LaneSRoute({api::LaneSRange(lane_0_, {0., kLength}), api::LaneSRange(lane_1_, {2., 5.})}));
+    routes_.push_back(api::LaneSRoute({api::LaneSRange(lane_1_, {kLength, 0.})}));
+  }
+
+  std::unique_ptr<api::RoadNetwork> rn_;
+  api::LaneId lane_0_{"unset"};
+  api::LaneId lane_1_{"unset"};
+  std::vector<api::LaneSRoute> routes_;
+};
+
+TEST_F(LaneSRouteWriterTest, Throws) {
+  std::stringstream out;
+  EXPECT_THROW(WriteLaneSRoutes(routes_, nullptr, LaneSRouteFormat::kYaml, &out), maliput::common::assertion_error);
+  EXPECT_THROW(WriteLaneSRoutes(routes_, rn_->road_geometry(), LaneSRouteFormat::kYaml, nullptr),
+               maliput::common::assertion_error);
+  // A failed stream is reported.
+  out.setstate(std::ios::badbit);
+  EXPECT_THROW(WriteLaneSRoutes(routes_, rn_->road_geometry(), LaneSRouteFormat::kBinary, &out),
+               maliput::common::assertion_error);
+}
+
+TEST_F(LaneSRouteWriterTest, Yaml) {
+  std::stringstream out;
+  WriteLaneSRoutes(routes_, rn_->road_geometry(), LaneSRouteFormat::kYaml, &out);
+  const std::string expected = "Route 1 of 2:\n- Lane: " + lane_0_.string() + "\n- Lane: " + lane_1_.string() +
+                               "\n  SRange: [2, 5]\nRoute 2 of 2:\n- Lane: " + lane_1_.string() + "\n";
+  EXPECT_EQ(expected, out.str());
+}
+
+TEST_F(LaneSRouteWriterTest, JsonLines) {
+  std::stringstream out;
+  WriteLaneSRoutes(routes_, rn_->road_geometry(), LaneSRouteFormat::kJsonLines, &out);
+  const std::string expected = "{\"route\":1,\"ranges\":[{\"lane\":\"" + lane_0_.string() + "\"},{\"lane\":\"" +
+                               lane_1_.string() + "\",\"s_range\":[2,5]}]}\n{\"route\":2,\"ranges\":[{\"lane\":\"" +
+                               lane_1_.string() + "\"}]}\n";
+  EXPECT_EQ(expected, out.str());
+}
+
+// Lane IDs are escaped as JSON strings, including control characters. Lanes out of the road geometry keep their s
+// range.
+TEST_F(LaneSRouteWriterTest, JsonLinesEscaping) {
+  const std::vector<api::LaneSRoute> routes{
+      api::LaneSRoute({api::LaneSRange(api::LaneId("a\"b\\c\n\x01\x1f"), {0., kLength})})};
+  std::stringstream out;
+  WriteLaneSRoutes(routes, rn_->road_geometry(), LaneSRouteFormat::kJsonLines, &out);
+  EXPECT_EQ("{\"route\":1,\"ranges\":[{\"lane\":\"a\\\"b\\\\c\\n\\u0001\\u001f\",\"s_range\":[0,10]}]}\n", out.str());
+}
+
+TEST_F(LaneSRouteWriterTest, Binary) {
+  std::stringstream out;
+  WriteLaneSRoutes(routes_, rn_->road_geometry(), LaneSRouteFormat::kBinary, &out);
+  const std::string buffer = out.str();
+  size_t offset{0};
+  const auto read_uint32 = [&]() {
+    uint32_t value{};
+    std::memcpy(&value, buffer.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return value;
+  };
+  const auto read_double = [&]() {
+    double value{};
+    std::memcpy(&value, buffer.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return value;
+  };
+
+  ASSERT_LE(12u, buffer.size());
+  EXPECT_EQ(0, std::memcmp(buffer.data(), kLaneSRoutesMagic, sizeof(kLaneSRoutesMagic)));
+  offset += sizeof(kLaneSRoutesMagic);
+  EXPECT_EQ(kLaneSRoutesByteOrder, read_uint32());
+  ASSERT_EQ(routes_.size(), read_uint32());
+  for (const api::LaneSRoute& route : routes_) {
+    ASSERT_EQ(route.ranges().size(), read_uint32());
+    for (const api::LaneSRange& range : route.ranges()) {
+      const uint32_t size = read_uint32();
+      ASSERT_LE(offset + size + 2 * sizeof(double), buffer.size());
+      EXPECT_EQ(range.lane_id().string(), buffer.substr(offset, size));
+      offset += size;
+      EXPECT_EQ(range.s_range().s0(), read_double());
+      EXPECT_EQ(range.s_range().s1(), read_double());
+    }
+  }
+  EXPECT_EQ(buffer.size(), offset);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,159 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_sample_table.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class LaneSampleTableTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    options_.max_position_error = 1e-2;
+    options_.max_orientation_error = 1e-2;
+    options_.max_h = 2.;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  LaneSampleTableOptions options_;
+};
+
+TEST_F(LaneSampleTableTest, Throws) {
+  const api::Lane* lane = rn_->road_geometry()->junction(0)->segment(0)->lane(0);
+  EXPECT_THROW(LaneSampleTable(nullptr, options_), maliput::common::assertion_error);
+  LaneSampleTableOptions options = options_;
+  options.max_position_error = 0.;
+  EXPECT_THROW(LaneSampleTable(lane, options), maliput::common::assertion_error);
+  options = options_;
+  options.num_lateral_samples = 1;
+  EXPECT_THROW(LaneSampleTable(lane, options), maliput::common::assertion_error);
+  options = options_;
+  options.max_h = -1.;
+  EXPECT_THROW(LaneSampleTable(lane, options), maliput::common::assertion_error);
+  options = options_;
+  options.max_s_step = options.min_s_step / 2.;
+  EXPECT_THROW(LaneSampleTable(lane, options), maliput::common::assertion_error);
+}
+
+// Every lane of the T shaped road, which includes arcs, is approximated within the requested bounds.
+TEST_F(LaneSampleTableTest, Accuracy) {
+  const api::RoadGeometry* road_geometry = rn_->road_geometry();
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        const LaneSampleTable dut(lane, options_);
+        EXPECT_EQ(lane, dut.lane());
+        EXPECT_TRUE(dut.meets_tolerance());
+        EXPECT_LE(dut.max_position_error(), options_.max_position_error);
+        EXPECT_LE(dut.max_orientation_error(), options_.max_orientation_error);
+        EXPECT_GE(dut.num_s_samples(), 2);
+        EXPECT_EQ(options_.num_lateral_samples, dut.num_lateral_samples());
+        EXPECT_LT(0u, dut.num_bytes());
+
+        // The samples at both ends of the lane and on the right segment bound are exact.
+        for (const double s : {0., lane->length()}) {
+          const api::LanePosition lane_position(s, lane->segment_bounds(s).min(), 0.);
+          EXPECT_NEAR(0., dut.ToInertialPosition(lane_position).Distance(lane->ToInertialPosition(lane_position)),
+                      1e-9);
+          EXPECT_NEAR(0., dut.GetOrientation(lane_position).Distance(lane->GetOrientation(lane_position)), 1e-6);
+        }
+        // s coordinates out of the lane are clamped.
+        EXPECT_NEAR(0., dut.ToInertialPosition({-1., 0., 0.}).Distance(dut.ToInertialPosition({0., 0., 0.})), 1e-12);
+      }
+    }
+  }
+}
+
+// A coarser bound needs fewer samples.
+TEST_F(LaneSampleTableTest, Refinement) {
+  const api::Lane* lane = rn_->road_geometry()->junction(0)->segment(0)->lane(0);
+  const LaneSampleTable fine(lane, options_);
+  LaneSampleTableOptions options = options_;
+  options.max_position_error = 10.;
+  // Larger than any angle between two rotations.
+  options.max_orientation_error = 4.;
+  const LaneSampleTable coarse(lane, options);
+  EXPECT_LE(coarse.num_s_samples(), fine.num_s_samples());
+  EXPECT_EQ(static_cast<int>(std::ceil(lane->length() / options.max_s_step)) + 1, coarse.num_s_samples());
+
+  // The refinement stops at the minimum step.
+  options = options_;
+  options.max_position_error = 1e-12;
+  options.min_s_step = options.max_s_step;
+  const LaneSampleTable limited(lane, options);
+  EXPECT_EQ(static_cast<int>(std::ceil(lane->length() / options.max_s_step)) + 1, limited.num_s_samples());
+}
+
+TEST_F(LaneSampleTableTest, MeasureLaneSampleTables) {
+  EXPECT_THROW(MeasureLaneSampleTables(nullptr, options_, 10, 0), maliput::common::assertion_error);
+  EXPECT_THROW(MeasureLaneSampleTables(rn_->road_geometry(), options_, -1, 0), maliput::common::assertion_error);
+
+  constexpr int kNumQueriesPerLane{100};
+  const LaneSampleTableReport dut = MeasureLaneSampleTables(rn_->road_geometry(), options_, kNumQueriesPerLane, 0);
+  EXPECT_EQ(static_cast<int>(rn_->road_geometry()->ById().GetLanes().size()), dut.num_lanes);
+  EXPECT_EQ(0, dut.num_lanes_over_tolerance);
+  EXPECT_LE(2 * dut.num_lanes, dut.num_s_samples);
+  EXPECT_LT(0u, dut.num_bytes);
+  EXPECT_EQ(static_cast<int64_t>(dut.num_lanes) * kNumQueriesPerLane, dut.num_queries);
+  // Random queries fall between the check points, so some slack is allowed.
+  EXPECT_LE(dut.max_position_error, 2. * options_.max_position_error);
+  EXPECT_LE(dut.max_orientation_error, 2. * options_.max_orientation_error);
+  EXPECT_LE(0., dut.build_time);
+  EXPECT_LE(0., dut.exact_query_time);
+  EXPECT_LE(0., dut.table_query_time);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
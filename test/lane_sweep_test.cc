@@ -0,0 +1,239 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_sweep.h"
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class LaneSweepTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    options_.s_step = 2.;
+    options_.num_threads = 1;
+    // Splits the lanes of the T shaped road into several tasks.
+    options_.samples_per_task = 4;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  LaneSweepOptions options_;
+};
+
+TEST_F(LaneSweepTest, Throws) {
+  EXPECT_THROW(SweepLanes(nullptr, options_, nullptr), maliput::common::assertion_error);
+  LaneSweepOptions options = options_;
+  options.s_step = 0.;
+  EXPECT_THROW(SweepLanes(rn_->road_geometry(), options, nullptr), maliput::common::assertion_error);
+  options = options_;
+  options.samples_per_task = 0;
+  EXPECT_THROW(SweepLanes(rn_->road_geometry(), options, nullptr), maliput::common::assertion_error);
+  const LaneSweep sweep;
+  EXPECT_THROW(WriteLaneSweepCsv(sweep, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(WriteLaneSweepBinary(sweep, nullptr), maliput::common::assertion_error);
+}
+
+// Every lane is sampled at the s step and at its end, and every sample matches the lane queries.
+TEST_F(LaneSweepTest, Samples) {
+  LaneSweepReport report;
+  const LaneSweep dut = SweepLanes(rn_->road_geometry(), options_, &report);
+  const int num_lanes = static_cast<int>(rn_->road_geometry()->ById().GetLanes().size());
+  ASSERT_EQ(num_lanes, static_cast<int>(dut.lane_ids.size()));
+  ASSERT_EQ(num_lanes + 1, static_cast<int>(dut.lane_offsets.size()));
+  EXPECT_EQ(options_.s_step, dut.s_step);
+  EXPECT_EQ(num_lanes, report.num_lanes);
+  EXPECT_EQ(dut.num_samples(), report.num_samples);
+  EXPECT_LT(num_lanes, report.num_tasks);
+  EXPECT_EQ(1, report.num_threads);
+  EXPECT_LE(0., report.sampling_time);
+  for (const std::vector<double>& column : dut.columns) {
+    EXPECT_EQ(dut.num_samples(), static_cast<int64_t>(column.size()));
+  }
+
+  for (int i = 0; i < num_lanes; ++i) {
+    const api::Lane* lane = rn_->road_geometry()->ById().GetLane(api::LaneId(dut.lane_ids[i]));
+    ASSERT_NE(lane, nullptr);
+    const int64_t first = dut.lane_offsets[i];
+    const int64_t last = dut.lane_offsets[i + 1];
+    EXPECT_EQ(static_cast<int64_t>(std::ceil(lane->length() / options_.s_step - 1e-9)) + 1, last - first);
+    EXPECT_EQ(0., dut.column(LaneSweepColumn::kS)[first]);
+    EXPECT_EQ(lane->length(), dut.column(LaneSweepColumn::kS)[last - 1]);
+    for (int64_t j = first; j < last; ++j) {
+      const double s = dut.column(LaneSweepColumn::kS)[j];
+      if (j + 1 < last) {
+        EXPECT_DOUBLE_EQ(static_cast<double>(j - first) * options_.s_step, s);
+      }
+      const api::LanePosition lane_position(s, 0., 0.);
+      const api::InertialPosition position = lane->ToInertialPosition(lane_position);
+      const api::Rotation rotation = lane->GetOrientation(lane_position);
+      EXPECT_EQ(position.x(), dut.column(LaneSweepColumn::kX)[j]);
+      EXPECT_EQ(position.y(), dut.column(LaneSweepColumn::kY)[j]);
+      EXPECT_EQ(position.z(), dut.column(LaneSweepColumn::kZ)[j]);
+      EXPECT_EQ(rotation.roll(), dut.column(LaneSweepColumn::kRoll)[j]);
+      EXPECT_EQ(rotation.pitch(), dut.column(LaneSweepColumn::kPitch)[j]);
+      EXPECT_EQ(rotation.yaw(), dut.column(LaneSweepColumn::kYaw)[j]);
+      EXPECT_EQ(lane->lane_bounds(s).min(), dut.column(LaneSweepColumn::kLaneBoundsMin)[j]);
+      EXPECT_EQ(lane->lane_bounds(s).max(), dut.column(LaneSweepColumn::kLaneBoundsMax)[j]);
+      EXPECT_EQ(lane->segment_bounds(s).min(), dut.column(LaneSweepColumn::kSegmentBoundsMin)[j]);
+      EXPECT_EQ(lane->segment_bounds(s).max(), dut.column(LaneSweepColumn::kSegmentBoundsMax)[j]);
+      EXPECT_EQ(lane->elevation_bounds(s, 0.).min(), dut.column(LaneSweepColumn::kElevationBoundsMin)[j]);
+      EXPECT_EQ(lane->elevation_bounds(s, 0.).max(), dut.column(LaneSweepColumn::kElevationBoundsMax)[j]);
+    }
+  }
+}
+
+// Lanes whose length is a multiple of the s step end in a single sample, even when dividing them rounds up.
+GTEST_TEST(LaneSweepMultipleTest, LengthMultipleOfStep) {
+  // 4.2 / 0.7 evaluates slightly above 6.
+  const double kLength{4.2};
+  const std::unique_ptr<api::RoadNetwork> rn =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{1, kLength, 3.7, 3., 5.2});
+  ASSERT_NE(rn, nullptr);
+  LaneSweepOptions options;
+  options.s_step = 0.7;
+  ASSERT_LT(6., kLength / options.s_step);
+
+  const LaneSweep dut = SweepLanes(rn->road_geometry(), options, nullptr);
+  ASSERT_EQ(7, dut.num_samples());
+  const std::vector<double>& s = dut.column(LaneSweepColumn::kS);
+  for (int64_t i = 0; i + 1 < dut.num_samples(); ++i) {
+    EXPECT_DOUBLE_EQ(static_cast<double>(i) * options.s_step, s[i]);
+  }
+  EXPECT_EQ(kLength, s.back());
+  EXPECT_LT(s[5], s[6]);
+}
+
+// The samples do not depend on the number of threads.
+TEST_F(LaneSweepTest, Threads) {
+  const LaneSweep sequential = SweepLanes(rn_->road_geometry(), options_, nullptr);
+  LaneSweepOptions options = options_;
+  options.num_threads = 4;
+  LaneSweepReport report;
+  const LaneSweep parallel = SweepLanes(rn_->road_geometry(), options, &report);
+  EXPECT_EQ(4, report.num_threads);
+  EXPECT_EQ(sequential.lane_ids, parallel.lane_ids);
+  EXPECT_EQ(sequential.lane_offsets, parallel.lane_offsets);
+  for (int i = 0; i < kNumLaneSweepColumns; ++i) {
+    EXPECT_EQ(sequential.columns[i], parallel.columns[i]);
+  }
+}
+
+TEST_F(LaneSweepTest, WriteLaneSweepCsv) {
+  const LaneSweep sweep = SweepLanes(rn_->road_geometry(), options_, nullptr);
+  std::stringstream out;
+  WriteLaneSweepCsv(sweep, &out);
+
+  std::string line;
+  ASSERT_TRUE(static_cast<bool>(std::getline(out, line)));
+  EXPECT_EQ(
+      "lane_id,s,x,y,z,roll,pitch,yaw,lane_bounds_min,lane_bounds_max,segment_bounds_min,segment_bounds_max,"
+      "elevation_bounds_min,elevation_bounds_max",
+      line);
+  int64_t num_lines{0};
+  while (std::getline(out, line)) {
+    std::stringstream fields(line);
+    std::string lane_id;
+    ASSERT_TRUE(static_cast<bool>(std::getline(fields, lane_id, ',')));
+    ASSERT_LT(num_lines, sweep.num_samples());
+    for (int i = 0; i < kNumLaneSweepColumns; ++i) {
+      std::string field;
+      ASSERT_TRUE(static_cast<bool>(std::getline(fields, field, ',')));
+      // Values are read back exactly.
+      EXPECT_EQ(sweep.columns[i][num_lines], std::stod(field));
+    }
+    ++num_lines;
+  }
+  EXPECT_EQ(sweep.num_samples(), num_lines);
+}
+
+TEST_F(LaneSweepTest, WriteLaneSweepBinary) {
+  const LaneSweep sweep = SweepLanes(rn_->road_geometry(), options_, nullptr);
+  std::stringstream out;
+  WriteLaneSweepBinary(sweep, &out);
+  const std::string buffer = out.str();
+
+  ASSERT_LE(sizeof(LaneSweepHeader), buffer.size());
+  LaneSweepHeader header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  EXPECT_EQ(0, std::memcmp(header.magic, kLaneSweepMagic, sizeof(kLaneSweepMagic)));
+  EXPECT_EQ(kLaneSweepVersion, header.version);
+  EXPECT_EQ(kLaneSweepByteOrder, header.byte_order);
+  EXPECT_EQ(sweep.lane_ids.size(), header.num_lanes);
+  EXPECT_EQ(static_cast<uint64_t>(sweep.num_samples()), header.num_samples);
+  EXPECT_EQ(static_cast<uint32_t>(kNumLaneSweepColumns), header.num_columns);
+  EXPECT_EQ(sweep.s_step, header.s_step);
+  EXPECT_EQ(0u, header.lane_offsets_offset % 8);
+  EXPECT_EQ(0u, header.columns_offset % 8);
+  EXPECT_EQ(0u, header.lane_ids_offset % 8);
+  EXPECT_EQ(buffer.size(), header.lane_ids_offset + header.lane_ids_size);
+
+  std::vector<uint64_t> lane_offsets(header.num_lanes + 1);
+  std::memcpy(lane_offsets.data(), buffer.data() + header.lane_offsets_offset, lane_offsets.size() * sizeof(uint64_t));
+  for (size_t i = 0; i < lane_offsets.size(); ++i) {
+    EXPECT_EQ(static_cast<uint64_t>(sweep.lane_offsets[i]), lane_offsets[i]);
+  }
+  for (int i = 0; i < kNumLaneSweepColumns; ++i) {
+    std::vector<double> column(header.num_samples);
+    std::memcpy(column.data(), buffer.data() + header.columns_offset + i * header.num_samples * sizeof(double),
+                column.size() * sizeof(double));
+    EXPECT_EQ(sweep.columns[i], column);
+  }
+  const char* lane_id = buffer.data() + header.lane_ids_offset;
+  for (const std::string& expected_lane_id : sweep.lane_ids) {
+    EXPECT_EQ(expected_lane_id, std::string(lane_id));
+    lane_id += expected_lane_id.size() + 1;
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
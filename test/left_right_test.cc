@@ -0,0 +1,86 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/left_right.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(LeftRightTest, ReadAndModify) {
+  LeftRight<std::vector<int>> dut(std::vector<int>{1, 2});
+  EXPECT_EQ(2u, dut.Read([](const std::vector<int>& value) { return value.size(); }));
+
+  dut.Modify([](std::vector<int>* value) { value->push_back(3); });
+  EXPECT_EQ(3u, dut.Read([](const std::vector<int>& value) { return value.size(); }));
+  // Both instances get the modification.
+  dut.Modify([](std::vector<int>* value) { value->push_back(4); });
+  EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), dut.Read([](const std::vector<int>& value) { return value; }));
+}
+
+// Readers must always see both halves of the value equal, as the writer changes them together.
+GTEST_TEST(LeftRightTest, ConcurrentReaders) {
+  constexpr int kNumReaders{4};
+  constexpr int kNumWrites{2000};
+  LeftRight<std::vector<int>> dut(std::vector<int>{0, 0});
+  std::atomic<bool> done{false};
+  std::atomic<int> num_torn_reads{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kNumReaders; ++i) {
+    readers.emplace_back([&]() {
+      while (!done) {
+        if (!dut.Read([](const std::vector<int>& value) { return value[0] == value[1]; })) {
+          ++num_torn_reads;
+        }
+      }
+    });
+  }
+  for (int i = 1; i <= kNumWrites; ++i) {
+    dut.Modify([i](std::vector<int>* value) {
+      (*value)[0] = i;
+      (*value)[1] = i;
+    });
+  }
+  done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, num_torn_reads);
+  EXPECT_EQ(kNumWrites, dut.Read([](const std::vector<int>& value) { return value[0]; }));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,210 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/mesh_cache.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/common/filesystem.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class MeshCacheTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    features_.draw_elevation_bounds = false;
+    // Starts from an empty cache.
+    std::filesystem::remove_all(kCacheDirpath);
+    ASSERT_TRUE(std::filesystem::create_directory(kCacheDirpath));
+    options_.cache_dirpath = kCacheDirpath;
+    std::filesystem::remove_all(kScratchDirpath);
+    ASSERT_TRUE(std::filesystem::create_directory(kScratchDirpath));
+    options_.scratch_dirpath = kScratchDirpath;
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(kCacheDirpath);
+    std::filesystem::remove_all(kScratchDirpath);
+  }
+
+  // @returns The number of files in @p dirpath.
+  static int CountFiles(const std::string& dirpath) {
+    int num_files{0};
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(dirpath)) {
+      num_files += entry.is_regular_file() ? 1 : 0;
+    }
+    return num_files;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kCacheDirpath{common::Filesystem::get_cwd().get_path() + "/mesh_cache_test"};
+  const std::string kScratchDirpath{common::Filesystem::get_cwd().get_path() + "/mesh_cache_test_scratch"};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  utility::ObjFeatures features_;
+  IncrementalMeshOptions options_;
+};
+
+TEST_F(MeshCacheTest, HashObjFeatures) {
+  const uint64_t dut = HashObjFeatures(features_);
+  EXPECT_EQ(dut, HashObjFeatures(features_));
+  features_.max_grid_unit *= 2.;
+  EXPECT_NE(dut, HashObjFeatures(features_));
+}
+
+TEST_F(MeshCacheTest, HashSegment) {
+  const api::Segment* segment = rn_->road_geometry()->junction(0)->segment(0);
+  const api::Segment* other_segment = rn_->road_geometry()->junction(1)->segment(0);
+  EXPECT_THROW(HashSegment(nullptr, 1.), maliput::common::assertion_error);
+  EXPECT_THROW(HashSegment(segment, 0.), maliput::common::assertion_error);
+  EXPECT_EQ(HashSegment(segment, 1.), HashSegment(segment, 1.));
+  EXPECT_NE(HashSegment(segment, 1.), HashSegment(other_segment, 1.));
+}
+
+TEST_F(MeshCacheTest, GenerateRoadMeshIncrementally) {
+  EXPECT_THROW(GenerateRoadMeshIncrementally(nullptr, features_, options_, nullptr), maliput::common::assertion_error);
+
+  // Cold cache: every unit is meshed.
+  IncrementalMeshReport cold_report;
+  const RoadMesh cold = GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &cold_report);
+  EXPECT_LT(0, cold_report.num_units);
+  EXPECT_EQ(0, cold_report.num_cache_hits);
+  EXPECT_EQ(CountTriangles(cold.mesh), cold_report.num_triangles);
+  EXPECT_LT(0, cold_report.num_triangles);
+  EXPECT_EQ(0, cold_report.num_evictions);
+  // The cache only holds a mesh per unit, and the scratch files are gone.
+  EXPECT_EQ(cold_report.num_units, CountFiles(kCacheDirpath));
+  EXPECT_EQ(0, CountFiles(kScratchDirpath));
+
+  // Warm cache: every unit is loaded and the result is the same.
+  IncrementalMeshReport warm_report;
+  const RoadMesh warm = GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &warm_report);
+  EXPECT_EQ(cold_report.num_units, warm_report.num_cache_hits);
+  EXPECT_EQ(cold.mesh.vertices, warm.mesh.vertices);
+  EXPECT_EQ(cold.mesh.normals, warm.mesh.normals);
+  EXPECT_EQ(cold.mesh.vertex_indices, warm.mesh.vertex_indices);
+  EXPECT_EQ(cold.mesh.normal_indices, warm.mesh.normal_indices);
+  EXPECT_EQ(cold.mesh.face_materials, warm.mesh.face_materials);
+  EXPECT_EQ(cold.materials.size(), warm.materials.size());
+
+  // Other mesh settings invalidate every unit.
+  features_.draw_arrows = !features_.draw_arrows;
+  IncrementalMeshReport changed_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &changed_report);
+  EXPECT_EQ(0, changed_report.num_cache_hits);
+}
+
+// Segments are keyed by the fingerprint instead of their sampled geometry.
+TEST_F(MeshCacheTest, SegmentFingerprint) {
+  std::string version{"1"};
+  options_.segment_fingerprint = [&version](const api::Segment*) { return version; };
+  IncrementalMeshReport cold_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &cold_report);
+  EXPECT_EQ(0, cold_report.num_cache_hits);
+
+  IncrementalMeshReport warm_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &warm_report);
+  EXPECT_EQ(cold_report.num_units, warm_report.num_cache_hits);
+
+  version = "2";
+  IncrementalMeshReport changed_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &changed_report);
+  EXPECT_EQ(0, changed_report.num_cache_hits);
+}
+
+// Only the most recently used meshes are kept.
+TEST_F(MeshCacheTest, Eviction) {
+  IncrementalMeshReport report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &report);
+  ASSERT_LT(1, report.num_units);
+  EXPECT_EQ(report.num_units, CountFiles(kCacheDirpath));
+
+  // Other mesh settings produce new meshes; the previous ones are evicted.
+  features_.draw_arrows = !features_.draw_arrows;
+  options_.max_cache_entries = report.num_units;
+  IncrementalMeshReport changed_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &changed_report);
+  EXPECT_EQ(report.num_units, changed_report.num_evictions);
+  EXPECT_EQ(report.num_units, CountFiles(kCacheDirpath));
+
+  // The meshes of the last run are the ones kept.
+  IncrementalMeshReport warm_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &warm_report);
+  EXPECT_EQ(report.num_units, warm_report.num_cache_hits);
+  EXPECT_EQ(0, warm_report.num_evictions);
+}
+
+// Missing cache files, e.g. evicted by another process, are meshed again.
+TEST_F(MeshCacheTest, MissingCacheFile) {
+  IncrementalMeshReport cold_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &cold_report);
+  ASSERT_LT(1, cold_report.num_units);
+  std::filesystem::remove(std::filesystem::directory_iterator(kCacheDirpath)->path());
+
+  IncrementalMeshReport warm_report;
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, &warm_report);
+  EXPECT_EQ(cold_report.num_units - 1, warm_report.num_cache_hits);
+  EXPECT_EQ(cold_report.num_units, CountFiles(kCacheDirpath));
+}
+
+// Element counts beyond the size of a cache file are rejected before allocating.
+TEST_F(MeshCacheTest, CorruptCacheFile) {
+  GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, nullptr);
+  for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(kCacheDirpath)) {
+    std::ofstream out(entry.path(), std::ios::binary | std::ios::trunc);
+    const uint64_t num_vertices{uint64_t{1} << 60};
+    out.write("MMC1", 4);
+    out.write(reinterpret_cast<const char*>(&num_vertices), sizeof(num_vertices));
+  }
+  EXPECT_THROW(GenerateRoadMeshIncrementally(rn_->road_geometry(), features_, options_, nullptr),
+               maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,194 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/mesh.h"
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Two quads that share an edge, with a material each.
+constexpr char kObj[] = R"R(# Comment.
+mtllib road.mtl
+v 0 0 0
+v 1 0 0
+v 1 1 0
+v 0 1 0
+v 2 0 0
+v 2 1 0
+vn 0 0 1
+usemtl asphalt
+f 1//1 2//1 3//1 4//1
+usemtl marker
+f 2//1 5//1 6//1 -4//-1
+)R";
+
+constexpr char kMtl[] = R"R(# Comment.
+newmtl asphalt
+Ka 0.1 0.1 0.1
+Kd 0.2 0.2 0.2
+
+newmtl marker
+Kd 0.9 0.9 0.9
+d 0.5
+)R";
+
+Mesh ParseObj(const std::string& obj) {
+  std::istringstream in(obj);
+  return ReadObj(&in);
+}
+
+GTEST_TEST(ReadObjTest, ParsesStatements) {
+  const Mesh dut = ParseObj(kObj);
+  ASSERT_EQ(6, static_cast<int>(dut.vertices.size()));
+  EXPECT_EQ(maliput::math::Vector3(2., 1., 0.), dut.vertices[5]);
+  ASSERT_EQ(1, static_cast<int>(dut.normals.size()));
+  EXPECT_EQ((std::vector<std::string>{"asphalt", "marker"}), dut.materials);
+  ASSERT_EQ(2, dut.num_faces());
+  EXPECT_EQ(4, dut.num_corners(0));
+  EXPECT_EQ(4, dut.num_corners(1));
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 1, 4, 5, 2}), dut.vertex_indices);
+  EXPECT_EQ((std::vector<int>{0, 0, 0, 0, 0, 0, 0, 0}), dut.normal_indices);
+  EXPECT_EQ((std::vector<int>{0, 1}), dut.face_materials);
+  EXPECT_EQ(4, CountTriangles(dut));
+}
+
+GTEST_TEST(ReadObjTest, FaceFormats) {
+  const Mesh dut = ParseObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nvn 0 0 1\nf 1 2 3\nf 1/1 2/2 3/3\nf 1/1/1 2/2/1 3/3/1\n");
+  ASSERT_EQ(3, dut.num_faces());
+  EXPECT_EQ((std::vector<int>{-1, -1, -1, -1, -1, -1, 0, 0, 0}), dut.normal_indices);
+  EXPECT_EQ((std::vector<int>{-1, -1, -1}), dut.face_materials);
+}
+
+GTEST_TEST(ReadObjTest, Throws) {
+  EXPECT_THROW(ReadObj(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(ParseObj("v 0 0 0\nf 1 2 3\n"), maliput::common::assertion_error);
+  EXPECT_THROW(ParseObj("v 0 0 0\nv 1 0 0\nf 1 2\n"), maliput::common::assertion_error);
+}
+
+GTEST_TEST(WriteObjTest, RoundTrip) {
+  const Mesh mesh = ParseObj(kObj);
+  std::ostringstream out;
+  WriteObj(mesh, "road.mtl", &out);
+  EXPECT_EQ(0u, out.str().find("mtllib road.mtl\n"));
+  const Mesh dut = ParseObj(out.str());
+  EXPECT_EQ(mesh.vertices, dut.vertices);
+  EXPECT_EQ(mesh.normals, dut.normals);
+  EXPECT_EQ(mesh.materials, dut.materials);
+  EXPECT_EQ(mesh.face_offsets, dut.face_offsets);
+  EXPECT_EQ(mesh.vertex_indices, dut.vertex_indices);
+  EXPECT_EQ(mesh.normal_indices, dut.normal_indices);
+  EXPECT_EQ(mesh.face_materials, dut.face_materials);
+}
+
+// Faces without material that follow faces with one don't inherit it.
+GTEST_TEST(WriteObjTest, ResetsMaterial) {
+  const Mesh mesh = ParseObj(
+      "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\nusemtl asphalt\nf 1 2 3\nusemtl\nf 1 2 3\nusemtl asphalt\nf 1 2 3\n");
+  ASSERT_EQ((std::vector<int>{-1, 0, -1, 0}), mesh.face_materials);
+  std::ostringstream out;
+  WriteObj(mesh, "", &out);
+  EXPECT_NE(std::string::npos, out.str().find("usemtl asphalt\nf 1 2 3\nusemtl\nf 1 2 3\nusemtl asphalt\n"));
+  const Mesh dut = ParseObj(out.str());
+  EXPECT_EQ(mesh.materials, dut.materials);
+  EXPECT_EQ(mesh.face_materials, dut.face_materials);
+}
+
+GTEST_TEST(MtlTest, RoundTrip) {
+  std::istringstream in(kMtl);
+  const MaterialLibrary materials = ReadMtl(&in);
+  ASSERT_EQ(2, static_cast<int>(materials.size()));
+  EXPECT_EQ("asphalt", materials[0].name);
+  EXPECT_EQ((std::vector<std::string>{"Ka 0.1 0.1 0.1", "Kd 0.2 0.2 0.2"}), materials[0].statements);
+  EXPECT_EQ("marker", materials[1].name);
+  EXPECT_EQ((std::vector<std::string>{"Kd 0.9 0.9 0.9", "d 0.5"}), materials[1].statements);
+
+  std::ostringstream out;
+  WriteMtl(materials, &out);
+  std::istringstream written(out.str());
+  const MaterialLibrary dut = ReadMtl(&written);
+  ASSERT_EQ(materials.size(), dut.size());
+  for (size_t i = 0; i < dut.size(); ++i) {
+    EXPECT_EQ(materials[i].name, dut[i].name);
+    EXPECT_EQ(materials[i].statements, dut[i].statements);
+  }
+}
+
+GTEST_TEST(AppendMaterialsTest, SkipsKnownNames) {
+  MaterialLibrary dut{{"asphalt", {"Kd 0.2 0.2 0.2"}}};
+  AppendMaterials({{"asphalt", {"Kd 1 1 1"}}, {"marker", {"d 0.5"}}}, &dut);
+  ASSERT_EQ(2, static_cast<int>(dut.size()));
+  EXPECT_EQ((std::vector<std::string>{"Kd 0.2 0.2 0.2"}), dut[0].statements);
+  EXPECT_EQ("marker", dut[1].name);
+  EXPECT_THROW(AppendMaterials({}, nullptr), maliput::common::assertion_error);
+}
+
+GTEST_TEST(MeshMergerTest, SharesVerticesAndMaterials) {
+  // Splits kObj into two meshes of one face each.
+  const Mesh first = ParseObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvn 0 0 1\nusemtl asphalt\nf 1//1 2//1 3//1 4//1\n");
+  const Mesh second = ParseObj("v 1 0 0\nv 2 0 0\nv 2 1 0\nv 1 1 0\nvn 0 0 1\nusemtl marker\nf 1//1 2//1 3//1 4//1\n");
+  MeshMerger dut;
+  dut.Append(first);
+  dut.Append(second);
+  const Mesh& merged = dut.mesh();
+  const Mesh expected = ParseObj(kObj);
+  EXPECT_EQ(expected.vertices, merged.vertices);
+  EXPECT_EQ(expected.normals, merged.normals);
+  EXPECT_EQ(expected.materials, merged.materials);
+  EXPECT_EQ(expected.face_offsets, merged.face_offsets);
+  EXPECT_EQ(expected.vertex_indices, merged.vertex_indices);
+  EXPECT_EQ(expected.face_materials, merged.face_materials);
+
+  const Mesh released = dut.Release();
+  EXPECT_EQ(2, released.num_faces());
+  EXPECT_EQ(0, dut.mesh().num_faces());
+}
+
+GTEST_TEST(ExtractFacesTest, KeepsUsedElements) {
+  const Mesh mesh = ParseObj(kObj);
+  const Mesh dut = ExtractFaces(mesh, {1});
+  ASSERT_EQ(1, dut.num_faces());
+  EXPECT_EQ((std::vector<maliput::math::Vector3>{{1., 0., 0.}, {2., 0., 0.}, {2., 1., 0.}, {1., 1., 0.}}),
+            dut.vertices);
+  EXPECT_EQ(1, static_cast<int>(dut.normals.size()));
+  EXPECT_EQ((std::vector<std::string>{"marker"}), dut.materials);
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), dut.vertex_indices);
+  EXPECT_EQ((std::vector<int>{0}), dut.face_materials);
+  EXPECT_EQ(0, ExtractFaces(mesh, {}).num_faces());
+  EXPECT_THROW(ExtractFaces(mesh, {2}), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,164 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/parallel_for.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(ResolveNumberOfThreadsTest, ResolveNumberOfThreads) {
+  EXPECT_EQ(3, ResolveNumberOfThreads(3));
+  EXPECT_LE(1, ResolveNumberOfThreads(0));
+  EXPECT_LE(1, ResolveNumberOfThreads(-1));
+}
+
+class ParallelForTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(ParallelForTest, RunsEveryTaskOnce) {
+  constexpr int kNumTasks{100};
+  std::vector<std::atomic<int>> runs(kNumTasks);
+  ParallelFor(kNumTasks, GetParam(), [&runs](int i) { ++runs[i]; });
+  for (const std::atomic<int>& run : runs) {
+    EXPECT_EQ(1, run);
+  }
+}
+
+TEST_P(ParallelForTest, RethrowsExceptions) {
+  constexpr int kNumTasks{100};
+  constexpr int kFailingTask{42};
+  EXPECT_THROW(ParallelFor(kNumTasks, GetParam(),
+                           [](int i) {
+                             if (i == kFailingTask) {
+                               throw std::runtime_error("Failure");
+                             }
+                           }),
+               std::runtime_error);
+}
+
+TEST_P(ParallelForTest, NoTasks) {
+  bool called{false};
+  ParallelFor(0, GetParam(), [&called](int) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+INSTANTIATE_TEST_CASE_P(ParallelForTestGroup, ParallelForTest, ::testing::Values(0, 1, 4));
+
+GTEST_TEST(ParallelForSequentialTest, SingleThreadRunsInCallingThread) {
+  const std::thread::id caller = std::this_thread::get_id();
+  std::vector<int> order;
+  ParallelFor(5, 1, [&](int i) {
+    EXPECT_EQ(caller, std::this_thread::get_id());
+    order.push_back(i);
+  });
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4}), order);
+}
+
+class OrderedParallelForTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(OrderedParallelForTest, ConsumesInOrder) {
+  constexpr int kNumTasks{100};
+  constexpr int kMaxPendingTasks{3};
+  std::vector<int> slots(kMaxPendingTasks, -1);
+  std::atomic<int> num_consumed{0};
+  std::vector<int> order;
+  OrderedParallelFor(
+      kNumTasks, GetParam(), kMaxPendingTasks,
+      [&](int i) {
+        // A task never starts while its slot holds a result that was not consumed yet.
+        EXPECT_LE(i - kMaxPendingTasks, num_consumed.load() - 1);
+        slots[i % kMaxPendingTasks] = i;
+      },
+      [&](int i) {
+        EXPECT_EQ(i, slots[i % kMaxPendingTasks]);
+        order.push_back(i);
+        ++num_consumed;
+        return true;
+      });
+  ASSERT_EQ(kNumTasks, static_cast<int>(order.size()));
+  for (int i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+TEST_P(OrderedParallelForTest, StopsWhenConsumeReturnsFalse) {
+  constexpr int kNumTasks{100};
+  constexpr int kLastTask{10};
+  std::vector<int> order;
+  OrderedParallelFor(
+      kNumTasks, GetParam(), 2, [](int) {},
+      [&](int i) {
+        order.push_back(i);
+        return i < kLastTask;
+      });
+  EXPECT_EQ(kLastTask + 1, static_cast<int>(order.size()));
+}
+
+TEST_P(OrderedParallelForTest, RethrowsExceptions) {
+  constexpr int kNumTasks{100};
+  constexpr int kFailingTask{42};
+  EXPECT_THROW(OrderedParallelFor(
+                   kNumTasks, GetParam(), 4,
+                   [](int i) {
+                     if (i == kFailingTask) {
+                       throw std::runtime_error("Failure");
+                     }
+                   },
+                   [](int) { return true; }),
+               std::runtime_error);
+  EXPECT_THROW(OrderedParallelFor(
+                   kNumTasks, GetParam(), 4, [](int) {},
+                   [](int i) {
+                     if (i == kFailingTask) {
+                       throw std::runtime_error("Failure");
+                     }
+                     return true;
+                   }),
+               std::runtime_error);
+}
+
+TEST_P(OrderedParallelForTest, Throws) {
+  EXPECT_THROW(OrderedParallelFor(
+                   1, GetParam(), 0, [](int) {}, [](int) { return true; }),
+               maliput::common::assertion_error);
+}
+
+INSTANTIATE_TEST_CASE_P(OrderedParallelForTestGroup, OrderedParallelForTest, ::testing::Values(0, 1, 4));
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,153 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_duration_iteration_handler.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/intersection.h>
+#include <maliput/api/intersection_book.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring_book.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/timer.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Timer whose elapsed time is set by hand.
+class ManualTimer : public Timer {
+ public:
+  void set_elapsed(double elapsed) { elapsed_ = elapsed; }
+
+ private:
+  void DoReset() override { elapsed_ = 0.; }
+  double DoElapsed() const override { return elapsed_; }
+
+  double elapsed_{0.};
+};
+
+// Uses maliput_malidrive's SingleRoadPedestrianCrosswalk phase rings to evaluate the PhaseDurationIterationHandler
+// implementation.
+class PhaseDurationIterationHandlerTest : public ::testing::Test {
+ public:
+  static constexpr char kYamlFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.yaml";
+  static constexpr char kXodrFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    properties.rule_registry_file = kYamlFilePath;
+    properties.road_rule_book_file = kYamlFilePath;
+    properties.traffic_light_book_file = kYamlFilePath;
+    properties.phase_ring_book_file = kYamlFilePath;
+    properties.intersection_book_file = kYamlFilePath;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kYamlFilePath{kMaliputMalidriveResourcePath + kYamlFileName};
+  const double kDefaultPhaseDuration{0.5};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  ManualTimer timer_;
+};
+
+TEST_F(PhaseDurationIterationHandlerTest, Constructor) {
+  EXPECT_THROW(PhaseDurationIterationHandler(&timer_, rn_.get(), 0.), maliput::common::assertion_error);
+  EXPECT_NO_THROW(PhaseDurationIterationHandler(&timer_, rn_.get(), kDefaultPhaseDuration));
+}
+
+TEST_F(PhaseDurationIterationHandlerTest, VerifyPhasesBeingIterated) {
+  const maliput::api::rules::Phase::Id kAllGoPhase{"AllGoPhase"};
+  const maliput::api::rules::Phase::Id kAllStopPhase{"AllStopPhase"};
+
+  // Obtains the intersection to be used for the analysis.
+  maliput::api::IntersectionBook* intersection_book = rn_->intersection_book();
+  ASSERT_NE(intersection_book, nullptr);
+  const maliput::api::Intersection* intersection =
+      intersection_book->GetIntersection(maliput::api::Intersection::Id("PedestrianCrosswalkIntersection"));
+  ASSERT_NE(intersection, nullptr);
+
+  // According to the IntersectionBook yaml file the initial phase is: AllGoPhase.
+  EXPECT_EQ(kAllGoPhase, intersection->Phase()->state);
+  // The first phase lasts its `duration_until`, if any.
+  ASSERT_TRUE(intersection->Phase()->next.has_value());
+  const std::optional<double> duration_until = intersection->Phase()->next->duration_until;
+  const double kFirstDeadline{duration_until.has_value() && *duration_until > 0. ? *duration_until
+                                                                                 : kDefaultPhaseDuration};
+
+  timer_.set_elapsed(0.);
+  PhaseDurationIterationHandler dut{&timer_, rn_.get(), kDefaultPhaseDuration};
+  ASSERT_TRUE(dut.NextUpdateTime().has_value());
+  EXPECT_EQ(kFirstDeadline, dut.NextUpdateTime().value());
+
+  // Nothing changes before the deadline.
+  timer_.set_elapsed(kFirstDeadline / 2.);
+  dut.Update();
+  EXPECT_EQ(kAllGoPhase, intersection->Phase()->state);
+  EXPECT_EQ(kFirstDeadline, dut.NextUpdateTime().value());
+  EXPECT_TRUE(dut.last_changes().empty());
+
+  // The phase ring advances at its deadline and gets a later one.
+  int num_published_changes{0};
+  dut.Subscribe([&num_published_changes](const DynamicEnvironmentChanges&) { ++num_published_changes; });
+  timer_.set_elapsed(kFirstDeadline);
+  dut.Update();
+  EXPECT_EQ(kAllStopPhase, intersection->Phase()->state);
+  // Only what changed is reported.
+  EXPECT_EQ(1, num_published_changes);
+  ASSERT_EQ(1u, dut.last_changes().phases.size());
+  EXPECT_EQ(kAllStopPhase, dut.last_changes().phases[0].phase_id);
+  EXPECT_EQ(kFirstDeadline, dut.last_changes().time);
+  EXPECT_FALSE(dut.last_changes().discrete_value_rule_states.empty());
+  EXPECT_EQ(std::vector<double>{kFirstDeadline}, dut.last_changes().deadlines);
+  ASSERT_TRUE(dut.NextUpdateTime().has_value());
+  EXPECT_LT(kFirstDeadline, dut.NextUpdateTime().value());
+
+  // A late update reports the deadline the transition was due at.
+  const double kSecondDeadline = dut.NextUpdateTime().value();
+  timer_.set_elapsed(kSecondDeadline + (kSecondDeadline - kFirstDeadline) / 2.);
+  dut.Update();
+  EXPECT_EQ(kAllGoPhase, intersection->Phase()->state);
+  EXPECT_EQ(std::vector<double>{kSecondDeadline}, dut.last_changes().deadlines);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_ring_table.h"
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/base/manual_phase_ring_book.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::Phase;
+using api::rules::PhaseRing;
+
+class PhaseRingTableTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A phase ring that alternates between two phases.
+    phase_ring_book_.AddPhaseRing(
+        PhaseRing(kCyclingRing, {Phase(kGo, {}), Phase(kStop, {})},
+                  std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>>{
+                      {kGo, {{kStop, kGoDuration}}}, {kStop, {{kGo, kStopDuration}}}}));
+    phase_provider_.AddPhaseRing(kCyclingRing, kGo, kStop, kGoDuration);
+    // A phase ring whose only phase has no next phase.
+    phase_ring_book_.AddPhaseRing(PhaseRing(
+        kStaticRing, {Phase(kGo, {})}, std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>>{{kGo, {}}}));
+    phase_provider_.AddPhaseRing(kStaticRing, kGo);
+  }
+
+  const PhaseRing::Id kCyclingRing{"CyclingRing"};
+  const PhaseRing::Id kStaticRing{"StaticRing"};
+  const Phase::Id kGo{"Go"};
+  const Phase::Id kStop{"Stop"};
+  const double kGoDuration{2.};
+  const double kStopDuration{3.};
+  ManualPhaseRingBook phase_ring_book_;
+  ManualPhaseProvider phase_provider_;
+};
+
+TEST_F(PhaseRingTableTest, Constructor) {
+  EXPECT_THROW(PhaseRingTable(nullptr, &phase_provider_), maliput::common::assertion_error);
+  EXPECT_THROW(PhaseRingTable(&phase_ring_book_, nullptr), maliput::common::assertion_error);
+
+  const PhaseRingTable dut(&phase_ring_book_, &phase_provider_);
+  // Only the phase ring that has a next phase is kept.
+  ASSERT_EQ(1, dut.num_phase_rings());
+  EXPECT_EQ(kCyclingRing, dut.phase_ring_id(0));
+  EXPECT_TRUE(dut.has_next_phase(0));
+  EXPECT_EQ(std::optional<double>(kGoDuration), dut.duration_until(0));
+}
+
+TEST_F(PhaseRingTableTest, Advance) {
+  PhaseRingTable dut(&phase_ring_book_, &phase_provider_);
+  ASSERT_EQ(1, dut.num_phase_rings());
+
+  EXPECT_EQ(kGo, dut.phase_id(0));
+  EXPECT_NE(nullptr, dut.Advance(0, &phase_provider_));
+  EXPECT_EQ(kStop, dut.phase_id(0));
+  auto result = phase_provider_.GetPhase(kCyclingRing);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(kStop, result->state);
+  ASSERT_TRUE(result->next.has_value());
+  EXPECT_EQ(kGo, result->next->state);
+  EXPECT_EQ(std::optional<double>(kStopDuration), result->next->duration_until);
+  EXPECT_EQ(std::optional<double>(kStopDuration), dut.duration_until(0));
+
+  // The phase ring wraps around.
+  EXPECT_NE(nullptr, dut.Advance(0, &phase_provider_));
+  EXPECT_EQ(kGo, dut.phase_id(0));
+  result = phase_provider_.GetPhase(kCyclingRing);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(kGo, result->state);
+  ASSERT_TRUE(result->next.has_value());
+  EXPECT_EQ(kStop, result->next->state);
+  EXPECT_EQ(std::optional<double>(kGoDuration), dut.duration_until(0));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
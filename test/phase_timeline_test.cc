@@ -0,0 +1,163 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_timeline.h"
+
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/phase.h>
+#include <maliput/api/rules/phase_ring.h>
+#include <maliput/api/rules/traffic_lights.h>
+#include <maliput/base/manual_phase_provider.h>
+#include <maliput/base/manual_phase_ring_book.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::BulbState;
+using api::rules::DiscreteValueRule;
+using api::rules::Phase;
+using api::rules::PhaseRing;
+
+DiscreteValueRule::DiscreteValue MakeDiscreteValue(const std::string& value) {
+  DiscreteValueRule::DiscreteValue discrete_value;
+  discrete_value.value = value;
+  return discrete_value;
+}
+
+class PhaseTimelineTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A phase ring that alternates between two phases, starting with the first one.
+    phase_ring_book_.AddPhaseRing(PhaseRing(
+        kCyclingRing,
+        {Phase(kGo, {{kRule, MakeDiscreteValue("Go")}}, api::rules::BulbStates{{kBulb, BulbState::kOn}}),
+         Phase(kStop, {{kRule, MakeDiscreteValue("Stop")}}, api::rules::BulbStates{{kBulb, BulbState::kOff}})},
+        std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>>{{kGo, {{kStop, kGoDuration}}},
+                                                                         {kStop, {{kGo, kStopDuration}}}}));
+    phase_provider_.AddPhaseRing(kCyclingRing, kGo, kStop, kGoDuration);
+    // A phase ring that goes from a phase without duration to a phase that lasts forever.
+    phase_ring_book_.AddPhaseRing(PhaseRing(
+        kFiniteRing, {Phase(kGo, {}), Phase(kStop, {})},
+        std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>>{{kGo, {{kStop, std::nullopt}}}, {kStop, {}}}));
+    phase_provider_.AddPhaseRing(kFiniteRing, kGo, kStop, std::nullopt);
+  }
+
+  const PhaseRing::Id kCyclingRing{"CyclingRing"};
+  const PhaseRing::Id kFiniteRing{"FiniteRing"};
+  const Phase::Id kGo{"Go"};
+  const Phase::Id kStop{"Stop"};
+  const api::rules::Rule::Id kRule{"Right-Of-Way Rule Type/Rule"};
+  const api::rules::UniqueBulbId kBulb{api::rules::TrafficLight::Id("TrafficLight"),
+                                       api::rules::BulbGroup::Id("BulbGroup"), api::rules::Bulb::Id("Bulb")};
+  const double kGoDuration{2.};
+  const double kStopDuration{3.};
+  const double kDefaultPhaseDuration{10.};
+  ManualPhaseRingBook phase_ring_book_;
+  ManualPhaseProvider phase_provider_;
+};
+
+TEST_F(PhaseTimelineTest, Constructor) {
+  EXPECT_THROW(PhaseTimeline(nullptr, &phase_provider_, kDefaultPhaseDuration), maliput::common::assertion_error);
+  EXPECT_THROW(PhaseTimeline(&phase_ring_book_, nullptr, kDefaultPhaseDuration), maliput::common::assertion_error);
+  EXPECT_THROW(PhaseTimeline(&phase_ring_book_, &phase_provider_, 0.), maliput::common::assertion_error);
+
+  const PhaseTimeline dut(&phase_ring_book_, &phase_provider_, kDefaultPhaseDuration);
+  EXPECT_EQ(2, static_cast<int>(dut.GetPhaseRings().size()));
+  EXPECT_EQ(std::optional<double>(kGoDuration + kStopDuration), dut.GetPeriod(kCyclingRing));
+  EXPECT_EQ(std::nullopt, dut.GetPeriod(kFiniteRing));
+  EXPECT_THROW(dut.GetPeriod(PhaseRing::Id("UnknownRing")), maliput::common::assertion_error);
+}
+
+TEST_F(PhaseTimelineTest, CyclingPhaseRing) {
+  const PhaseTimeline dut(&phase_ring_book_, &phase_provider_, kDefaultPhaseDuration);
+  EXPECT_THROW(dut.GetInterval(kCyclingRing, -1.), maliput::common::assertion_error);
+
+  EXPECT_EQ(kGo, dut.GetPhase(kCyclingRing, 0.).id());
+  EXPECT_EQ(kGo, dut.GetPhase(kCyclingRing, 1.9).id());
+  EXPECT_EQ(kStop, dut.GetPhase(kCyclingRing, 2.).id());
+  EXPECT_EQ(kGo, dut.GetPhase(kCyclingRing, 5.).id());
+
+  // Far away times fall in the matching period.
+  const double kPeriod{kGoDuration + kStopDuration};
+  const PhaseTimeline::Interval interval = dut.GetInterval(kCyclingRing, 1000. * kPeriod + 2.5);
+  EXPECT_EQ(kStop, interval.phase->id());
+  EXPECT_DOUBLE_EQ(1000. * kPeriod + kGoDuration, interval.start_time);
+  EXPECT_DOUBLE_EQ(1001. * kPeriod, interval.end_time);
+
+  EXPECT_EQ(MakeDiscreteValue("Go"), dut.GetDiscreteValueRuleState(kCyclingRing, kRule, 86400.));
+  EXPECT_EQ(MakeDiscreteValue("Stop"), dut.GetDiscreteValueRuleState(kCyclingRing, kRule, 86402.));
+  EXPECT_EQ(std::nullopt,
+            dut.GetDiscreteValueRuleState(kCyclingRing, api::rules::Rule::Id("UnknownRule"), 86400.));
+  EXPECT_EQ(std::optional<BulbState>(BulbState::kOn), dut.GetBulbState(kCyclingRing, kBulb, 86400.));
+  EXPECT_EQ(std::optional<BulbState>(BulbState::kOff), dut.GetBulbState(kCyclingRing, kBulb, 86402.));
+}
+
+TEST_F(PhaseTimelineTest, FinitePhaseRing) {
+  const PhaseTimeline dut(&phase_ring_book_, &phase_provider_, kDefaultPhaseDuration);
+  // The first phase has no duration, so it lasts the default one.
+  EXPECT_EQ(kGo, dut.GetPhase(kFiniteRing, kDefaultPhaseDuration / 2.).id());
+  const PhaseTimeline::Interval interval = dut.GetInterval(kFiniteRing, 1e9);
+  EXPECT_EQ(kStop, interval.phase->id());
+  EXPECT_EQ(kDefaultPhaseDuration, interval.start_time);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), interval.end_time);
+  EXPECT_EQ(std::nullopt, dut.GetBulbState(kFiniteRing, kBulb, 0.));
+}
+
+TEST_F(PhaseTimelineTest, WriteCsv) {
+  const PhaseTimeline dut(&phase_ring_book_, &phase_provider_, kDefaultPhaseDuration);
+  EXPECT_THROW(dut.WriteCsv(-1., nullptr), maliput::common::assertion_error);
+
+  std::ostringstream out;
+  dut.WriteCsv(12., &out);
+  const std::string csv = out.str();
+  EXPECT_EQ(0u, csv.find("phase_ring_id,start_time,end_time,phase_id\n"));
+  for (const std::string& row :
+       {"CyclingRing,0,2,Go\n", "CyclingRing,2,5,Stop\n", "CyclingRing,5,7,Go\n", "CyclingRing,7,10,Stop\n",
+        "CyclingRing,10,12,Go\n", "FiniteRing,0,10,Go\n", "FiniteRing,10,12,Stop\n"}) {
+    EXPECT_NE(std::string::npos, csv.find(row)) << row;
+  }
+  EXPECT_EQ(std::string::npos, csv.find("CyclingRing,12,"));
+
+  std::ostringstream failed_out;
+  failed_out.setstate(std::ios::badbit);
+  EXPECT_THROW(dut.WriteCsv(12., &failed_out), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
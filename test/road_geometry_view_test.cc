@@ -0,0 +1,139 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_geometry_view.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class RoadGeometryViewTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    rg_ = rn_->road_geometry();
+    ASSERT_GT(rg_->num_junctions(), 1);
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  const api::RoadGeometry* rg_{};
+};
+
+TEST_F(RoadGeometryViewTest, Constructor) {
+  EXPECT_THROW(RoadGeometryView(nullptr, std::vector<const api::Junction*>{}, true), maliput::common::assertion_error);
+  EXPECT_THROW(RoadGeometryView(rg_, std::vector<const api::Junction*>{nullptr}, true),
+               maliput::common::assertion_error);
+}
+
+TEST_F(RoadGeometryViewTest, Delegation) {
+  const RoadGeometryView dut(rg_, std::vector<const api::Junction*>{rg_->junction(1)}, false);
+  EXPECT_EQ(rg_->id(), dut.id());
+  ASSERT_EQ(1, dut.num_junctions());
+  EXPECT_EQ(rg_->junction(1), dut.junction(0));
+  EXPECT_EQ(0, dut.num_branch_points());
+  EXPECT_EQ(rg_->linear_tolerance(), dut.linear_tolerance());
+  EXPECT_EQ(rg_->angular_tolerance(), dut.angular_tolerance());
+  EXPECT_EQ(rg_->scale_length(), dut.scale_length());
+  EXPECT_EQ(&rg_->ById(), &dut.ById());
+
+  const RoadGeometryView with_branch_points(rg_, std::vector<const api::Junction*>{}, true);
+  EXPECT_EQ(0, with_branch_points.num_junctions());
+  EXPECT_EQ(rg_->num_branch_points(), with_branch_points.num_branch_points());
+}
+
+TEST_F(RoadGeometryViewTest, SplitRoadGeometry) {
+  EXPECT_THROW(SplitRoadGeometry(nullptr, 1), maliput::common::assertion_error);
+  EXPECT_THROW(SplitRoadGeometry(rg_, 0), maliput::common::assertion_error);
+
+  for (int num_chunks : {1, 2, 100}) {
+    const std::vector<std::unique_ptr<RoadGeometryView>> dut = SplitRoadGeometry(rg_, num_chunks);
+    ASSERT_FALSE(dut.empty());
+    EXPECT_LE(static_cast<int>(dut.size()), num_chunks);
+    // Views cover every junction once and in order, and only the first one exposes the branch points.
+    int junction_index{0};
+    for (size_t i = 0; i < dut.size(); ++i) {
+      EXPECT_GT(dut[i]->num_junctions(), 0);
+      EXPECT_EQ(i == 0 ? rg_->num_branch_points() : 0, dut[i]->num_branch_points());
+      for (int j = 0; j < dut[i]->num_junctions(); ++j) {
+        EXPECT_EQ(rg_->junction(junction_index++), dut[i]->junction(j));
+      }
+    }
+    EXPECT_EQ(rg_->num_junctions(), junction_index);
+  }
+}
+
+TEST_F(RoadGeometryViewTest, JunctionView) {
+  const api::Junction* junction = rg_->junction(0);
+  EXPECT_THROW(JunctionView(nullptr, {}), maliput::common::assertion_error);
+  EXPECT_THROW(JunctionView(junction, {nullptr}), maliput::common::assertion_error);
+
+  const JunctionView dut(junction, {junction->segment(0)});
+  EXPECT_EQ(junction->id(), dut.id());
+  EXPECT_EQ(rg_, dut.road_geometry());
+  ASSERT_EQ(1, dut.num_segments());
+  EXPECT_EQ(junction->segment(0), dut.segment(0));
+}
+
+TEST_F(RoadGeometryViewTest, MakeSegmentView) {
+  const api::Segment* segment = rg_->junction(1)->segment(0);
+  EXPECT_THROW(MakeSegmentView(nullptr, segment), maliput::common::assertion_error);
+  EXPECT_THROW(MakeSegmentView(rg_, nullptr), maliput::common::assertion_error);
+
+  const std::unique_ptr<RoadGeometryView> dut = MakeSegmentView(rg_, segment);
+  EXPECT_EQ(rg_->id(), dut->id());
+  EXPECT_EQ(0, dut->num_branch_points());
+  ASSERT_EQ(1, dut->num_junctions());
+  EXPECT_EQ(rg_->junction(1)->id(), dut->junction(0)->id());
+  ASSERT_EQ(1, dut->junction(0)->num_segments());
+  EXPECT_EQ(segment, dut->junction(0)->segment(0));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
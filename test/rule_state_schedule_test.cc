@@ -0,0 +1,108 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/rule_state_schedule.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+TEST(LoadRuleStateScheduleTest, Load) {
+  const std::string kSchedule = R"R(
+RuleStateSchedule:
+  period: 86400
+  events:
+    - time: 25200
+      rule: "Direction-Usage Rule Type/1_0_1"
+      value: "WithS"
+    - time: 32400
+      rule: "Speed-Limit Rule Type/1_0_1"
+      range: [0., 16.7]
+)R";
+  const RuleStateSchedule dut = LoadRuleStateSchedule(kSchedule);
+  ASSERT_TRUE(dut.period.has_value());
+  EXPECT_EQ(86400., *dut.period);
+  ASSERT_EQ(2u, dut.events.size());
+  EXPECT_EQ(25200., dut.events[0].time);
+  EXPECT_EQ(api::rules::Rule::Id("Direction-Usage Rule Type/1_0_1"), dut.events[0].rule_id);
+  EXPECT_EQ(std::make_optional<std::string>("WithS"), dut.events[0].value);
+  EXPECT_FALSE(dut.events[0].min.has_value());
+  EXPECT_FALSE(dut.events[0].max.has_value());
+  EXPECT_EQ(32400., dut.events[1].time);
+  EXPECT_EQ(api::rules::Rule::Id("Speed-Limit Rule Type/1_0_1"), dut.events[1].rule_id);
+  EXPECT_FALSE(dut.events[1].value.has_value());
+  EXPECT_EQ(std::make_optional(0.), dut.events[1].min);
+  EXPECT_EQ(std::make_optional(16.7), dut.events[1].max);
+}
+
+TEST(LoadRuleStateScheduleTest, NoPeriod) {
+  const RuleStateSchedule dut = LoadRuleStateSchedule(R"R(
+RuleStateSchedule:
+  events:
+    - {time: 1, rule: "Rule", value: "Go"}
+)R");
+  EXPECT_FALSE(dut.period.has_value());
+  EXPECT_EQ(1u, dut.events.size());
+  EXPECT_TRUE(LoadRuleStateSchedule("RuleStateSchedule: {}").events.empty());
+}
+
+TEST(LoadRuleStateScheduleTest, Malformed) {
+  const auto load = [](const std::string& events) {
+    return LoadRuleStateSchedule("RuleStateSchedule:\n  period: 10\n  events:\n" + events);
+  };
+  EXPECT_THROW(LoadRuleStateSchedule("Schedule: {}"), maliput::common::assertion_error);
+  EXPECT_THROW(LoadRuleStateSchedule("RuleStateSchedule: {period: 0}"), maliput::common::assertion_error);
+  // Invalid YAML.
+  EXPECT_THROW(LoadRuleStateSchedule("RuleStateSchedule: {events: [{"), maliput::common::assertion_error);
+  // Missing time or rule.
+  EXPECT_THROW(load("    - {rule: Rule, value: Go}"), maliput::common::assertion_error);
+  EXPECT_THROW(load("    - {time: 1, value: Go}"), maliput::common::assertion_error);
+  // Both or none of value and range.
+  EXPECT_THROW(load("    - {time: 1, rule: Rule}"), maliput::common::assertion_error);
+  EXPECT_THROW(load("    - {time: 1, rule: Rule, value: Go, range: [0, 1]}"), maliput::common::assertion_error);
+  // Malformed range.
+  EXPECT_THROW(load("    - {time: 1, rule: Rule, range: [0]}"), maliput::common::assertion_error);
+  EXPECT_THROW(load("    - {time: 1, rule: Rule, range: [0, fast]}"), maliput::common::assertion_error);
+  // Times out of range.
+  EXPECT_THROW(load("    - {time: -1, rule: Rule, value: Go}"), maliput::common::assertion_error);
+  EXPECT_THROW(load("    - {time: 10, rule: Rule, value: Go}"), maliput::common::assertion_error);
+}
+
+TEST(LoadRuleStateScheduleTest, FromFile) {
+  EXPECT_THROW(LoadRuleStateScheduleFromFile("/nonexistent/schedule.yaml"), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,198 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/scheduled_rule_state_handler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/simulated_timer.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::rules::RangeValueRule;
+using api::rules::Rule;
+
+class ScheduledRuleStateHandlerTest : public ::testing::Test {
+ public:
+  static constexpr char kYamlFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.yaml";
+  static constexpr char kXodrFileName[] = "/resources/odr/SingleRoadPedestrianCrosswalk.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    properties.rule_registry_file = kYamlFilePath;
+    properties.road_rule_book_file = kYamlFilePath;
+    properties.traffic_light_book_file = kYamlFilePath;
+    properties.phase_ring_book_file = kYamlFilePath;
+    properties.intersection_book_file = kYamlFilePath;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    const auto rules = rn_->rulebook()->Rules();
+    ASSERT_FALSE(rules.range_value_rules.empty());
+    ASSERT_FALSE(rules.discrete_value_rules.empty());
+    // Speed limits are range value rules.
+    range_rule_id_ = rules.range_value_rules.begin()->first;
+    first_range_ = rules.range_value_rules.begin()->second.states().front();
+    last_range_ = rules.range_value_rules.begin()->second.states().back();
+    discrete_rule_id_ = rules.discrete_value_rules.begin()->first;
+  }
+
+  // @returns An event that sets the range value rule to @p range at @p time.
+  RuleStateEvent RangeEvent(double time, const RangeValueRule::Range& range) const {
+    return RuleStateEvent{time, range_rule_id_, std::nullopt, range.min, range.max};
+  }
+
+  // @returns The current state of the range value rule.
+  RangeValueRule::Range GetRangeState() const {
+    const auto result = rn_->range_value_rule_state_provider()->GetState(range_rule_id_);
+    EXPECT_TRUE(result.has_value());
+    return result->state;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kYamlFilePath{kMaliputMalidriveResourcePath + kYamlFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  SimulatedTimer timer_;
+  Rule::Id range_rule_id_{"none"};
+  Rule::Id discrete_rule_id_{"none"};
+  RangeValueRule::Range first_range_;
+  RangeValueRule::Range last_range_;
+};
+
+TEST_F(ScheduledRuleStateHandlerTest, Constructor) {
+  EXPECT_NO_THROW(ScheduledRuleStateHandler(&timer_, rn_.get(), RuleStateSchedule{}));
+  EXPECT_THROW(ScheduledRuleStateHandler(nullptr, rn_.get(), RuleStateSchedule{}), maliput::common::assertion_error);
+  EXPECT_THROW(ScheduledRuleStateHandler(&timer_, nullptr, RuleStateSchedule{}), maliput::common::assertion_error);
+  // States that the rule doesn't have.
+  const RuleStateEvent unknown_value{1., discrete_rule_id_, "UnknownValue", std::nullopt, std::nullopt};
+  EXPECT_THROW(ScheduledRuleStateHandler(&timer_, rn_.get(), RuleStateSchedule{std::nullopt, {unknown_value}}),
+               maliput::common::assertion_error);
+  const RuleStateEvent unknown_range{1., range_rule_id_, std::nullopt, -1., -1.};
+  EXPECT_THROW(ScheduledRuleStateHandler(&timer_, rn_.get(), RuleStateSchedule{std::nullopt, {unknown_range}}),
+               maliput::common::assertion_error);
+  // Two events of the same rule at the same time.
+  EXPECT_THROW(ScheduledRuleStateHandler(&timer_, rn_.get(),
+                                         RuleStateSchedule{std::nullopt, {RangeEvent(1., first_range_),
+                                                                          RangeEvent(1., last_range_)}}),
+               maliput::common::assertion_error);
+  // Events out of the period.
+  EXPECT_THROW(ScheduledRuleStateHandler(&timer_, rn_.get(), RuleStateSchedule{2., {RangeEvent(2., first_range_)}}),
+               maliput::common::assertion_error);
+}
+
+TEST_F(ScheduledRuleStateHandlerTest, AppliesDueEvents) {
+  const RangeValueRule::Range initial_range = GetRangeState();
+  // Events are given out of order.
+  ScheduledRuleStateHandler dut(
+      &timer_, rn_.get(), RuleStateSchedule{std::nullopt, {RangeEvent(3., last_range_), RangeEvent(1., first_range_)}});
+  int num_changes{0};
+  dut.Subscribe([&num_changes](const DynamicEnvironmentChanges&) { ++num_changes; });
+  EXPECT_EQ(std::make_optional(1.), dut.NextUpdateTime());
+
+  // Nothing is due yet.
+  timer_.Advance(0.5);
+  dut.Update();
+  EXPECT_EQ(initial_range, GetRangeState());
+  EXPECT_TRUE(dut.last_changes().empty());
+
+  timer_.Advance(0.5);
+  dut.Update();
+  const auto result = rn_->range_value_rule_state_provider()->GetState(range_rule_id_);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(first_range_, result->state);
+  ASSERT_TRUE(result->next.has_value());
+  EXPECT_EQ(last_range_, result->next->state);
+  EXPECT_EQ(std::make_optional(2.), result->next->duration_until);
+  // Only actual changes are reported.
+  EXPECT_EQ(initial_range == first_range_ ? 0u : 1u, dut.last_changes().range_value_rule_states.size());
+  EXPECT_EQ(std::vector<double>{1.}, dut.last_changes().deadlines);
+  EXPECT_EQ(std::make_optional(3.), dut.NextUpdateTime());
+
+  // Late events report when they were due.
+  timer_.Advance(5.);
+  dut.Update();
+  EXPECT_EQ(last_range_, GetRangeState());
+  EXPECT_EQ(std::vector<double>{3.}, dut.last_changes().deadlines);
+  EXPECT_FALSE(rn_->range_value_rule_state_provider()->GetState(range_rule_id_)->next.has_value());
+  EXPECT_EQ(std::nullopt, dut.NextUpdateTime());
+  EXPECT_EQ((initial_range == first_range_ ? 0 : 1) + (first_range_ == last_range_ ? 0 : 1), num_changes);
+}
+
+// Bounds that were written with fewer digits than the ones of the rule still match its state.
+TEST_F(ScheduledRuleStateHandlerTest, MatchesRangesWithinTolerance) {
+  RuleStateEvent event = RangeEvent(1., last_range_);
+  *event.min += 1e-9 * std::max(1., std::abs(*event.min));
+  *event.max -= 1e-9 * std::max(1., std::abs(*event.max));
+  ScheduledRuleStateHandler dut(&timer_, rn_.get(), RuleStateSchedule{std::nullopt, {event}});
+  timer_.Advance(1.);
+  dut.Update();
+  EXPECT_EQ(last_range_, GetRangeState());
+}
+
+TEST_F(ScheduledRuleStateHandlerTest, Period) {
+  constexpr double kPeriod{4.};
+  ScheduledRuleStateHandler dut(&timer_, rn_.get(), RuleStateSchedule{kPeriod, {RangeEvent(1., first_range_)}});
+  timer_.Advance(1.);
+  dut.Update();
+  const auto result = rn_->range_value_rule_state_provider()->GetState(range_rule_id_);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_TRUE(result->next.has_value());
+  EXPECT_EQ(first_range_, result->next->state);
+  EXPECT_EQ(std::make_optional(kPeriod), result->next->duration_until);
+  EXPECT_EQ(std::make_optional(1. + kPeriod), dut.NextUpdateTime());
+
+  // Missed periods are caught up with.
+  timer_.Advance(100.);
+  dut.Update();
+  EXPECT_EQ(std::make_optional(105.), dut.NextUpdateTime());
+
+  // Handlers created later start from the current period.
+  const ScheduledRuleStateHandler late(&timer_, rn_.get(),
+                                       RuleStateSchedule{kPeriod, {RangeEvent(1., first_range_)}});
+  EXPECT_EQ(std::make_optional(97.), late.NextUpdateTime());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,70 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/steady_timer.h"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(SteadyTimerTest, SteadyTimer) {
+  const double kFirstSleep{0.250};  // seconds
+
+  // Initialization.
+  SteadyTimer dut{};
+  EXPECT_LT(dut.Elapsed(), kFirstSleep);
+
+  // Elapsed.
+  std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(kFirstSleep * 1000)));
+  EXPECT_GE(dut.Elapsed(), kFirstSleep);
+
+  // Reset
+  dut.Reset();
+  EXPECT_LT(dut.Elapsed(), kFirstSleep);
+}
+
+// Consecutive readings never go backwards.
+GTEST_TEST(SteadyTimerTest, Monotonic) {
+  SteadyTimer dut{};
+  double previous = dut.Elapsed();
+  for (int i = 0; i < 10000; ++i) {
+    const double current = dut.Elapsed();
+    ASSERT_LE(previous, current);
+    previous = current;
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
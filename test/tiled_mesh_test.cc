@@ -0,0 +1,170 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/tiled_mesh.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/common/filesystem.h>
+#include <yaml-cpp/yaml.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Two unit squares whose centroids fall in tiles (0, 0) and (-1, 2) when tiles are 2m wide.
+constexpr char kObj[] = R"R(v 0 0 0
+v 1 0 0
+v 1 1 0
+v 0 1 0
+v -2 4 1
+v -1 4 1
+v -1 5 1
+v -2 5 1
+f 1 2 3 4
+f 5 6 7 8
+)R";
+
+GTEST_TEST(PartitionMeshTest, AssignsFacesByCentroid) {
+  std::istringstream in(kObj);
+  const Mesh mesh = ReadObj(&in);
+  EXPECT_THROW(PartitionMesh(mesh, 0.), maliput::common::assertion_error);
+
+  const std::map<std::pair<int, int>, Mesh> dut = PartitionMesh(mesh, 2.);
+  ASSERT_EQ(2, static_cast<int>(dut.size()));
+  ASSERT_EQ(1, dut.count({0, 0}));
+  ASSERT_EQ(1, dut.count({-1, 2}));
+  EXPECT_EQ(1, dut.at({0, 0}).num_faces());
+  EXPECT_EQ(maliput::math::Vector3(-2., 4., 1.), dut.at({-1, 2}).vertices.front());
+
+  // Tiles are aligned with the origin, so faces on both sides of x = 0 never share a tile.
+  const std::map<std::pair<int, int>, Mesh> large_tiles = PartitionMesh(mesh, 100.);
+  EXPECT_EQ(1, large_tiles.count({0, 0}));
+  EXPECT_EQ(1, large_tiles.count({-1, 0}));
+}
+
+GTEST_TEST(WriteTiledMeshIndexTest, Serialization) {
+  TiledMeshIndex index;
+  index.tile_size = 10.;
+  index.levels_of_detail = {{1., 0.}, {4., 0.05}};
+  index.material_file = "map.mtl";
+  index.tiles.push_back(Tile{-1, 2, {-9., 21., 0.}, {-1., 29., 1.}, {"a.obj", ""}, {12, 0}});
+  EXPECT_THROW(WriteTiledMeshIndex(index, nullptr), maliput::common::assertion_error);
+
+  std::ostringstream out;
+  WriteTiledMeshIndex(index, &out);
+  const YAML::Node dut = YAML::Load(out.str());
+  EXPECT_EQ(10., dut["tile_size"].as<double>());
+  EXPECT_EQ("map.mtl", dut["material_file"].as<std::string>());
+  ASSERT_EQ(2u, dut["levels_of_detail"].size());
+  EXPECT_EQ(4., dut["levels_of_detail"][1]["max_grid_unit"].as<double>());
+  EXPECT_EQ(0.05, dut["levels_of_detail"][1]["simplify_mesh_threshold"].as<double>());
+  ASSERT_EQ(1u, dut["tiles"].size());
+  const YAML::Node& tile = dut["tiles"][0];
+  EXPECT_EQ(-1, tile["column"].as<int>());
+  EXPECT_EQ(2, tile["row"].as<int>());
+  EXPECT_EQ((std::vector<double>{-10., 20., 0., 30.}), tile["cell"].as<std::vector<double>>());
+  EXPECT_EQ((std::vector<double>{-9., 21., 0.}), tile["bounds"]["min"].as<std::vector<double>>());
+  EXPECT_EQ((std::vector<double>{-1., 29., 1.}), tile["bounds"]["max"].as<std::vector<double>>());
+  ASSERT_EQ(2u, tile["levels"].size());
+  EXPECT_EQ("a.obj", tile["levels"][0]["file"].as<std::string>());
+  EXPECT_EQ(12, tile["levels"][0]["triangles"].as<int>());
+  EXPECT_EQ("", tile["levels"][1]["file"].as<std::string>());
+}
+
+class GenerateTiledObjFilesTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+  static constexpr char kFileRoot[] = "tiled_mesh_test";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    features_.draw_elevation_bounds = false;
+    options_.tile_size = 20.;
+    options_.levels_of_detail = {{1., 0.}, {10., 0.5}};
+    options_.generation.scratch_dirpath = kDirpath;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  const std::string kDirpath{common::Filesystem::get_cwd().get_path()};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  utility::ObjFeatures features_;
+  TiledMeshOptions options_;
+};
+
+TEST_F(GenerateTiledObjFilesTest, Throws) {
+  EXPECT_THROW(GenerateTiledObjFiles(nullptr, kDirpath, kFileRoot, features_, options_),
+               maliput::common::assertion_error);
+  options_.levels_of_detail.clear();
+  EXPECT_THROW(GenerateTiledObjFiles(rn_->road_geometry(), kDirpath, kFileRoot, features_, options_),
+               maliput::common::assertion_error);
+}
+
+TEST_F(GenerateTiledObjFilesTest, TilesCoverTheWholeMesh) {
+  const TiledMeshIndex dut = GenerateTiledObjFiles(rn_->road_geometry(), kDirpath, kFileRoot, features_, options_);
+  EXPECT_EQ(std::string(kFileRoot) + ".mtl", dut.material_file);
+  ASSERT_LT(1u, dut.tiles.size());
+
+  for (int level = 0; level < 2; ++level) {
+    utility::ObjFeatures level_features = features_;
+    level_features.max_grid_unit = options_.levels_of_detail[level].max_grid_unit;
+    level_features.simplify_mesh_threshold = options_.levels_of_detail[level].simplify_mesh_threshold;
+    const RoadMesh expected = GenerateRoadMesh(rn_->road_geometry(), level_features, options_.generation, nullptr);
+    int64_t num_triangles{0};
+    for (const Tile& tile : dut.tiles) {
+      ASSERT_EQ(2u, tile.files.size());
+      if (tile.files[level].empty()) {
+        continue;
+      }
+      const Mesh mesh = ReadObjFile(kDirpath + "/" + tile.files[level]);
+      EXPECT_EQ(CountTriangles(mesh), tile.num_triangles[level]);
+      num_triangles += tile.num_triangles[level];
+    }
+    EXPECT_EQ(CountTriangles(expected.mesh), num_triangles);
+  }
+
+  const YAML::Node index = YAML::LoadFile(kDirpath + "/" + kFileRoot + "_tiles.yaml");
+  EXPECT_EQ(dut.tiles.size(), index["tiles"].size());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
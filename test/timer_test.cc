@@ -60,6 +60,20 @@ GTEST_TEST(TimerTest, API) {
   EXPECT_EQ(MockTimer::kElapsedTime, dut->Elapsed());
 }
 
+// Subclasses that override Elapsed() itself, as the API allows, are still dispatched to.
+class ElapsedOverridingTimer : public MockTimer {
+ public:
+  static constexpr double kElapsedTime{456};
+
+  double Elapsed() const override { return kElapsedTime; }
+};
+
+GTEST_TEST(TimerTest, ElapsedOverride) {
+  const ElapsedOverridingTimer timer{};
+  const Timer* dut = &timer;
+  EXPECT_EQ(ElapsedOverridingTimer::kElapsedTime, dut->Elapsed());
+}
+
 }  // namespace
 }  // namespace integration
 }  // namespace maliput
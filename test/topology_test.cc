@@ -0,0 +1,250 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/topology.h"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/common/filesystem.h>
+#include <yaml-cpp/yaml.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class TopologyTest : public ::testing::Test {
+ public:
+  static constexpr char kXodrFileName[] = "/resources/odr/TShapeRoad.xodr";
+
+  void SetUp() override {
+    MalidriveBuildProperties properties{};
+    properties.xodr_file_path = kXodrFilePath;
+    properties.linear_tolerance = 5e-2;
+    rn_ = CreateMalidriveRoadNetwork(properties);
+    ASSERT_NE(rn_, nullptr);
+    rg_ = rn_->road_geometry();
+  }
+
+  // @returns A copy of @p buffer in 8-byte aligned storage.
+  static std::vector<uint64_t> Aligned(const std::vector<char>& buffer) {
+    std::vector<uint64_t> aligned((buffer.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    std::copy(buffer.begin(), buffer.end(), reinterpret_cast<char*>(aligned.data()));
+    return aligned;
+  }
+
+  const std::string kMaliputMalidriveResourcePath{DEF_MALIDRIVE_RESOURCES};
+  const std::string kXodrFilePath{kMaliputMalidriveResourcePath + kXodrFileName};
+  std::unique_ptr<api::RoadNetwork> rn_;
+  const api::RoadGeometry* rg_{};
+};
+
+TEST_F(TopologyTest, Throws) {
+  EXPECT_THROW(SerializeTopology(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(TopologyView(nullptr, 0), maliput::common::assertion_error);
+
+  const std::vector<char> buffer = SerializeTopology(rg_);
+  std::vector<uint64_t> aligned = Aligned(buffer);
+  const char* data = reinterpret_cast<const char*>(aligned.data());
+  EXPECT_NO_THROW(TopologyView(data, buffer.size()));
+  // Truncated buffer.
+  EXPECT_THROW(TopologyView(data, sizeof(TopologyHeader) - 1), maliput::common::assertion_error);
+  EXPECT_THROW(TopologyView(data, buffer.size() / 2), maliput::common::assertion_error);
+  // Misaligned buffer.
+  EXPECT_THROW(TopologyView(data + 1, buffer.size() - 1), maliput::common::assertion_error);
+  // Wrong magic.
+  reinterpret_cast<char*>(aligned.data())[0] = 'X';
+  EXPECT_THROW(TopologyView(data, buffer.size()), maliput::common::assertion_error);
+}
+
+// Corrupted string references and record indices are rejected instead of being read out of the buffer.
+TEST_F(TopologyTest, MalformedRecords) {
+  const std::vector<char> buffer = SerializeTopology(rg_);
+  const auto expect_rejected = [&buffer](const std::function<void(char* data, const TopologyHeader&)>& corrupt) {
+    std::vector<uint64_t> aligned = Aligned(buffer);
+    char* data = reinterpret_cast<char*>(aligned.data());
+    TopologyHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    corrupt(data, header);
+    EXPECT_THROW(TopologyView(data, buffer.size()), maliput::common::assertion_error);
+  };
+  const auto junction = [](char* data, const TopologyHeader& header, int index) {
+    return reinterpret_cast<TopologyJunction*>(data + header.junctions_offset) + index;
+  };
+  const auto lane = [](char* data, const TopologyHeader& header, int index) {
+    return reinterpret_cast<TopologyLane*>(data + header.lanes_offset) + index;
+  };
+
+  expect_rejected([](char* data, const TopologyHeader&) {
+    reinterpret_cast<TopologyHeader*>(data)->road_geometry_id.offset = std::numeric_limits<uint32_t>::max();
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    junction(data, header, 0)->id.size = static_cast<uint32_t>(header.strings_size);
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    junction(data, header, 0)->num_segments = static_cast<int32_t>(header.num_segments) + 1;
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) { junction(data, header, 0)->first_segment = -1; });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    reinterpret_cast<TopologySegment*>(data + header.segments_offset)->junction =
+        static_cast<int32_t>(header.num_junctions);
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    lane(data, header, 0)->left_lane = static_cast<int32_t>(header.num_lanes);
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) { lane(data, header, 0)->branch_points[1] = -2; });
+  expect_rejected(
+      [&](char* data, const TopologyHeader& header) { lane(data, header, 0)->default_branches[0] = {0, 2}; });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    reinterpret_cast<TopologyBranchPoint*>(data + header.branch_points_offset)->num_b_side =
+        static_cast<int32_t>(header.num_lane_ends);
+  });
+  expect_rejected([&](char* data, const TopologyHeader& header) {
+    reinterpret_cast<TopologyLaneEnd*>(data + header.lane_ends_offset)->lane = static_cast<int32_t>(header.num_lanes);
+  });
+}
+
+TEST_F(TopologyTest, RoundTrip) {
+  const std::vector<char> buffer = SerializeTopology(rg_);
+  const std::vector<uint64_t> aligned = Aligned(buffer);
+  const TopologyView topology(reinterpret_cast<const char*>(aligned.data()), buffer.size());
+
+  EXPECT_EQ(rg_->id().string(), topology.road_geometry_id());
+  EXPECT_EQ(rg_->linear_tolerance(), topology.header().linear_tolerance);
+  EXPECT_EQ(rg_->angular_tolerance(), topology.header().angular_tolerance);
+  ASSERT_EQ(rg_->num_junctions(), topology.num_junctions());
+  ASSERT_EQ(rg_->num_branch_points(), topology.num_branch_points());
+
+  int segment_index{0};
+  int lane_index{0};
+  for (int i = 0; i < rg_->num_junctions(); ++i) {
+    const api::Junction* junction = rg_->junction(i);
+    const TopologyJunction& junction_record = topology.junction(i);
+    EXPECT_EQ(junction->id().string(), topology.string(junction_record.id));
+    ASSERT_EQ(junction->num_segments(), junction_record.num_segments);
+    EXPECT_EQ(segment_index, junction_record.first_segment);
+    for (int j = 0; j < junction->num_segments(); ++j, ++segment_index) {
+      const api::Segment* segment = junction->segment(j);
+      const TopologySegment& segment_record = topology.segment(segment_index);
+      EXPECT_EQ(segment->id().string(), topology.string(segment_record.id));
+      EXPECT_EQ(i, segment_record.junction);
+      ASSERT_EQ(segment->num_lanes(), segment_record.num_lanes);
+      EXPECT_EQ(lane_index, segment_record.first_lane);
+      for (int k = 0; k < segment->num_lanes(); ++k, ++lane_index) {
+        const api::Lane* lane = segment->lane(k);
+        const TopologyLane& lane_record = topology.lane(lane_index);
+        EXPECT_EQ(lane->id().string(), topology.string(lane_record.id));
+        EXPECT_EQ(segment_index, lane_record.segment);
+        EXPECT_EQ(lane->index(), lane_record.index);
+        EXPECT_EQ(lane->length(), lane_record.length);
+        EXPECT_EQ(lane->lane_bounds(0.).min(), lane_record.lane_bounds[0][0]);
+        EXPECT_EQ(lane->lane_bounds(0.).max(), lane_record.lane_bounds[0][1]);
+        if (lane->to_left() != nullptr) {
+          ASSERT_LE(0, lane_record.left_lane);
+          EXPECT_EQ(lane->to_left()->id().string(), topology.string(topology.lane(lane_record.left_lane).id));
+        } else {
+          EXPECT_EQ(-1, lane_record.left_lane);
+        }
+        const api::BranchPoint* start = lane->GetBranchPoint(api::LaneEnd::kStart);
+        ASSERT_LE(0, lane_record.branch_points[0]);
+        EXPECT_EQ(start->id().string(), topology.string(topology.branch_point(lane_record.branch_points[0]).id));
+      }
+    }
+  }
+  EXPECT_EQ(segment_index, topology.num_segments());
+  EXPECT_EQ(lane_index, topology.num_lanes());
+
+  for (int i = 0; i < rg_->num_branch_points(); ++i) {
+    const api::BranchPoint* branch_point = rg_->branch_point(i);
+    const TopologyBranchPoint& branch_point_record = topology.branch_point(i);
+    EXPECT_EQ(branch_point->id().string(), topology.string(branch_point_record.id));
+    ASSERT_EQ(branch_point->GetASide()->size(), branch_point_record.num_a_side);
+    ASSERT_EQ(branch_point->GetBSide()->size(), branch_point_record.num_b_side);
+    for (int j = 0; j < branch_point->GetASide()->size(); ++j) {
+      const api::LaneEnd& lane_end = branch_point->GetASide()->get(j);
+      const TopologyLaneEnd& lane_end_record = topology.lane_end(branch_point_record.first_lane_end + j);
+      EXPECT_EQ(lane_end.lane->id().string(), topology.string(topology.lane(lane_end_record.lane).id));
+      EXPECT_EQ(lane_end.end == api::LaneEnd::kStart ? 0 : 1, lane_end_record.end);
+    }
+  }
+}
+
+TEST_F(TopologyTest, MappedFile) {
+  const std::string file_path = common::Filesystem::get_cwd().get_path() + "/topology_test.bin";
+  WriteTopologyFile(SerializeTopology(rg_), file_path);
+  {
+    const MappedTopologyFile file(file_path);
+    EXPECT_EQ(rg_->id().string(), file.view().road_geometry_id());
+    EXPECT_EQ(rg_->num_junctions(), file.view().num_junctions());
+    EXPECT_EQ(rg_->num_branch_points(), file.view().num_branch_points());
+  }
+  std::remove(file_path.c_str());
+  EXPECT_THROW(MappedTopologyFile{file_path}, maliput::common::assertion_error);
+}
+
+TEST_F(TopologyTest, Json) {
+  const std::vector<char> buffer = SerializeTopology(rg_);
+  const std::vector<uint64_t> aligned = Aligned(buffer);
+  const TopologyView topology(reinterpret_cast<const char*>(aligned.data()), buffer.size());
+  std::ostringstream out;
+  WriteTopologyJson(topology, &out);
+
+  // JSON documents are YAML documents as well.
+  const YAML::Node json = YAML::Load(out.str());
+  EXPECT_EQ(rg_->id().string(), json["road_geometry"]["id"].as<std::string>());
+  ASSERT_EQ(topology.num_junctions(), static_cast<int>(json["junctions"].size()));
+  ASSERT_EQ(topology.num_segments(), static_cast<int>(json["segments"].size()));
+  ASSERT_EQ(topology.num_lanes(), static_cast<int>(json["lanes"].size()));
+  ASSERT_EQ(topology.num_branch_points(), static_cast<int>(json["branch_points"].size()));
+  for (int i = 0; i < topology.num_lanes(); ++i) {
+    const TopologyLane& lane = topology.lane(i);
+    EXPECT_EQ(topology.string(lane.id), json["lanes"][i]["id"].as<std::string>());
+    EXPECT_EQ(lane.segment, json["lanes"][i]["segment"].as<int>());
+    EXPECT_EQ(lane.length, json["lanes"][i]["length"].as<double>());
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,160 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/update_latency_stats.h"
+
+#include <limits>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+constexpr double kDeadlineMissTolerance{1e-3};
+
+GTEST_TEST(UpdateLatencyStatsTest, Constructor) {
+  EXPECT_THROW(UpdateLatencyStats(-1.), maliput::common::assertion_error);
+  const UpdateLatencyStats dut(kDeadlineMissTolerance);
+  EXPECT_EQ(kDeadlineMissTolerance, dut.deadline_miss_tolerance());
+  EXPECT_EQ(0, dut.num_updates());
+  EXPECT_EQ(0, dut.num_transitions());
+  EXPECT_EQ(0, dut.num_missed_deadlines());
+  EXPECT_EQ(0., dut.mean_lateness());
+  EXPECT_EQ(0., dut.max_lateness());
+  EXPECT_EQ(0., dut.LatenessQuantile(0.5));
+}
+
+GTEST_TEST(UpdateLatencyStatsTest, BucketUpperBound) {
+  EXPECT_EQ(1e-6, UpdateLatencyStats::BucketUpperBound(0));
+  EXPECT_EQ(2e-6, UpdateLatencyStats::BucketUpperBound(1));
+  EXPECT_EQ(1024e-6, UpdateLatencyStats::BucketUpperBound(10));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            UpdateLatencyStats::BucketUpperBound(UpdateLatencyStats::kNumBuckets - 1));
+  EXPECT_THROW(UpdateLatencyStats::BucketUpperBound(-1), maliput::common::assertion_error);
+  EXPECT_THROW(UpdateLatencyStats::BucketUpperBound(UpdateLatencyStats::kNumBuckets),
+               maliput::common::assertion_error);
+}
+
+GTEST_TEST(UpdateLatencyStatsTest, AddUpdate) {
+  UpdateLatencyStats dut(kDeadlineMissTolerance);
+  dut.AddUpdate(1e-6, 2e-6);
+  dut.AddUpdate(3e-6, 4e-6);
+  EXPECT_EQ(2, dut.num_updates());
+  EXPECT_EQ(0, dut.num_transitions());
+  EXPECT_DOUBLE_EQ(4e-6, dut.total_update_duration());
+  EXPECT_DOUBLE_EQ(6e-6, dut.total_loop_overhead());
+  EXPECT_EQ(4e-6, dut.max_loop_overhead());
+}
+
+GTEST_TEST(UpdateLatencyStatsTest, AddTransition) {
+  UpdateLatencyStats dut(kDeadlineMissTolerance);
+  // Early transitions count as on time.
+  dut.AddTransition(-1e-6);
+  dut.AddTransition(0.5e-6);
+  dut.AddTransition(3e-6);
+  dut.AddTransition(5e-3);
+  EXPECT_EQ(0, dut.num_updates());
+  EXPECT_EQ(4, dut.num_transitions());
+  EXPECT_EQ(1, dut.num_missed_deadlines());
+  EXPECT_DOUBLE_EQ((0.5e-6 + 3e-6 + 5e-3) / 4., dut.mean_lateness());
+  EXPECT_EQ(5e-3, dut.max_lateness());
+
+  // [0, 1) us, [2, 4) us and [4096, 8192) us.
+  EXPECT_EQ(2, dut.lateness_histogram()[0]);
+  EXPECT_EQ(1, dut.lateness_histogram()[2]);
+  EXPECT_EQ(1, dut.lateness_histogram()[13]);
+  EXPECT_EQ(1e-6, dut.LatenessQuantile(0.));
+  EXPECT_EQ(1e-6, dut.LatenessQuantile(0.5));
+  EXPECT_EQ(4e-6, dut.LatenessQuantile(0.75));
+  // The largest lateness bounds the last bucket.
+  EXPECT_EQ(5e-3, dut.LatenessQuantile(1.));
+  EXPECT_THROW(dut.LatenessQuantile(1.5), maliput::common::assertion_error);
+
+  // Transitions later than the last bound fall in the last bucket.
+  dut.AddTransition(1e6);
+  EXPECT_EQ(1, dut.lateness_histogram()[UpdateLatencyStats::kNumBuckets - 1]);
+  EXPECT_EQ(1e6, dut.LatenessQuantile(1.));
+}
+
+// Every deadline reported by an update is a transition of its own.
+GTEST_TEST(UpdateLatencyStatsTest, AddTransitions) {
+  UpdateLatencyStats dut(kDeadlineMissTolerance);
+  DynamicEnvironmentChanges changes;
+  changes.deadlines = {1., 1.0025};
+  dut.AddTransitions(changes, 1., 1.003);
+  EXPECT_EQ(2, dut.num_transitions());
+  EXPECT_EQ(1, dut.num_missed_deadlines());
+  EXPECT_NEAR(3e-3, dut.max_lateness(), 1e-12);
+  EXPECT_NEAR(1.75e-3, dut.mean_lateness(), 1e-12);
+
+  // Without deadlines, the update counts as a single transition due at the next update time, once it has passed.
+  changes.deadlines.clear();
+  dut.AddTransitions(changes, 2., 2.0005);
+  EXPECT_EQ(3, dut.num_transitions());
+  EXPECT_EQ(1, dut.num_missed_deadlines());
+  dut.AddTransitions(changes, 3., 2.5);
+  dut.AddTransitions(changes, std::nullopt, 2.5);
+  EXPECT_EQ(3, dut.num_transitions());
+}
+
+GTEST_TEST(UpdateLatencyStatsTest, MergeAndClear) {
+  UpdateLatencyStats dut(kDeadlineMissTolerance);
+  dut.AddUpdate(1e-6, 2e-6);
+  dut.AddTransition(3e-6);
+  UpdateLatencyStats other(kDeadlineMissTolerance);
+  other.AddUpdate(2e-6, 4e-6);
+  other.AddTransition(5e-3);
+  other.AddTransition(1e-6);
+  dut.Merge(other);
+  EXPECT_EQ(2, dut.num_updates());
+  EXPECT_EQ(3, dut.num_transitions());
+  EXPECT_EQ(1, dut.num_missed_deadlines());
+  EXPECT_EQ(5e-3, dut.max_lateness());
+  EXPECT_EQ(1, dut.lateness_histogram()[2]);
+  EXPECT_EQ(1, dut.lateness_histogram()[13]);
+  EXPECT_DOUBLE_EQ(3e-6, dut.total_update_duration());
+  EXPECT_EQ(4e-6, dut.max_loop_overhead());
+  EXPECT_THROW(dut.Merge(UpdateLatencyStats(2. * kDeadlineMissTolerance)), maliput::common::assertion_error);
+
+  EXPECT_NE(std::string::npos, dut.Summary().find("2 updates, 3 transitions, 1 missed deadlines"));
+
+  dut.Clear();
+  EXPECT_EQ(0, dut.num_updates());
+  EXPECT_EQ(0, dut.num_transitions());
+  EXPECT_EQ(0, dut.lateness_histogram()[13]);
+  EXPECT_EQ(kDeadlineMissTolerance, dut.deadline_miss_tolerance());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput